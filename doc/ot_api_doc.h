@@ -204,6 +204,7 @@
  * @defgroup plat-dns-sd                 DNS-SD (mDNS)
  * @defgroup plat-entropy                Entropy
  * @defgroup plat-factory-diagnostics    Factory Diagnostics - Platform
+ * @defgroup plat-history-tracker       History Tracker - Platform
  * @defgroup plat-infra-if               Infrastructure Interface
  * @defgroup plat-logging                Logging - Platform
  * @defgroup plat-memory                 Memory
@@ -0,0 +1,332 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a benchmark of the simulation radio media.
+ *
+ *   It forks one process per simulated node and has every node broadcast frames over the UDP multicast socket
+ *   (`utilsSocket`) and/or the shared-memory medium (`utilsShmMedium`) while receiving the frames of all others. It
+ *   reports the number of frames delivered per second across all nodes.
+ *
+ *   Like CSMA on a real channel, a node holds off sending while it is more than `kSendWindow` frames ahead of the
+ *   slowest other node, so the benchmark measures delivery rather than how fast the receive buffers overflow.
+ *
+ *   Usage: ot-sim-radio-medium-bench [udp|shm|both] [nodes] [frames-per-node]
+ */
+
+#include "platform-simulation.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <sys/wait.h>
+
+#include <openthread/platform/time.h>
+
+#include "simul_shm.h"
+#include "simul_utils.h"
+#include "lib/platform/exit_code.h"
+
+enum
+{
+    kDefaultNumNodes  = 32,
+    kDefaultNumFrames = 5000,
+    kFrameLength      = 64,
+    kPortBase         = 19000,
+    kIdleTimeoutUsec  = 500 * 1000,
+    kStallTimeoutUsec = 20 * 1000,
+    kMaxReceiveBurst  = 64,
+    kSendWindow       = 8,
+};
+
+typedef enum
+{
+    kMediumUdp,
+    kMediumShm,
+} Medium;
+
+typedef struct
+{
+    uint32_t mReceived;
+    uint32_t mDropped;
+} NodeResult;
+
+uint32_t gNodeId = 1;
+
+void otLogCritPlat(const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    vfprintf(stderr, aFormat, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+static uint64_t GetNowUsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * OT_US_PER_S + (uint64_t)now.tv_nsec / 1000;
+}
+
+static uint32_t ReceiveFrames(Medium          aMedium,
+                              utilsSocket    *aSocket,
+                              utilsShmMedium *aShmMedium,
+                              uint32_t        aTimeoutUsec,
+                              uint32_t       *aRxCounts)
+{
+    uint8_t        buffer[UTILS_SHM_MEDIUM_MAX_DATA_SIZE];
+    uint16_t       senderNodeId;
+    uint32_t       received = 0;
+    fd_set         readFdSet;
+    int            maxFd   = -1;
+    struct timeval timeout = {(time_t)(aTimeoutUsec / OT_US_PER_S), (suseconds_t)(aTimeoutUsec % OT_US_PER_S)};
+
+    FD_ZERO(&readFdSet);
+
+    if (aMedium == kMediumShm)
+    {
+        utilsAddShmMediumRxFd(aShmMedium, &readFdSet, &timeout, &maxFd);
+    }
+    else
+    {
+        utilsAddSocketRxFd(aSocket, &readFdSet, &maxFd);
+    }
+
+    if (select(maxFd + 1, &readFdSet, NULL, NULL, &timeout) < 0)
+    {
+        VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+        FD_ZERO(&readFdSet);
+    }
+
+    if (aMedium == kMediumShm)
+    {
+        if (utilsCanShmMediumReceive(aShmMedium, &readFdSet))
+        {
+            while (received < kMaxReceiveBurst &&
+                   utilsReceiveFromShmMedium(aShmMedium, buffer, sizeof(buffer), &senderNodeId) > 0)
+            {
+                aRxCounts[senderNodeId]++;
+                received++;
+            }
+        }
+    }
+    else if (utilsCanSocketReceive(aSocket, &readFdSet) &&
+             utilsReceiveFromSocket(aSocket, buffer, sizeof(buffer), &senderNodeId) > 0 && senderNodeId != gNodeId)
+    {
+        aRxCounts[senderNodeId]++;
+        received++;
+    }
+
+    return received;
+}
+
+static void RunNode(Medium aMedium, uint32_t aNumNodes, uint32_t aNumFrames, int aReadyFd, int aStartFd, int aResultFd)
+{
+    utilsSocket    socket;
+    utilsShmMedium shmMedium;
+    uint8_t        frame[kFrameLength];
+    uint8_t        byte     = 0;
+    uint32_t       expected = (aNumNodes - 1) * aNumFrames;
+    uint32_t       sent     = 0;
+    uint32_t       rxCounts[MAX_NETWORK_SIZE + 1];
+    uint64_t       lastRx;
+    NodeResult     result;
+
+    memset(&result, 0, sizeof(result));
+    memset(rxCounts, 0, sizeof(rxCounts));
+    memset(frame, (int)gNodeId, sizeof(frame));
+
+    if (aMedium == kMediumShm)
+    {
+        utilsInitShmMedium(&shmMedium, kPortBase);
+    }
+    else
+    {
+        utilsInitSocket(&socket, kPortBase);
+    }
+
+    VerifyOrDie(write(aReadyFd, &byte, sizeof(byte)) == sizeof(byte), OT_EXIT_ERROR_ERRNO);
+
+    // Blocks until the parent closes the write end, which releases all nodes at once.
+    VerifyOrDie(read(aStartFd, &byte, sizeof(byte)) == 0, OT_EXIT_ERROR_ERRNO);
+
+    lastRx = GetNowUsec();
+
+    while (sent < aNumFrames || result.mReceived + result.mDropped < expected)
+    {
+        uint32_t received;
+        uint32_t slowest = sent;
+
+        for (uint32_t nodeId = 1; nodeId <= aNumNodes; nodeId++)
+        {
+            if (nodeId != gNodeId && rxCounts[nodeId] < slowest)
+            {
+                slowest = rxCounts[nodeId];
+            }
+        }
+
+        // Send anyway if the slowest node stalls, its frames may have been lost.
+        if (sent < aNumFrames && (sent - slowest < kSendWindow || GetNowUsec() - lastRx >= kStallTimeoutUsec))
+        {
+            if (aMedium == kMediumShm)
+            {
+                utilsSendOverShmMedium(&shmMedium, frame, sizeof(frame));
+            }
+            else
+            {
+                utilsSendOverSocket(&socket, frame, sizeof(frame));
+            }
+
+            sent++;
+        }
+
+        received = ReceiveFrames(aMedium, &socket, &shmMedium,
+                                 (sent < aNumFrames) ? kStallTimeoutUsec : kIdleTimeoutUsec, rxCounts);
+
+        if (aMedium == kMediumShm)
+        {
+            result.mDropped = shmMedium.mDroppedCount;
+        }
+
+        if (received > 0)
+        {
+            result.mReceived += received;
+            lastRx = GetNowUsec();
+        }
+        else if (sent == aNumFrames && GetNowUsec() - lastRx >= kIdleTimeoutUsec)
+        {
+            // Remaining frames were lost (e.g. socket buffer overflow).
+            break;
+        }
+    }
+
+    VerifyOrDie(write(aResultFd, &result, sizeof(result)) == sizeof(result), OT_EXIT_ERROR_ERRNO);
+
+    if (aMedium == kMediumShm)
+    {
+        utilsDeinitShmMedium(&shmMedium);
+    }
+    else
+    {
+        utilsDeinitSocket(&socket);
+    }
+}
+
+static void RunBenchmark(Medium aMedium, uint32_t aNumNodes, uint32_t aNumFrames)
+{
+    int        readyPipe[2];
+    int        startPipe[2];
+    int        resultPipe[2];
+    uint8_t    byte;
+    uint64_t   startTime;
+    uint64_t   duration;
+    uint64_t   received = 0;
+    uint64_t   dropped  = 0;
+    uint64_t   expected = (uint64_t)aNumNodes * (aNumNodes - 1) * aNumFrames;
+    NodeResult result;
+
+    VerifyOrDie(pipe(readyPipe) == 0 && pipe(startPipe) == 0 && pipe(resultPipe) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (uint32_t nodeId = 1; nodeId <= aNumNodes; nodeId++)
+    {
+        pid_t pid = fork();
+
+        VerifyOrDie(pid != -1, OT_EXIT_ERROR_ERRNO);
+
+        if (pid == 0)
+        {
+            gNodeId = nodeId;
+            close(startPipe[1]);
+            RunNode(aMedium, aNumNodes, aNumFrames, readyPipe[1], startPipe[0], resultPipe[1]);
+            _exit(EXIT_SUCCESS);
+        }
+    }
+
+    for (uint32_t i = 0; i < aNumNodes; i++)
+    {
+        VerifyOrDie(read(readyPipe[0], &byte, sizeof(byte)) == sizeof(byte), OT_EXIT_ERROR_ERRNO);
+    }
+
+    startTime = GetNowUsec();
+    close(startPipe[1]);
+
+    for (uint32_t i = 0; i < aNumNodes; i++)
+    {
+        VerifyOrDie(read(resultPipe[0], &result, sizeof(result)) == sizeof(result), OT_EXIT_ERROR_ERRNO);
+        received += result.mReceived;
+        dropped += result.mDropped;
+    }
+
+    duration = GetNowUsec() - startTime;
+
+    while (wait(NULL) > 0)
+    {
+    }
+
+    printf("%s: %u nodes x %u frames, received %llu/%llu (dropped %llu) in %llu msec -- %llu frames/sec\n",
+           (aMedium == kMediumShm) ? "shm" : "udp", aNumNodes, aNumFrames, (unsigned long long)received,
+           (unsigned long long)expected, (unsigned long long)dropped, (unsigned long long)(duration / OT_US_PER_MS),
+           (unsigned long long)(received * OT_US_PER_S / (duration ? duration : 1)));
+
+    close(readyPipe[0]);
+    close(readyPipe[1]);
+    close(startPipe[0]);
+    close(resultPipe[0]);
+    close(resultPipe[1]);
+}
+
+int main(int aArgCount, char *aArgVector[])
+{
+    const char *medium    = (aArgCount > 1) ? aArgVector[1] : "both";
+    uint32_t    numNodes  = (aArgCount > 2) ? (uint32_t)strtoul(aArgVector[2], NULL, 0) : kDefaultNumNodes;
+    uint32_t    numFrames = (aArgCount > 3) ? (uint32_t)strtoul(aArgVector[3], NULL, 0) : kDefaultNumFrames;
+
+    if (numNodes < 2 || numNodes > MAX_NETWORK_SIZE || numFrames == 0)
+    {
+        fprintf(stderr, "Usage: %s [udp|shm|both] [nodes (2-%d)] [frames-per-node]\n", aArgVector[0], MAX_NETWORK_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(medium, "shm") != 0)
+    {
+        RunBenchmark(kMediumUdp, numNodes, numFrames);
+    }
+
+    if (strcmp(medium, "udp") != 0)
+    {
+        RunBenchmark(kMediumShm, numNodes, numFrames);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -41,6 +41,7 @@
 #include <openthread/platform/radio.h>
 #include <openthread/platform/time.h>
 
+#include "simul_shm.h"
 #include "simul_utils.h"
 #include "lib/platform/exit_code.h"
 #include "utils/code_utils.h"
@@ -71,9 +72,11 @@ extern int      sSockFd;
 extern uint16_t sPortBase;
 extern uint16_t sPortOffset;
 #else
-static utilsSocket sSocket;
-static uint16_t    sPortBase   = 9000;
-static uint16_t    sPortOffset = 0;
+static utilsSocket    sSocket;
+static utilsShmMedium sShmMedium;
+static bool           sUseShmMedium = false;
+static uint16_t       sPortBase     = 9000;
+static uint16_t       sPortOffset   = 0;
 #endif
 
 static int8_t   sEnergyScanResult  = OT_RADIO_RSSI_INVALID;
@@ -410,7 +413,20 @@ void platformRadioInit(void)
     parseFromEnvAsUint16("PORT_OFFSET", &sPortOffset);
     sPortOffset *= (MAX_NETWORK_SIZE + 1);
 
-    utilsInitSocket(&sSocket, sPortBase + sPortOffset);
+    {
+        char *env = getenv("OT_SIM_USE_SHM_RADIO");
+
+        sUseShmMedium = (env != NULL && !strcmp(env, "1"));
+    }
+
+    if (sUseShmMedium)
+    {
+        utilsInitShmMedium(&sShmMedium, sPortBase + sPortOffset);
+    }
+    else
+    {
+        utilsInitSocket(&sSocket, sPortBase + sPortOffset);
+    }
 #endif
 
     sReceiveFrame.mPsdu  = sReceiveMessage.mPsdu;
@@ -687,12 +703,28 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, struct ti
 {
     if (sState != OT_RADIO_STATE_TRANSMIT || sTxWait)
     {
-        utilsAddSocketRxFd(&sSocket, aReadFdSet, aMaxFd);
+        if (sUseShmMedium)
+        {
+            utilsAddShmMediumRxFd(&sShmMedium, aReadFdSet, aTimeout, aMaxFd);
+        }
+        else
+        {
+            utilsAddSocketRxFd(&sSocket, aReadFdSet, aMaxFd);
+        }
     }
 
     if (platformRadioIsTransmitPending())
     {
-        utilsAddSocketTxFd(&sSocket, aWriteFdSet, aMaxFd);
+        if (sUseShmMedium)
+        {
+            // The shared-memory medium is always ready to send.
+            aTimeout->tv_sec  = 0;
+            aTimeout->tv_usec = 0;
+        }
+        else
+        {
+            utilsAddSocketTxFd(&sSocket, aWriteFdSet, aMaxFd);
+        }
     }
 
     if (sEnergyScanning)
@@ -716,7 +748,11 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, struct ti
 }
 
 // no need to close in virtual time mode.
-void platformRadioDeinit(void) { utilsDeinitSocket(&sSocket); }
+void platformRadioDeinit(void)
+{
+    utilsDeinitSocket(&sSocket);
+    utilsDeinitShmMedium(&sShmMedium);
+}
 #endif // OPENTHREAD_SIMULATION_VIRTUAL_TIME
 
 void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const fd_set *aWriteFdSet)
@@ -725,14 +761,22 @@ void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
     OT_UNUSED_VARIABLE(aWriteFdSet);
 
 #if !OPENTHREAD_SIMULATION_VIRTUAL_TIME
-    if (utilsCanSocketReceive(&sSocket, aReadFdSet))
+    if (sUseShmMedium ? utilsCanShmMediumReceive(&sShmMedium, aReadFdSet)
+                      : utilsCanSocketReceive(&sSocket, aReadFdSet))
     {
         uint16_t senderNodeId;
         uint16_t len;
 
-        len = utilsReceiveFromSocket(&sSocket, &sReceiveMessage, sizeof(sReceiveMessage), &senderNodeId);
+        if (sUseShmMedium)
+        {
+            len = utilsReceiveFromShmMedium(&sShmMedium, &sReceiveMessage, sizeof(sReceiveMessage), &senderNodeId);
+        }
+        else
+        {
+            len = utilsReceiveFromSocket(&sSocket, &sReceiveMessage, sizeof(sReceiveMessage), &senderNodeId);
+        }
 
-        if (NodeIdFilterIsConnectable(senderNodeId))
+        if (len > 0 && NodeIdFilterIsConnectable(senderNodeId))
         {
             sReceiveFrame.mLength = len - 1;
             radioReceive(aInstance);
@@ -755,7 +799,14 @@ void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
 void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFrame)
 {
 #if !OPENTHREAD_SIMULATION_VIRTUAL_TIME
-    utilsSendOverSocket(&sSocket, aMessage, aFrame->mLength + 1); // + 1 is for `mChannel`
+    if (sUseShmMedium)
+    {
+        utilsSendOverShmMedium(&sShmMedium, aMessage, aFrame->mLength + 1); // + 1 is for `mChannel`
+    }
+    else
+    {
+        utilsSendOverSocket(&sSocket, aMessage, aFrame->mLength + 1);
+    }
 #else
     struct Event event;
 
@@ -0,0 +1,442 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "simul_shm.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+
+#include "simul_utils.h"
+#include "lib/platform/exit_code.h"
+#include "utils/code_utils.h"
+
+#define UTILS_SHM_MEDIUM_NAME_FORMAT "/ot-sim-radio-%u"
+#define UTILS_SHM_MEDIUM_DOORBELL_FORMAT "%s/%u_%u.radio"
+
+enum
+{
+    kShmMagic     = 0x6f74736d, // "otsm"
+    kShmSlotCount = 64,         // Number of frames buffered per node (power of two).
+    kShmPathSize  = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32,
+};
+
+typedef struct utilsShmSlot
+{
+    uint32_t mSeq; // Sequence number of the frame in the slot, zero while being written.
+    uint16_t mLength;
+    uint64_t mStamp; // Global send order across all rings.
+    uint8_t  mData[UTILS_SHM_MEDIUM_MAX_DATA_SIZE];
+} utilsShmSlot;
+
+typedef struct utilsShmRing
+{
+    uint32_t     mWriteSeq;    // Sequence number of the last published frame.
+    uint32_t     mWaiting;     // Whether the ring owner sleeps in `select()` and wants its doorbell rung.
+    uint32_t     mDoorbellGen; // Incremented each time the ring owner creates its doorbell FIFO.
+    utilsShmSlot mSlots[kShmSlotCount];
+} utilsShmRing;
+
+struct utilsShmRegion
+{
+    uint32_t     mMagic;
+    uint32_t     mNumAttached; // Number of nodes that have the region mapped.
+    uint64_t     mNextStamp;
+    utilsShmRing mRings[MAX_NETWORK_SIZE];
+};
+
+static void GetRegionName(char *aName, size_t aSize, uint16_t aPortBase)
+{
+    snprintf(aName, aSize, UTILS_SHM_MEDIUM_NAME_FORMAT, aPortBase);
+}
+
+static void GetDoorbellPath(char *aPath, uint16_t aPortBase, uint32_t aNodeId)
+{
+    snprintf(aPath, kShmPathSize, UTILS_SHM_MEDIUM_DOORBELL_FORMAT, OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, aPortBase,
+             aNodeId);
+}
+
+static struct utilsShmRegion *MapRegion(uint16_t aPortBase)
+{
+    struct utilsShmRegion *region = NULL;
+    char                   name[32];
+    int                    fd;
+    struct stat            st;
+    uint32_t               magic = 0;
+
+    GetRegionName(name, sizeof(name), aPortBase);
+
+    fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+    VerifyOrDie(fd != -1, OT_EXIT_ERROR_ERRNO);
+
+    // A new region is zero filled by `ftruncate()`, which is a valid empty state. Nodes starting concurrently may
+    // all truncate it to the same size.
+    VerifyOrDie(fstat(fd, &st) != -1, OT_EXIT_ERROR_ERRNO);
+
+    if (st.st_size == 0)
+    {
+        VerifyOrDie(ftruncate(fd, sizeof(struct utilsShmRegion)) != -1, OT_EXIT_ERROR_ERRNO);
+    }
+    else if (st.st_size != sizeof(struct utilsShmRegion))
+    {
+        fprintf(stderr, "Shared memory %s was created by an incompatible build, remove /dev/shm%s\n", name, name);
+        DieNow(OT_EXIT_FAILURE);
+    }
+
+    region = (struct utilsShmRegion *)mmap(NULL, sizeof(struct utilsShmRegion), PROT_READ | PROT_WRITE, MAP_SHARED,
+                                           fd, 0);
+    VerifyOrDie(region != MAP_FAILED, OT_EXIT_ERROR_ERRNO);
+    close(fd);
+
+    if (!__atomic_compare_exchange_n(&region->mMagic, &magic, kShmMagic, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) &&
+        magic != kShmMagic)
+    {
+        fprintf(stderr, "Shared memory %s is corrupted, remove /dev/shm%s\n", name, name);
+        DieNow(OT_EXIT_FAILURE);
+    }
+
+    return region;
+}
+
+static utilsShmRing *GetRing(utilsShmMedium *aMedium, uint32_t aNodeId)
+{
+    return &aMedium->mRegion->mRings[aNodeId - 1];
+}
+
+static int OpenDoorbell(uint16_t aPortBase, uint32_t aNodeId)
+{
+    char path[kShmPathSize];
+
+    GetDoorbellPath(path, aPortBase, aNodeId);
+
+    // Both the owner and the senders open the FIFO for read and write, so it always has a reader and writing to it
+    // never raises `SIGPIPE`, even after the owner exits.
+    return open(path, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+}
+
+static void RingDoorbell(utilsShmMedium *aMedium, uint32_t aNodeId)
+{
+    int      *fd   = &aMedium->mPeerDoorbellFds[aNodeId - 1];
+    uint32_t *gen  = &aMedium->mPeerDoorbellGens[aNodeId - 1];
+    uint8_t   byte = 0;
+    uint32_t  curGen;
+    ssize_t   rval;
+
+    curGen = __atomic_load_n(&GetRing(aMedium, aNodeId)->mDoorbellGen, __ATOMIC_SEQ_CST);
+
+    // The owner removes its FIFO when it exits and creates a new one when it restarts, so an FD opened before the
+    // restart no longer reaches the owner.
+    if (*fd != -1 && *gen != curGen)
+    {
+        close(*fd);
+        *fd = -1;
+    }
+
+    if (*fd == -1)
+    {
+        *fd = OpenDoorbell(aMedium->mPortBase, aNodeId);
+        otEXPECT(*fd != -1);
+        *gen = curGen;
+    }
+
+    // The FIFO being full (`EAGAIN`) is fine, the owner has not drained previous rings yet.
+    rval = write(*fd, &byte, sizeof(byte));
+    OT_UNUSED_VARIABLE(rval);
+
+exit:
+    return;
+}
+
+static void DrainDoorbell(utilsShmMedium *aMedium)
+{
+    uint8_t buffer[64];
+
+    while (read(aMedium->mDoorbellFd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+}
+
+static utilsShmSlot *PeekSlot(utilsShmMedium *aMedium, uint32_t aNodeId)
+{
+    utilsShmSlot *slot     = NULL;
+    uint32_t     *rxSeq    = &aMedium->mRxSeqs[aNodeId - 1];
+    uint32_t      writeSeq = __atomic_load_n(&GetRing(aMedium, aNodeId)->mWriteSeq, __ATOMIC_SEQ_CST);
+
+    otEXPECT((int32_t)(writeSeq - *rxSeq) >= 0);
+
+    if (writeSeq - *rxSeq >= kShmSlotCount)
+    {
+        // The sender lapped us, skip to the oldest frame still in the ring.
+        aMedium->mDroppedCount += writeSeq - *rxSeq - kShmSlotCount + 1;
+        *rxSeq = writeSeq - kShmSlotCount + 1;
+    }
+
+    slot = &GetRing(aMedium, aNodeId)->mSlots[*rxSeq % kShmSlotCount];
+
+    // The slot may be in the middle of being overwritten, in which case the lap is detected on a later call.
+    if (__atomic_load_n(&slot->mSeq, __ATOMIC_ACQUIRE) != *rxSeq)
+    {
+        slot = NULL;
+    }
+
+exit:
+    return slot;
+}
+
+void utilsInitShmMedium(utilsShmMedium *aMedium, uint16_t aPortBase)
+{
+    char path[kShmPathSize];
+
+    memset(aMedium, 0, sizeof(*aMedium));
+    aMedium->mPortBase = aPortBase;
+    aMedium->mRegion   = MapRegion(aPortBase);
+
+    for (uint32_t nodeId = 1; nodeId <= MAX_NETWORK_SIZE; nodeId++)
+    {
+        aMedium->mPeerDoorbellFds[nodeId - 1] = -1;
+        aMedium->mRxSeqs[nodeId - 1] = __atomic_load_n(&GetRing(aMedium, nodeId)->mWriteSeq, __ATOMIC_SEQ_CST) + 1;
+    }
+
+    mkdir(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, 0777);
+    GetDoorbellPath(path, aPortBase, gNodeId);
+
+    if (mkfifo(path, 0600) == -1 && errno != EEXIST)
+    {
+        perror("mkfifo(Doorbell)");
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+
+    aMedium->mDoorbellFd = OpenDoorbell(aPortBase, gNodeId);
+    VerifyOrDie(aMedium->mDoorbellFd != -1, OT_EXIT_ERROR_ERRNO);
+    DrainDoorbell(aMedium);
+
+    __atomic_add_fetch(&GetRing(aMedium, gNodeId)->mDoorbellGen, 1, __ATOMIC_SEQ_CST);
+    __atomic_add_fetch(&aMedium->mRegion->mNumAttached, 1, __ATOMIC_SEQ_CST);
+
+    aMedium->mInitialized = true;
+}
+
+void utilsDeinitShmMedium(utilsShmMedium *aMedium)
+{
+    char path[kShmPathSize];
+    char name[32];
+
+    otEXPECT(aMedium->mInitialized);
+
+    __atomic_store_n(&GetRing(aMedium, gNodeId)->mWaiting, 0, __ATOMIC_SEQ_CST);
+
+    for (uint32_t nodeId = 1; nodeId <= MAX_NETWORK_SIZE; nodeId++)
+    {
+        if (aMedium->mPeerDoorbellFds[nodeId - 1] != -1)
+        {
+            close(aMedium->mPeerDoorbellFds[nodeId - 1]);
+        }
+    }
+
+    close(aMedium->mDoorbellFd);
+    GetDoorbellPath(path, aMedium->mPortBase, gNodeId);
+    unlink(path);
+
+    // The last node to detach removes the region so that it does not stay in /dev/shm. A node that crashed never
+    // detaches, in which case the region is left for the next run to reuse.
+    if (__atomic_sub_fetch(&aMedium->mRegion->mNumAttached, 1, __ATOMIC_SEQ_CST) == 0)
+    {
+        GetRegionName(name, sizeof(name), aMedium->mPortBase);
+        shm_unlink(name);
+    }
+
+    munmap(aMedium->mRegion, sizeof(struct utilsShmRegion));
+    aMedium->mInitialized = false;
+
+exit:
+    return;
+}
+
+static bool HasPendingFrame(utilsShmMedium *aMedium)
+{
+    bool hasPending = false;
+
+    for (uint32_t nodeId = 1; nodeId <= MAX_NETWORK_SIZE; nodeId++)
+    {
+        if (nodeId != gNodeId && PeekSlot(aMedium, nodeId) != NULL)
+        {
+            hasPending = true;
+            break;
+        }
+    }
+
+    return hasPending;
+}
+
+void utilsAddShmMediumRxFd(utilsShmMedium *aMedium, fd_set *aFdSet, struct timeval *aTimeout, int *aMaxFd)
+{
+    otEXPECT(aMedium->mInitialized);
+
+    // Announce that we may sleep before checking the rings. A sender publishes its frame before checking
+    // `mWaiting`, so either it sees the flag and rings the doorbell, or we see its frame here.
+    __atomic_store_n(&GetRing(aMedium, gNodeId)->mWaiting, 1, __ATOMIC_SEQ_CST);
+    aMedium->mRxArmed = true;
+
+    utilsAddFdToFdSet(aMedium->mDoorbellFd, aFdSet, aMaxFd);
+
+    if (HasPendingFrame(aMedium))
+    {
+        aTimeout->tv_sec  = 0;
+        aTimeout->tv_usec = 0;
+    }
+
+exit:
+    return;
+}
+
+bool utilsCanShmMediumReceive(utilsShmMedium *aMedium, const fd_set *aReadFdSet)
+{
+    bool canReceive = false;
+
+    otEXPECT(aMedium->mInitialized && aMedium->mRxArmed);
+
+    __atomic_store_n(&GetRing(aMedium, gNodeId)->mWaiting, 0, __ATOMIC_SEQ_CST);
+    aMedium->mRxArmed = false;
+
+    if (FD_ISSET(aMedium->mDoorbellFd, aReadFdSet))
+    {
+        DrainDoorbell(aMedium);
+    }
+
+    canReceive = HasPendingFrame(aMedium);
+
+exit:
+    return canReceive;
+}
+
+uint16_t utilsReceiveFromShmMedium(utilsShmMedium *aMedium,
+                                   void           *aBuffer,
+                                   uint16_t        aBufferSize,
+                                   uint16_t       *aSenderNodeId)
+{
+    uint16_t len = 0;
+
+    otEXPECT(aMedium->mInitialized);
+
+    while (true)
+    {
+        utilsShmSlot *oldest       = NULL;
+        uint32_t      senderNodeId = 0;
+        uint32_t      seq;
+
+        // Pick the pending frame that was sent first, so that e.g. an ack is never received before the frame
+        // it acknowledges.
+        for (uint32_t nodeId = 1; nodeId <= MAX_NETWORK_SIZE; nodeId++)
+        {
+            utilsShmSlot *slot;
+
+            if (nodeId == gNodeId)
+            {
+                continue;
+            }
+
+            slot = PeekSlot(aMedium, nodeId);
+
+            if (slot != NULL && (oldest == NULL || slot->mStamp < oldest->mStamp))
+            {
+                oldest       = slot;
+                senderNodeId = nodeId;
+            }
+        }
+
+        otEXPECT(oldest != NULL);
+
+        seq = aMedium->mRxSeqs[senderNodeId - 1];
+        len = oldest->mLength;
+
+        if (len > aBufferSize)
+        {
+            len = aBufferSize;
+        }
+
+        memcpy(aBuffer, oldest->mData, len);
+
+        // Seqlock read: the copy is only valid if the sender did not start overwriting the slot meanwhile.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&oldest->mSeq, __ATOMIC_RELAXED) != seq)
+        {
+            len = 0;
+            continue;
+        }
+
+        aMedium->mRxSeqs[senderNodeId - 1] = seq + 1;
+
+        if (aSenderNodeId != NULL)
+        {
+            *aSenderNodeId = (uint16_t)senderNodeId;
+        }
+
+        break;
+    }
+
+exit:
+    return len;
+}
+
+void utilsSendOverShmMedium(utilsShmMedium *aMedium, const void *aBuffer, uint16_t aBufferLength)
+{
+    utilsShmRing *ring;
+    utilsShmSlot *slot;
+    uint32_t      seq;
+
+    otEXPECT(aMedium->mInitialized);
+    assert(aBufferLength <= UTILS_SHM_MEDIUM_MAX_DATA_SIZE);
+
+    ring = GetRing(aMedium, gNodeId);
+    seq  = ring->mWriteSeq + 1;
+    slot = &ring->mSlots[seq % kShmSlotCount];
+
+    __atomic_store_n(&slot->mSeq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(slot->mData, aBuffer, aBufferLength);
+    slot->mLength = aBufferLength;
+    slot->mStamp  = __atomic_fetch_add(&aMedium->mRegion->mNextStamp, 1, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&slot->mSeq, seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->mWriteSeq, seq, __ATOMIC_SEQ_CST);
+
+    for (uint32_t nodeId = 1; nodeId <= MAX_NETWORK_SIZE; nodeId++)
+    {
+        uint32_t *waiting = &GetRing(aMedium, nodeId)->mWaiting;
+
+        if (nodeId != gNodeId && __atomic_load_n(waiting, __ATOMIC_SEQ_CST) &&
+            __atomic_exchange_n(waiting, 0, __ATOMIC_SEQ_CST))
+        {
+            RingDoorbell(aMedium, nodeId);
+        }
+    }
+
+exit:
+    return;
+}
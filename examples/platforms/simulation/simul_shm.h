@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLATFORM_SIMULATION_SHM_UTILS_H_
+#define PLATFORM_SIMULATION_SHM_UTILS_H_
+
+#include "platform-simulation.h"
+
+#include <openthread/platform/radio.h>
+
+enum
+{
+    UTILS_SHM_MEDIUM_MAX_DATA_SIZE = 1 + OT_RADIO_FRAME_MAX_SIZE, ///< Max datagram size (channel + PSDU).
+};
+
+struct utilsShmRegion;
+
+/**
+ * Represents a shared-memory medium for communication with other simulation nodes.
+ *
+ * All nodes using the same port base map the same POSIX shared-memory region. Each node owns one ring in the region
+ * and is its only producer, every other node reads the ring at its own pace. A node sleeping in `select()` is woken
+ * through a per-node FIFO "doorbell", which a sender only rings when the node has announced it is waiting. A busy
+ * node therefore exchanges frames without any system calls.
+ *
+ * The rings are lossy: a reader that falls more than a ring length behind a sender drops the overwritten frames.
+ */
+typedef struct utilsShmMedium
+{
+    bool                   mInitialized;                        ///< Whether or not initialized.
+    bool                   mRxArmed;                            ///< Whether the doorbell is armed for this cycle.
+    int                    mDoorbellFd;                         ///< The FIFO read FD of this node.
+    int                    mPeerDoorbellFds[MAX_NETWORK_SIZE];  ///< The FIFO FDs of other nodes (opened lazily).
+    uint32_t               mPeerDoorbellGens[MAX_NETWORK_SIZE]; ///< The FIFO generation each peer FD was opened for.
+    uint16_t               mPortBase;                           ///< Base port number value (identifies the region).
+    struct utilsShmRegion *mRegion;                             ///< The mapped shared-memory region.
+    uint32_t               mRxSeqs[MAX_NETWORK_SIZE];           ///< Next sequence number to read from each ring.
+    uint32_t               mDroppedCount;                       ///< Number of frames overwritten before being read.
+} utilsShmMedium;
+
+/**
+ * Initializes the shared-memory medium.
+ *
+ * The region is created by the first node and mapped by the others.
+ *
+ * @param[in] aMedium     The medium to initialize.
+ * @param[in] aPortBase   The base port number value. Nodes with the same @p aPortBase share the medium.
+ */
+void utilsInitShmMedium(utilsShmMedium *aMedium, uint16_t aPortBase);
+
+/**
+ * De-initializes the shared-memory medium.
+ *
+ * The doorbell FIFO of this node is removed. The last node to de-initialize also removes the shared-memory region,
+ * while a node that is still running keeps it in place for other (or restarted) nodes.
+ *
+ * @param[in] aMedium   The medium to de-initialize.
+ */
+void utilsDeinitShmMedium(utilsShmMedium *aMedium);
+
+/**
+ * Prepares the medium to receive while the caller is sleeping in `select()`.
+ *
+ * Arms the doorbell and adds its FD to a given FD set. If a frame is already pending, @p aTimeout is set to zero.
+ *
+ * @param[in] aMedium    The medium.
+ * @param[in] aFdSet     The (read) FD set to add to.
+ * @param[in] aTimeout   A pointer to the `select()` timeout.
+ * @param[in] aMaxFd     A pointer to track maximum FD in @p aFdSet (can be NULL).
+ */
+void utilsAddShmMediumRxFd(utilsShmMedium *aMedium, fd_set *aFdSet, struct timeval *aTimeout, int *aMaxFd);
+
+/**
+ * Indicates whether the medium can receive.
+ *
+ * MUST be called once after every `select()` which followed `utilsAddShmMediumRxFd()`. Disarms the doorbell.
+ *
+ * @param[in] aMedium       The medium.
+ * @param[in] aReadFdSet    The read FD set.
+ *
+ * @retval TRUE   The medium was armed for receive and a frame is pending.
+ * @retval FALSE  The medium was not armed for receive or no frame is pending.
+ */
+bool utilsCanShmMediumReceive(utilsShmMedium *aMedium, const fd_set *aReadFdSet);
+
+/**
+ * Receives the oldest pending frame from the medium.
+ *
+ * Frames from all other nodes are delivered in the order they were sent.
+ *
+ * @param[in]  aMedium         The medium.
+ * @param[out] aBuffer         The buffer to output the read content.
+ * @param[in]  aBufferSize     Maximum size of buffer in bytes.
+ * @param[out] aSenderNodeId   A pointer to return the Node ID of the sender. Can be NULL if not needed.
+ *
+ * @returns The number of received bytes written into @p aBuffer, or zero if no frame is pending.
+ */
+uint16_t utilsReceiveFromShmMedium(utilsShmMedium *aMedium,
+                                   void           *aBuffer,
+                                   uint16_t        aBufferSize,
+                                   uint16_t       *aSenderNodeId);
+
+/**
+ * Sends data over the medium to all other nodes.
+ *
+ * @param[in] aMedium         The medium.
+ * @param[in] aBuffer         The buffer containing the bytes to sent.
+ * @param[in] aBufferLength   Size of data in @p aBuffer in bytes. MUST not exceed `UTILS_SHM_MEDIUM_MAX_DATA_SIZE`.
+ */
+void utilsSendOverShmMedium(utilsShmMedium *aMedium, const void *aBuffer, uint16_t aBufferLength);
+
+#endif // PLATFORM_SIMULATION_SHM_UTILS_H_
@@ -93,6 +93,8 @@ typedef struct otBorderAgentCounters
     uint32_t mPskcCommissionerPetitions;     ///< The number of successful commissioner petitions with PSKc
     uint32_t mMgmtActiveGets;                ///< The number of MGMT_ACTIVE_GET.req sent over secure sessions
     uint32_t mMgmtPendingGets;               ///< The number of MGMT_PENDING_GET.req sent over secure sessions
+    uint32_t mPskcFullHandshakes;            ///< The number of full DTLS handshakes with PSKc
+    uint32_t mPskcResumedHandshakes;         ///< The number of DTLS handshakes with PSKc resuming a cached session
 } otBorderAgentCounters;
 
 /**
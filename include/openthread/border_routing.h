@@ -188,6 +188,19 @@ typedef struct otPdProcessedRaInfo
     uint32_t mLastPlatformRaMsec;      ///< The timestamp of last processed RA message.
 } otPdProcessedRaInfo;
 
+/**
+ * Represents the counters of the cache used by the reachability check of forwarded packets.
+ *
+ * The reachability check decides whether an ICMPv6 Destination Unreachable error is sent for a packet forwarded from
+ * the Thread mesh to the infrastructure link. Its outcome is cached per source /64 prefix and destination address.
+ */
+typedef struct otBorderRoutingReachabilityCacheCounters
+{
+    uint32_t mHits;          ///< Number of checks answered from the cache.
+    uint32_t mMisses;        ///< Number of checks that required walking Network Data and the RA tracker tables.
+    uint32_t mInvalidations; ///< Number of times the cache was invalidated.
+} otBorderRoutingReachabilityCacheCounters;
+
 /**
  * Represents the configuration options related to the OMR prefix.
  *
@@ -773,6 +786,26 @@ void otBorderRoutingDhcp6PdSetRequestCallback(otInstance
                                               otBorderRoutingRequestDhcp6PdCallback aCallback,
                                               void                                 *aContext);
 
+/**
+ * Gets the reachability check cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the reachability check cache counters.
+ */
+const otBorderRoutingReachabilityCacheCounters *otBorderRoutingGetReachabilityCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the reachability check cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otBorderRoutingResetReachabilityCacheCounters(otInstance *aInstance);
+
 /**
  * Sets the local on-link prefix.
  *
@@ -151,6 +151,55 @@ uint32_t otChannelMonitorGetSampleCount(otInstance *aInstance);
  */
 uint16_t otChannelMonitorGetChannelOccupancy(otInstance *aInstance, uint8_t aChannel);
 
+#define OT_CHANNEL_MONITOR_NUM_RSSI_BINS 8     ///< Number of bins in the per-channel RSSI histogram.
+#define OT_CHANNEL_MONITOR_RSSI_BIN_MIN (-96)  ///< Upper edge (exclusive) of the first RSSI histogram bin (dBm).
+#define OT_CHANNEL_MONITOR_RSSI_BIN_WIDTH 8    ///< Width of the RSSI histogram bins (dB).
+#define OT_CHANNEL_MONITOR_NUM_TIME_BUCKETS 24 ///< Number of time buckets tracking the busy ratio per channel.
+
+/**
+ * Represents the detailed statistics of a channel collected by the channel monitoring module.
+ *
+ * The RSSI histogram bin `0` counts the samples below `OT_CHANNEL_MONITOR_RSSI_BIN_MIN`. Bin `i` (`i > 0`) counts the
+ * samples in `[OT_CHANNEL_MONITOR_RSSI_BIN_MIN + (i - 1) * width, OT_CHANNEL_MONITOR_RSSI_BIN_MIN + i * width)`, and
+ * the last bin also includes all higher samples. When a bin count saturates, all bins of the channel are halved so
+ * that older samples gradually lose weight.
+ *
+ * The busy ratio is tracked per time bucket. Each bucket covers a fixed interval (one hour by default, see
+ * `OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_BUCKET_INTERVAL`) and the buckets form a ring, so with the default
+ * configuration they cover the last day split by hour. The value `0xffff` means all samples were above the RSSI
+ * threshold (100% busy).
+ *
+ * The RSSI percentiles are reported as the upper edge of the histogram bin containing them, or as
+ * `OT_RADIO_RSSI_INVALID` if no RSSI sample was collected.
+ */
+typedef struct otChannelMonitorChannelStats
+{
+    uint16_t mRssiHistogram[OT_CHANNEL_MONITOR_NUM_RSSI_BINS]; ///< Number of RSSI samples per histogram bin.
+    uint16_t mBusyRatios[OT_CHANNEL_MONITOR_NUM_TIME_BUCKETS]; ///< Busy ratio per time bucket, newest first.
+    uint8_t  mNumTimeBuckets;                                  ///< Number of valid entries in `mBusyRatios`.
+    int8_t   mRssiMedian;                                      ///< Median RSSI (dBm).
+    int8_t   mRssiP90;                                         ///< 90th percentile RSSI (dBm).
+    uint16_t mBusyRatioMedian;                                 ///< Median busy ratio over valid time buckets.
+    uint16_t mBusyRatioP90;                                    ///< 90th percentile busy ratio over valid time buckets.
+} otChannelMonitorChannelStats;
+
+/**
+ * Gets the detailed statistics for a given channel.
+ *
+ * Requires `OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE`.
+ *
+ * The statistics are maintained incrementally (in fixed memory) as RSSI samples are collected and are cleared
+ * together with the channel occupancy when the channel monitoring operation is started.
+ *
+ * @param[in]  aInstance       A pointer to an OpenThread instance.
+ * @param[in]  aChannel        The channel for which to get the statistics.
+ * @param[out] aStats          A pointer to return the statistics.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the statistics.
+ * @retval OT_ERROR_INVALID_ARGS  @p aChannel is not a valid channel.
+ */
+otError otChannelMonitorGetChannelStats(otInstance *aInstance, uint8_t aChannel, otChannelMonitorChannelStats *aStats);
+
 /**
  * @}
  */
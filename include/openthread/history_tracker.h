@@ -158,6 +158,24 @@ typedef struct otHistoryTrackerMessageInfo
     bool       mRadioTrelUdp6 : 1;   ///< Indicates whether msg was sent/received over a TREL radio link.
 } otHistoryTrackerMessageInfo;
 
+/**
+ * Represents an aggregated RX/TX IPv6 flow info.
+ *
+ * A flow entry aggregates all RX or TX messages with the same source and destination (address and port), IP protocol
+ * and neighbor within one time bucket. The entry age is the age of the first message of the flow in its bucket.
+ */
+typedef struct otHistoryTrackerFlowInfo
+{
+    otSockAddr mSource;         ///< Source IPv6 address and port (if UDP/TCP).
+    otSockAddr mDestination;    ///< Destination IPv6 address and port (if UDP/TCP).
+    uint32_t   mMessageCount;   ///< Number of messages.
+    uint32_t   mByteCount;      ///< Total length of the messages in bytes (including IPv6 header).
+    uint32_t   mTxFailureCount; ///< Number of failed TX messages. Applicable for TX flow only.
+    uint16_t   mNeighborRloc16; ///< RLOC16 of neighbor which sent/received the msgs (`0xfffe` if no RLOC16).
+    uint8_t    mIpProto;        ///< IP Protocol number (`OT_IP6_PROTO_*` enumeration).
+    bool       mIsTx;           ///< Indicates whether the flow is TX (TRUE) or RX (FALSE).
+} otHistoryTrackerFlowInfo;
+
 /**
  * Defines the events in a neighbor info (i.e. whether neighbor is added, removed, or changed).
  *
@@ -465,6 +483,24 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
                                                                     otHistoryTrackerIterator *aIterator,
                                                                     uint32_t                 *aEntryAge);
 
+/**
+ * Iterates over the entries in the aggregated RX/TX flow history list.
+ *
+ * Requires `OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE` to be non-zero, otherwise no entry is returned.
+ *
+ * @param[in]     aInstance  A pointer to the OpenThread instance.
+ * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
+ *                           Age is provided as the duration (in milliseconds) from the first message of the flow in
+ *                           its time bucket to @p aIterator initialization time. It is set to
+ *                           `OT_HISTORY_TRACKER_MAX_AGE` for entries older than max age.
+ *
+ * @returns The `otHistoryTrackerFlowInfo` entry or `NULL` if no more entries in the list.
+ */
+const otHistoryTrackerFlowInfo *otHistoryTrackerIterateFlowHistory(otInstance               *aInstance,
+                                                                  otHistoryTrackerIterator *aIterator,
+                                                                  uint32_t                 *aEntryAge);
+
 /**
  * Iterates over the entries in the neighbor history list.
  *
@@ -272,6 +272,51 @@ otError otLinkMetricsManagerGetMetricsValueByExtAddr(otInstance          *aInsta
                                                      const otExtAddress  *aExtAddress,
                                                      otLinkMetricsValues *aLinkMetricsValues);
 
+/**
+ * Represents the overhead of the Link Metrics Manager collection.
+ *
+ * The link metrics themselves are reported in Enhanced-ACK IEs on ACKs of frames that are sent anyway, so only the
+ * Link Metrics Management Requests and Responses used to (re)configure the subjects are extra frames.
+ */
+typedef struct otLinkMetricsManagerOverhead
+{
+    uint32_t mMgmtRequests;    ///< Number of Link Metrics Management Requests sent.
+    uint32_t mMgmtResponses;   ///< Number of Link Metrics Management Responses received.
+    uint32_t mEnhAckReports;   ///< Number of link metrics reports received in Enhanced-ACKs.
+    uint32_t mDuration;        ///< Collection duration in milliseconds (since the manager started).
+    uint32_t mFramesPerMinute; ///< Average number of extra frames (requests and responses) per minute.
+} otLinkMetricsManagerOverhead;
+
+/**
+ * Gets the collection overhead of Link Metrics Manager.
+ *
+ * The counters are reset when Link Metrics Manager starts (i.e., when it is enabled and the device is attached).
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[out] aOverhead   A pointer to return the overhead information.
+ */
+void otLinkMetricsManagerGetOverhead(otInstance *aInstance, otLinkMetricsManagerOverhead *aOverhead);
+
+/**
+ * Sets the maximum number of Link Metrics Management Requests that Link Metrics Manager sends per batch slot.
+ *
+ * When non-zero, the subjects needing (re)configuration are queued and served a batch at a time, spreading the MLE
+ * traffic on devices with many neighbors. Zero disables batching (all requests are sent at once).
+ *
+ * @param[in] aInstance       A pointer to an OpenThread instance.
+ * @param[in] aBatchSize      The maximum number of requests per batch slot, or zero to disable batching.
+ */
+void otLinkMetricsManagerSetBatchSize(otInstance *aInstance, uint8_t aBatchSize);
+
+/**
+ * Gets the maximum number of Link Metrics Management Requests that Link Metrics Manager sends per batch slot.
+ *
+ * @param[in] aInstance       A pointer to an OpenThread instance.
+ *
+ * @returns The batch size, or zero if batching is disabled.
+ */
+uint8_t otLinkMetricsManagerGetBatchSize(otInstance *aInstance);
+
 /**
  * @}
  */
@@ -108,6 +108,11 @@ typedef otNetworkDiagTlv otMeshDiagTlvInfo;
  */
 #define OT_MESH_DIAG_VERSION_UNKNOWN 0xffff
 
+/**
+ * Specifies the largest value accepted by `otMeshDiagSetDiscoverMaxRetries()`.
+ */
+#define OT_MESH_DIAG_MAX_DISCOVER_RETRIES 10
+
 /**
  * Represents information about a router in Thread mesh discovered using `otMeshDiagDiscoverTopology()`.
  */
@@ -184,9 +189,14 @@ typedef struct otMeshDiagChildInfo
  * When @p aError is `OT_ERROR_PENDING`, it indicates that the discovery is not yet finished and there will be more
  * routers to discover and the callback will be invoked again.
  *
+ * When @p aError is `OT_ERROR_RESPONSE_TIMEOUT`, the discovery is finished but one or more routers did not respond.
+ * If the last router to respond finished the discovery, @p aRouterInfo provides that router's info. If a timeout
+ * finished the discovery, @p aRouterInfo is null.
+ *
  * @param[in] aError       OT_ERROR_PENDING            Indicates there are more routers to be discovered.
  *                         OT_ERROR_NONE               Indicates this is the last router and mesh discovery is done.
- *                         OT_ERROR_RESPONSE_TIMEOUT   Timed out waiting for response from one or more routers.
+ *                         OT_ERROR_RESPONSE_TIMEOUT   Mesh discovery is done, but timed out waiting for response from
+ *                                                     one or more routers.
  * @param[in] aRouterInfo  The discovered router info (can be null if `aError` is OT_ERROR_RESPONSE_TIMEOUT).
  * @param[in] aContext     Application-specific context.
  */
@@ -197,6 +207,11 @@ typedef void (*otMeshDiagDiscoverCallback)(otError aError, otMeshDiagRouterInfo
  *
  * This function initiates a query to discover routers in the Thread network.
  *
+ * Routers are queried in parallel, with at most `otMeshDiagGetDiscoverConcurrency()` outstanding queries at a time.
+ * A query that is not answered within the response timeout is re-sent up to `otMeshDiagGetDiscoverMaxRetries()`
+ * times. Once all routers are discovered (or given up on), the statistics of the discovery can be retrieved using
+ * `otMeshDiagGetDiscoverStats()`.
+ *
  * The @p aConfig configuration controls what optional topology information is discovered:
  * - If `mDiscoverIp6Addresses` is set to true, the list of IPv6 addresses for each router is discovered.
  * - If `mDiscoverChildTable` is set to true, the list of children for each router is discovered.
@@ -244,6 +259,87 @@ otError otMeshDiagDiscoverTopology(otInstance                     *aInstance,
                                    otMeshDiagDiscoverCallback      aCallback,
                                    void                           *aContext);
 
+/**
+ * Represents the statistics and topology summary of a mesh topology discovery.
+ *
+ * The counters are reset when `otMeshDiagDiscoverTopology()` starts a new discovery and are updated as responses are
+ * received or queries time out.
+ *
+ * Only aggregated counts are kept. The full per-router information (link qualities, IPv6 addresses, children) is
+ * provided to the caller through `otMeshDiagDiscoverCallback` as each response arrives. Keeping a copy of it for every
+ * router (up to 63 link quality arrays plus child tables) would need several KB of RAM in the stack at all times.
+ */
+typedef struct otMeshDiagDiscoverStats
+{
+    uint8_t  mNumTargets;      ///< Number of routers targeted by the discovery.
+    uint8_t  mNumResponses;    ///< Number of routers that responded.
+    uint8_t  mNumFailures;     ///< Number of routers that did not respond after all retries.
+    uint8_t  mMaxInFlight;     ///< Largest number of outstanding queries at any time.
+    uint16_t mNumQueries;      ///< Number of queries sent (including retries).
+    uint16_t mNumRetries;      ///< Number of queries re-sent after a response timeout.
+    uint16_t mNumRouterLinks;  ///< Number of router-to-router links reported by responding routers.
+    uint16_t mNumChildren;     ///< Number of children reported (only when `mDiscoverChildTable` is used).
+    uint32_t mDuration;        ///< Elapsed discovery time in milliseconds.
+    uint32_t mMinResponseTime; ///< Shortest response time in milliseconds (zero if no response).
+    uint32_t mMaxResponseTime; ///< Longest response time in milliseconds (zero if no response).
+    uint32_t mAvgResponseTime; ///< Average response time in milliseconds (zero if no response).
+} otMeshDiagDiscoverStats;
+
+/**
+ * Gets the statistics of the ongoing or the most recent topology discovery.
+ *
+ * @param[in] aInstance  The OpenThread instance.
+ *
+ * @returns A pointer to the discovery statistics.
+ */
+const otMeshDiagDiscoverStats *otMeshDiagGetDiscoverStats(otInstance *aInstance);
+
+/**
+ * Sets the maximum number of routers queried concurrently during topology discovery.
+ *
+ * The default value is specified by `OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_CONCURRENCY` configuration. The provided
+ * @p aConcurrency is clamped to stay between 1 and the maximum number of routers.
+ *
+ * Changing the concurrency does not impact an ongoing discovery.
+ *
+ * @param[in] aInstance     The OpenThread instance.
+ * @param[in] aConcurrency  The maximum number of outstanding queries.
+ */
+void otMeshDiagSetDiscoverConcurrency(otInstance *aInstance, uint8_t aConcurrency);
+
+/**
+ * Gets the maximum number of routers queried concurrently during topology discovery.
+ *
+ * @param[in] aInstance  The OpenThread instance.
+ *
+ * @returns The maximum number of outstanding queries.
+ */
+uint8_t otMeshDiagGetDiscoverConcurrency(otInstance *aInstance);
+
+/**
+ * Sets the maximum number of times a query to a router is re-sent during topology discovery.
+ *
+ * A query is re-sent when no response is received from the router within the response timeout (see
+ * `otMeshDiagSetResponseTimeout()`). The default value is specified by
+ * `OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_MAX_RETRIES` configuration. The provided @p aMaxRetries is clamped to stay
+ * at or below `OT_MESH_DIAG_MAX_DISCOVER_RETRIES`.
+ *
+ * Changing the max retries does not impact an ongoing discovery.
+ *
+ * @param[in] aInstance    The OpenThread instance.
+ * @param[in] aMaxRetries  The maximum number of retries per router.
+ */
+void otMeshDiagSetDiscoverMaxRetries(otInstance *aInstance, uint8_t aMaxRetries);
+
+/**
+ * Gets the maximum number of times a query to a router is re-sent during topology discovery.
+ *
+ * @param[in] aInstance  The OpenThread instance.
+ *
+ * @returns The maximum number of retries per router.
+ */
+uint8_t otMeshDiagGetDiscoverMaxRetries(otInstance *aInstance);
+
 /**
  * Cancels an ongoing topology discovery if there is one, otherwise no action.
  *
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the platform abstraction for persistent History Tracker storage.
+ */
+
+#ifndef OPENTHREAD_PLATFORM_HISTORY_TRACKER_H_
+#define OPENTHREAD_PLATFORM_HISTORY_TRACKER_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-history-tracker
+ *
+ * @brief
+ *   This module includes the platform abstraction for persistent History Tracker storage.
+ *
+ *   Requires `OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE`.
+ *
+ * @{
+ */
+
+/**
+ * Represents the History Tracker list an entry belongs to.
+ *
+ * The value determines the type of the entry passed to `otPlatHistoryTrackerSaveEntry()`.
+ */
+typedef enum otPlatHistoryTrackerList
+{
+    OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO           = 0,  ///< `otHistoryTrackerNetworkInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_UNICAST_ADDRESS    = 1,  ///< `otHistoryTrackerUnicastAddressInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_MULTICAST_ADDRESS  = 2,  ///< `otHistoryTrackerMulticastAddressInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_RX                 = 3,  ///< `otHistoryTrackerMessageInfo` (RX).
+    OT_PLAT_HISTORY_TRACKER_LIST_TX                 = 4,  ///< `otHistoryTrackerMessageInfo` (TX).
+    OT_PLAT_HISTORY_TRACKER_LIST_NEIGHBOR           = 5,  ///< `otHistoryTrackerNeighborInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_ROUTER             = 6,  ///< `otHistoryTrackerRouterInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_ON_MESH_PREFIX     = 7,  ///< `otHistoryTrackerOnMeshPrefixInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_EXTERNAL_ROUTE     = 8,  ///< `otHistoryTrackerExternalRouteInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_DNS_SRP_ADDR       = 9,  ///< `otHistoryTrackerDnsSrpAddrInfo`.
+    OT_PLAT_HISTORY_TRACKER_LIST_EPSKC_EVENT        = 10, ///< `otHistoryTrackerBorderAgentEpskcEvent`.
+    OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_OMR_PREFIX = 11, ///< `otHistoryTrackerFavoredOmrPrefix`.
+    OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_ON_LINK    = 12, ///< `otHistoryTrackerFavoredOnLinkPrefix`.
+    OT_PLAT_HISTORY_TRACKER_LIST_AIL_ROUTER         = 13, ///< `otHistoryTrackerAilRouter`.
+    OT_PLAT_HISTORY_TRACKER_LIST_DHCP6_PD           = 14, ///< `otHistoryTrackerDhcp6PdInfo`.
+} otPlatHistoryTrackerList;
+
+/**
+ * Saves a new History Tracker entry to the platform storage.
+ *
+ * Entries of all lists are passed in the order they were recorded. An entry is passed once it is fully populated,
+ * either from a tasklet shortly after it was recorded or right before an entry of another list is recorded.
+ *
+ * @p aSequence starts from zero when the OpenThread instance is initialized and increases by one for every recorded
+ * entry. A gap in @p aSequence indicates entries that were overwritten in the in-RAM history list before they could be
+ * passed.
+ *
+ * @param[in] aInstance  The OpenThread instance structure.
+ * @param[in] aList      The list the entry belongs to.
+ * @param[in] aSequence  The sequence number of the entry.
+ * @param[in] aAge       The time in milliseconds since the entry was recorded.
+ * @param[in] aEntry     A pointer to the entry (its type is determined by @p aList).
+ * @param[in] aLength    The length of the entry in bytes.
+ */
+void otPlatHistoryTrackerSaveEntry(otInstance              *aInstance,
+                                   otPlatHistoryTrackerList aList,
+                                   uint32_t                 aSequence,
+                                   uint32_t                 aAge,
+                                   const void              *aEntry,
+                                   uint16_t                 aLength);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_PLATFORM_HISTORY_TRACKER_H_
@@ -222,7 +222,7 @@ typedef void (*otTcpDisconnected)(otTcpEndpoint *aEndpoint, otTcpDisconnectedRea
  * opaque in its declaration, is treated as struct tcpcb in the TCP
  * implementation.
  */
-#define OT_TCP_ENDPOINT_TCB_SIZE_BASE 392
+#define OT_TCP_ENDPOINT_TCB_SIZE_BASE 416
 #define OT_TCP_ENDPOINT_TCB_NUM_PTR 36
 
 /**
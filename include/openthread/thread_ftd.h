@@ -928,6 +928,35 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
                                    uint16_t   *aNextHopRloc16,
                                    uint8_t    *aPathCost);
 
+/**
+ * Represents the counters for route updates from received MLE Advertisements.
+ *
+ * Route updates are coalesced and applied together in a single route recomputation. The number of merged updates
+ * (which did not require their own recomputation) is given by `mScheduled - mRecomputations`.
+ */
+typedef struct otRouteUpdateCounters
+{
+    uint32_t mScheduled;      ///< Number of scheduled route updates.
+    uint32_t mReplaced;       ///< Number of pending route updates replaced by a newer one from same neighbor.
+    uint32_t mRecomputations; ///< Number of route recomputations processing the pending route updates.
+} otRouteUpdateCounters;
+
+/**
+ * Gets the route update counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the route update counters.
+ */
+const otRouteUpdateCounters *otThreadGetRouteUpdateCounters(otInstance *aInstance);
+
+/**
+ * Resets the route update counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otThreadResetRouteUpdateCounters(otInstance *aInstance);
+
 /**
  * @}
  */
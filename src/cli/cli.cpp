@@ -1450,6 +1450,57 @@ template <> otError Interpreter::Process<Cmd("channel")>(Arg aArgs[])
         {
             error = otChannelMonitorSetEnabled(GetInstancePtr(), false);
         }
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+        /**
+         * @cli channel monitor stats
+         * @code
+         * channel monitor stats 15
+         * rssi-histogram: 1520 12 4 0 0 0 0 0
+         * rssi-median: -96
+         * rssi-p90: -96
+         * busy-ratios: 1.12% 0.00% 3.37%
+         * busy-median: 1.12%
+         * busy-p90: 3.37%
+         * Done
+         * @endcode
+         * @cparam channel monitor stats @ca{channel}
+         * @par
+         * Get the detailed statistics of a channel: RSSI histogram, busy ratio per time bucket (newest first), and
+         * their percentiles.
+         * `OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE` is required.
+         * @sa otChannelMonitorGetChannelStats
+         */
+        else if (aArgs[1] == "stats")
+        {
+            uint8_t                      channel;
+            otChannelMonitorChannelStats stats;
+            PercentageStringBuffer       stringBuffer;
+
+            SuccessOrExit(error = aArgs[2].ParseAsUint8(channel));
+            SuccessOrExit(error = otChannelMonitorGetChannelStats(GetInstancePtr(), channel, &stats));
+
+            OutputFormat("rssi-histogram:");
+
+            for (uint16_t count : stats.mRssiHistogram)
+            {
+                OutputFormat(" %u", count);
+            }
+
+            OutputNewLine();
+            OutputLine("rssi-median: %d", stats.mRssiMedian);
+            OutputLine("rssi-p90: %d", stats.mRssiP90);
+            OutputFormat("busy-ratios:");
+
+            for (uint8_t i = 0; i < stats.mNumTimeBuckets; i++)
+            {
+                OutputFormat(" %s%%", PercentageToString(stats.mBusyRatios[i], stringBuffer));
+            }
+
+            OutputNewLine();
+            OutputLine("busy-median: %s%%", PercentageToString(stats.mBusyRatioMedian, stringBuffer));
+            OutputLine("busy-p90: %s%%", PercentageToString(stats.mBusyRatioP90, stringBuffer));
+        }
+#endif
         else
         {
             ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -2190,6 +2241,7 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
      * ip
      * mac
      * mle
+     * route
      * Done
      * @endcode
      * @par
@@ -2203,6 +2255,9 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
         OutputLine("ip");
         OutputLine("mac");
         OutputLine("mle");
+#if OPENTHREAD_FTD
+        OutputLine("route");
+#endif
     }
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     /**
@@ -2520,6 +2575,65 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
             error = OT_ERROR_INVALID_ARGS;
         }
     }
+#if OPENTHREAD_FTD
+    /**
+     * @cli counters route
+     * @code
+     * counters route
+     * Scheduled: 42
+     * Replaced: 7
+     * Recomputations: 12
+     * Done
+     * @endcode
+     * @cparam counters @ca{route}
+     * @par
+     * Gets the counters for route updates from received MLE Advertisements. Route updates are coalesced, so the
+     * number of merged updates is `Scheduled - Recomputations`.
+     * @sa otThreadGetRouteUpdateCounters
+     */
+    else if (aArgs[0] == "route")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            struct RouteCounterName
+            {
+                const uint32_t otRouteUpdateCounters::*mValuePtr;
+                const char                            *mName;
+            };
+
+            static const RouteCounterName kCounterNames[] = {
+                {&otRouteUpdateCounters::mScheduled, "Scheduled"},
+                {&otRouteUpdateCounters::mReplaced, "Replaced"},
+                {&otRouteUpdateCounters::mRecomputations, "Recomputations"},
+            };
+
+            const otRouteUpdateCounters *routeCounters = otThreadGetRouteUpdateCounters(GetInstancePtr());
+
+            for (const RouteCounterName &counter : kCounterNames)
+            {
+                OutputLine("%s: %lu", counter.mName, ToUlong(routeCounters->*counter.mValuePtr));
+            }
+        }
+        /**
+         * @cli counters route reset
+         * @code
+         * counters route reset
+         * Done
+         * @endcode
+         * @cparam counters @ca{route} reset
+         * @par api_copy
+         * #otThreadResetRouteUpdateCounters
+         */
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otThreadResetRouteUpdateCounters(GetInstancePtr());
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+#endif // OPENTHREAD_FTD
     else
     {
         error = OT_ERROR_INVALID_ARGS;
@@ -3935,6 +4049,47 @@ template <> otError Interpreter::Process<Cmd("linkmetricsmgr")>(Arg aArgs[])
             OutputLine(", LinkMargin:%u, Rssi:%d", linkMetricsValues.mLinkMarginValue, linkMetricsValues.mRssiValue);
         }
     }
+    /**
+     * @cli linkmetricsmgr batch
+     * @code
+     * linkmetricsmgr batch
+     * 0
+     * Done
+     * @endcode
+     * @code
+     * linkmetricsmgr batch 4
+     * Done
+     * @endcode
+     * @cparam linkmetricsmgr batch [@ca{size}]
+     * @par
+     * Gets or sets the maximum number of Link Metrics Management Requests sent per batch slot. Zero disables
+     * batching.
+     * @sa otLinkMetricsManagerGetBatchSize
+     * @sa otLinkMetricsManagerSetBatchSize
+     */
+    else if (aArgs[0] == "batch")
+    {
+        error = ProcessGetSet(aArgs + 1, otLinkMetricsManagerGetBatchSize, otLinkMetricsManagerSetBatchSize);
+    }
+    /**
+     * @cli linkmetricsmgr overhead
+     * @code
+     * linkmetricsmgr overhead
+     * MgmtRequests:12, MgmtResponses:12, EnhAckReports:3471, Duration:900000, FramesPerMinute:1
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otLinkMetricsManagerGetOverhead
+     */
+    else if (aArgs[0] == "overhead")
+    {
+        otLinkMetricsManagerOverhead overhead;
+
+        otLinkMetricsManagerGetOverhead(GetInstancePtr(), &overhead);
+        OutputLine("MgmtRequests:%lu, MgmtResponses:%lu, EnhAckReports:%lu, Duration:%lu, FramesPerMinute:%lu",
+                   ToUlong(overhead.mMgmtRequests), ToUlong(overhead.mMgmtResponses), ToUlong(overhead.mEnhAckReports),
+                   ToUlong(overhead.mDuration), ToUlong(overhead.mFramesPerMinute));
+    }
     else
     {
         error = OT_ERROR_INVALID_COMMAND;
@@ -6884,6 +7039,7 @@ template <> otError Interpreter::Process<Cmd("debug")>(Arg aArgs[])
 #endif
 #if OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ENABLE
         "linkmetricsmgr show",
+        "linkmetricsmgr overhead",
 #endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         "multiradio",
@@ -206,6 +206,8 @@ exit:
  * pskcCommissionerPetition: 0
  * mgmtActiveGet: 0
  * mgmtPendingGet: 0
+ * pskcFullHandshake: 0
+ * pskcResumedHandshake: 0
  * Done
  * @endcode
  * @par
@@ -250,6 +252,8 @@ void Ba::OutputBorderAgentCounters(const otBorderAgentCounters &aCounters)
         {&otBorderAgentCounters::mPskcCommissionerPetitions, "pskcCommissionerPetition"},
         {&otBorderAgentCounters::mMgmtActiveGets, "mgmtActiveGet"},
         {&otBorderAgentCounters::mMgmtPendingGets, "mgmtPendingGet"},
+        {&otBorderAgentCounters::mPskcFullHandshakes, "pskcFullHandshake"},
+        {&otBorderAgentCounters::mPskcResumedHandshakes, "pskcResumedHandshake"},
     };
 
     for (const CounterName &counter : kCounterNames)
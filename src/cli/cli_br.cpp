@@ -1067,6 +1067,69 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
+template <> otError Br::Process<Cmd("reachcache")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli br reachcache
+     * @code
+     * br reachcache
+     * Hits: 120
+     * Misses: 8
+     * Invalidations: 3
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otBorderRoutingGetReachabilityCacheCounters
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        struct CounterName
+        {
+            const uint32_t otBorderRoutingReachabilityCacheCounters::*mValuePtr;
+            const char                                               *mName;
+        };
+
+        static const CounterName kCounterNames[] = {
+            {&otBorderRoutingReachabilityCacheCounters::mHits, "Hits"},
+            {&otBorderRoutingReachabilityCacheCounters::mMisses, "Misses"},
+            {&otBorderRoutingReachabilityCacheCounters::mInvalidations, "Invalidations"},
+        };
+
+        const otBorderRoutingReachabilityCacheCounters *counters =
+            otBorderRoutingGetReachabilityCacheCounters(GetInstancePtr());
+
+        for (const CounterName &counter : kCounterNames)
+        {
+            OutputLine("%s: %lu", counter.mName, ToUlong(counters->*counter.mValuePtr));
+        }
+    }
+    /**
+     * @cli br reachcache reset
+     * @code
+     * br reachcache reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otBorderRoutingResetReachabilityCacheCounters
+     */
+    else if ((aArgs[0] == "reset") && aArgs[1].IsEmpty())
+    {
+        otBorderRoutingResetReachabilityCacheCounters(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
 template <> otError Br::Process<Cmd("rioprf")>(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -1230,8 +1293,11 @@ otError Br::Process(Arg aArgs[])
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_TRACK_PEER_BR_INFO_ENABLE
         CmdEntry("peers"),
 #endif
-        CmdEntry("prefixtable"), CmdEntry("raoptions"),        CmdEntry("rdnsstable"),   CmdEntry("rioprf"),
-        CmdEntry("routeprf"),    CmdEntry("routers"),          CmdEntry("state"),
+        CmdEntry("prefixtable"), CmdEntry("raoptions"),        CmdEntry("rdnsstable"),
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+        CmdEntry("reachcache"),
+#endif
+        CmdEntry("rioprf"),      CmdEntry("routeprf"),         CmdEntry("routers"),      CmdEntry("state"),
     };
 
 #undef CmdEntry
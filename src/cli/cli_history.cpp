@@ -1258,6 +1258,139 @@ void History::OutputRxTxEntryTableFormat(const otHistoryTrackerMessageInfo &aInf
     OutputLine("| %20s | dst: %-70s |", "", addrString);
 }
 
+/**
+ * @cli history flow
+ * @code
+ * history flow
+ * | Age                  | Dir | Proto  | Msgs     | Bytes      | TX-F   | Neighb |
+ * +----------------------+-----+--------+----------+------------+--------+--------+
+ * |                      | TX  | ICMP6  |        3 |        144 |      0 | 0x4801 |
+ * |         00:00:11.204 | src: [fdde:ad00:beef:0:dc0e:d6b3:f180:b75b]:0          |
+ * |                      | dst: [fdde:ad00:beef:0:ac09:a16b:3204:dc09]:0          |
+ * +----------------------+-----+--------+----------+------------+--------+--------+
+ * |                      | RX  | UDP    |       12 |        960 |      0 | 0x4801 |
+ * |         00:01:05.811 | src: [fdde:ad00:beef:0:0:ff:fe00:4801]:49152           |
+ * |                      | dst: [fdde:ad00:beef:0:0:ff:fe00:4800]:1234            |
+ * Done
+ * @endcode
+ * @code
+ * history flow list
+ * 00:00:11.204 -> dir:TX proto:ICMP6 msgs:3 bytes:144 tx-fail:0 neighbor:0x4801
+ *     src:[fdde:ad00:beef:0:dc0e:d6b3:f180:b75b]:0
+ *     dst:[fdde:ad00:beef:0:ac09:a16b:3204:dc09]:0
+ * 00:01:05.811 -> dir:RX proto:UDP msgs:12 bytes:960 tx-fail:0 neighbor:0x4801
+ *     src:[fdde:ad00:beef:0:0:ff:fe00:4801]:49152
+ *     dst:[fdde:ad00:beef:0:0:ff:fe00:4800]:1234
+ * Done
+ * @endcode
+ * @cparam history flow [@ca{list}] [@ca{num-entries}]
+ * * Use the `list` option to display the output in list format. Otherwise,
+ *   the output is shown in table format.
+ * * Use the `num-entries` option to limit the output to the number of
+ *   most-recent entries specified. If this option is not used, all stored
+ *   entries are shown in the output.
+ * @par
+ * Displays the aggregated IPv6 RX/TX flow history in table or list format.
+ * @par
+ * Messages with the same source and destination socket address, IP
+ * protocol, neighbor and direction are counted in a single entry per
+ * time bucket (`OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL`).
+ * Each table or list entry provides:
+ * * Age: Time elapsed since the first message of the flow in its bucket,
+ *        given in the format: `hours`:`minutes`:`seconds`.`milliseconds`
+ * * Dir: Shows whether the messages were sent (`TX`) or received (`RX`).
+ * * Proto: IPv6 protocol, such as `UDP`, `TCP`, or `ICMP6`.
+ * * Msgs: Number of messages.
+ * * Bytes: Total length of the messages, including the IPv6 header.
+ * * TX-F: Number of failed transmissions (always zero for `RX`).
+ * * Neighb: Short address (RLOC16) of the neighbor with whom the messages
+ *           were sent/received, `bcast` for broadcast or `unknwn` if not
+ *           available.
+ * * `src`: Source IPv6 address and port number.
+ * * `dst`: Destination IPv6 address and port number.
+ * @sa otHistoryTrackerIterateFlowHistory
+ */
+template <> otError History::Process<Cmd("flow")>(Arg aArgs[])
+{
+    static constexpr uint8_t kIndentSize = 4;
+
+    otError                         error;
+    bool                            isList;
+    uint16_t                        numEntries;
+    otHistoryTrackerIterator        iterator;
+    const otHistoryTrackerFlowInfo *info;
+    uint32_t                        entryAge;
+    char                            ageString[OT_HISTORY_TRACKER_ENTRY_AGE_STRING_SIZE];
+    char                            addrString[OT_IP6_SOCK_ADDR_STRING_SIZE];
+
+    // | Age                  | Dir | Proto  | Msgs     | Bytes      | TX-F   | Neighb |
+    // +----------------------+-----+--------+----------+------------+--------+--------+
+
+    static const char *const kFlowTitles[] = {"Age", "Dir", "Proto", "Msgs", "Bytes", "TX-F", "Neighb"};
+
+    static const uint8_t kFlowColumnWidths[] = {22, 5, 8, 10, 12, 8, 8};
+
+    SuccessOrExit(error = ParseArgs(aArgs, isList, numEntries));
+
+    if (!isList)
+    {
+        OutputTableHeader(kFlowTitles, kFlowColumnWidths);
+    }
+
+    otHistoryTrackerInitIterator(&iterator);
+
+    for (uint16_t index = 0; (numEntries == 0) || (index < numEntries); index++)
+    {
+        info = otHistoryTrackerIterateFlowHistory(GetInstancePtr(), &iterator, &entryAge);
+        VerifyOrExit(info != nullptr);
+
+        otHistoryTrackerEntryAgeToString(entryAge, ageString, sizeof(ageString));
+
+        if (isList)
+        {
+            OutputLine("%s -> dir:%s proto:%s msgs:%lu bytes:%lu tx-fail:%lu neighbor:0x%04x", ageString,
+                       info->mIsTx ? "TX" : "RX", otIp6ProtoToString(info->mIpProto), ToUlong(info->mMessageCount),
+                       ToUlong(info->mByteCount), ToUlong(info->mTxFailureCount), info->mNeighborRloc16);
+            OutputFormat(kIndentSize, "src:");
+            OutputSockAddrLine(info->mSource);
+            OutputFormat(kIndentSize, "dst:");
+            OutputSockAddrLine(info->mDestination);
+            continue;
+        }
+
+        if (index != 0)
+        {
+            OutputTableSeparator(kFlowColumnWidths);
+        }
+
+        OutputFormat("| %20s | %-3s | %-6.6s | %8lu | %10lu | %6lu ", "", info->mIsTx ? "TX" : "RX",
+                     otIp6ProtoToString(info->mIpProto), ToUlong(info->mMessageCount), ToUlong(info->mByteCount),
+                     ToUlong(info->mTxFailureCount));
+
+        if (info->mNeighborRloc16 == kShortAddrBroadcast)
+        {
+            OutputLine("| bcast  |");
+        }
+        else if (info->mNeighborRloc16 == kShortAddrInvalid)
+        {
+            OutputLine("| unknwn |");
+        }
+        else
+        {
+            OutputLine("| 0x%04x |", info->mNeighborRloc16);
+        }
+
+        otIp6SockAddrToString(&info->mSource, addrString, sizeof(addrString));
+        OutputLine("| %20s | src: %-49s |", ageString, addrString);
+
+        otIp6SockAddrToString(&info->mDestination, addrString, sizeof(addrString));
+        OutputLine("| %20s | dst: %-49s |", "", addrString);
+    }
+
+exit:
+    return error;
+}
+
 /**
  * @cli history prefix
  * @code
@@ -2038,8 +2171,8 @@ otError History::Process(Arg aArgs[])
         CmdEntry("dhcp6pd"),
 #endif
 #endif
-        CmdEntry("dnssrpaddr"), CmdEntry("ipaddr"),       CmdEntry("ipmaddr"),
-        CmdEntry("neighbor"),   CmdEntry("netinfo"),
+        CmdEntry("dnssrpaddr"), CmdEntry("flow"),         CmdEntry("ipaddr"),
+        CmdEntry("ipmaddr"),    CmdEntry("neighbor"),     CmdEntry("netinfo"),
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
         CmdEntry("omrprefix"),  CmdEntry("onlinkprefix"),
 #endif
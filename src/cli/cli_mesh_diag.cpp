@@ -72,6 +72,98 @@ template <> otError MeshDiag::Process<Cmd("responsetimeout")>(Arg aArgs[])
     return ProcessGetSet(aArgs, otMeshDiagGetResponseTimeout, otMeshDiagSetResponseTimeout);
 }
 
+/** @cli meshdiag concurrency
+ * @code
+ * meshdiag concurrency
+ * 8
+ * Done
+ * @endcode
+ * @par api_copy
+ * #otMeshDiagGetDiscoverConcurrency
+ */
+template <> otError MeshDiag::Process<Cmd("concurrency")>(Arg aArgs[])
+{
+    /** @cli meshdiag concurrency (set)
+     * @code
+     * meshdiag concurrency 4
+     * Done
+     * @endcode
+     * @cparam meshdiag concurrency @ca{max-queries}
+     * @par api_copy
+     * #otMeshDiagSetDiscoverConcurrency
+     */
+    return ProcessGetSet(aArgs, otMeshDiagGetDiscoverConcurrency, otMeshDiagSetDiscoverConcurrency);
+}
+
+/** @cli meshdiag retries
+ * @code
+ * meshdiag retries
+ * 1
+ * Done
+ * @endcode
+ * @par api_copy
+ * #otMeshDiagGetDiscoverMaxRetries
+ */
+template <> otError MeshDiag::Process<Cmd("retries")>(Arg aArgs[])
+{
+    /** @cli meshdiag retries (set)
+     * @code
+     * meshdiag retries 2
+     * Done
+     * @endcode
+     * @cparam meshdiag retries @ca{max-retries}
+     * @par api_copy
+     * #otMeshDiagSetDiscoverMaxRetries
+     */
+    return ProcessGetSet(aArgs, otMeshDiagGetDiscoverMaxRetries, otMeshDiagSetDiscoverMaxRetries);
+}
+
+/**
+ * @cli meshdiag stats
+ * @code
+ * meshdiag stats
+ * Targets: 5
+ * Responses: 5
+ * Failures: 0
+ * Queries: 6
+ * Retries: 1
+ * MaxInFlight: 4
+ * RouterLinks: 12
+ * Children: 7
+ * Duration: 3154
+ * ResponseTime - min:210 max:2811 ave:640
+ * Done
+ * @endcode
+ * @par
+ * Prints the statistics of the ongoing or the most recent topology discovery. Durations and response times are in
+ * milliseconds. `Children` is only counted when discovering with `children`.
+ * @sa otMeshDiagGetDiscoverStats
+ */
+template <> otError MeshDiag::Process<Cmd("stats")>(Arg aArgs[])
+{
+    otError                        error = OT_ERROR_NONE;
+    const otMeshDiagDiscoverStats *stats;
+
+    VerifyOrExit(aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    stats = otMeshDiagGetDiscoverStats(GetInstancePtr());
+
+    OutputLine("Targets: %u", stats->mNumTargets);
+    OutputLine("Responses: %u", stats->mNumResponses);
+    OutputLine("Failures: %u", stats->mNumFailures);
+    OutputLine("Queries: %u", stats->mNumQueries);
+    OutputLine("Retries: %u", stats->mNumRetries);
+    OutputLine("MaxInFlight: %u", stats->mMaxInFlight);
+    OutputLine("RouterLinks: %u", stats->mNumRouterLinks);
+    OutputLine("Children: %u", stats->mNumChildren);
+    OutputLine("Duration: %lu", ToUlong(stats->mDuration));
+    OutputLine("ResponseTime - min:%lu max:%lu ave:%lu", ToUlong(stats->mMinResponseTime),
+               ToUlong(stats->mMaxResponseTime), ToUlong(stats->mAvgResponseTime));
+
+exit:
+    return error;
+}
+
 template <> otError MeshDiag::Process<Cmd("topology")>(Arg aArgs[])
 {
     /**
@@ -295,8 +387,9 @@ otError MeshDiag::Process(Arg aArgs[])
 #define CmdEntry(aCommandString) {aCommandString, &MeshDiag::Process<Cmd(aCommandString)>}
 
     static constexpr Command kCommands[] = {
-        CmdEntry("childip6"), CmdEntry("childtable"), CmdEntry("responsetimeout"), CmdEntry("routerneighbortable"),
-        CmdEntry("topology"),
+        CmdEntry("childip6"),        CmdEntry("childtable"),          CmdEntry("concurrency"),
+        CmdEntry("responsetimeout"), CmdEntry("retries"),             CmdEntry("routerneighbortable"),
+        CmdEntry("stats"),           CmdEntry("topology"),
     };
 
     static_assert(BinarySearch::IsSorted(kCommands), "kCommands is not sorted");
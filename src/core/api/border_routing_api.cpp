@@ -326,6 +326,20 @@ void otBorderRoutingDhcp6PdSetRequestCallback(otInstance
 
 #endif
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
+const otBorderRoutingReachabilityCacheCounters *otBorderRoutingGetReachabilityCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<BorderRouter::RoutingManager>().GetReachabilityCacheCounters();
+}
+
+void otBorderRoutingResetReachabilityCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<BorderRouter::RoutingManager>().ResetReachabilityCacheCounters();
+}
+
+#endif
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_TESTING_API_ENABLE
 
 void otBorderRoutingSetOnLinkPrefix(otInstance *aInstance, const otIp6Prefix *aPrefix)
@@ -85,4 +85,13 @@ uint16_t otChannelMonitorGetChannelOccupancy(otInstance *aInstance, uint8_t aCha
     return AsCoreType(aInstance).Get<Utils::ChannelMonitor>().GetChannelOccupancy(aChannel);
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+otError otChannelMonitorGetChannelStats(otInstance *aInstance, uint8_t aChannel, otChannelMonitorChannelStats *aStats)
+{
+    AssertPointerIsNotNull(aStats);
+
+    return AsCoreType(aInstance).Get<Utils::ChannelMonitor>().GetChannelStats(aChannel, *aStats);
+}
+#endif
+
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
@@ -90,6 +90,15 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
     return AsCoreType(aInstance).Get<HistoryTracker::Local>().IterateTxHistory(AsCoreType(aIterator), *aEntryAge);
 }
 
+const otHistoryTrackerFlowInfo *otHistoryTrackerIterateFlowHistory(otInstance               *aInstance,
+                                                                  otHistoryTrackerIterator *aIterator,
+                                                                  uint32_t                 *aEntryAge)
+{
+    AssertPointerIsNotNull(aEntryAge);
+
+    return AsCoreType(aInstance).Get<HistoryTracker::Local>().IterateFlowHistory(AsCoreType(aIterator), *aEntryAge);
+}
+
 const otHistoryTrackerNeighborInfo *otHistoryTrackerIterateNeighborHistory(otInstance               *aInstance,
                                                                            otHistoryTrackerIterator *aIterator,
                                                                            uint32_t                 *aEntryAge)
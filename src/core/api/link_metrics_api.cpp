@@ -120,6 +120,23 @@ otError otLinkMetricsManagerGetMetricsValueByExtAddr(otInstance          *aInsta
 exit:
     return error;
 }
+
+void otLinkMetricsManagerGetOverhead(otInstance *aInstance, otLinkMetricsManagerOverhead *aOverhead)
+{
+    AssertPointerIsNotNull(aOverhead);
+
+    AsCoreType(aInstance).Get<Utils::LinkMetricsManager>().GetOverhead(*aOverhead);
+}
+
+void otLinkMetricsManagerSetBatchSize(otInstance *aInstance, uint8_t aBatchSize)
+{
+    AsCoreType(aInstance).Get<Utils::LinkMetricsManager>().SetBatchSize(aBatchSize);
+}
+
+uint8_t otLinkMetricsManagerGetBatchSize(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::LinkMetricsManager>().GetBatchSize();
+}
 #endif
 
 #endif // OPENTHREAD_CONFIG_MLE_LINK_METRICS_INITIATOR_ENABLE
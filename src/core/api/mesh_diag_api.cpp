@@ -48,6 +48,31 @@ otError otMeshDiagDiscoverTopology(otInstance                     *aInstance,
     return AsCoreType(aInstance).Get<Utils::MeshDiag>().DiscoverTopology(*aConfig, aCallback, aContext);
 }
 
+const otMeshDiagDiscoverStats *otMeshDiagGetDiscoverStats(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Utils::MeshDiag>().GetDiscoverStats();
+}
+
+void otMeshDiagSetDiscoverConcurrency(otInstance *aInstance, uint8_t aConcurrency)
+{
+    AsCoreType(aInstance).Get<Utils::MeshDiag>().SetDiscoverConcurrency(aConcurrency);
+}
+
+uint8_t otMeshDiagGetDiscoverConcurrency(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::MeshDiag>().GetDiscoverConcurrency();
+}
+
+void otMeshDiagSetDiscoverMaxRetries(otInstance *aInstance, uint8_t aMaxRetries)
+{
+    AsCoreType(aInstance).Get<Utils::MeshDiag>().SetDiscoverMaxRetries(aMaxRetries);
+}
+
+uint8_t otMeshDiagGetDiscoverMaxRetries(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::MeshDiag>().GetDiscoverMaxRetries();
+}
+
 void otMeshDiagCancel(otInstance *aInstance) { AsCoreType(aInstance).Get<Utils::MeshDiag>().Cancel(); }
 
 otError otMeshDiagGetNextIp6Address(otMeshDiagIp6AddrIterator *aIterator, otIp6Address *aIp6Address)
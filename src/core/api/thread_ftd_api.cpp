@@ -403,4 +403,14 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
         (aPathCost != nullptr) ? *aPathCost : pathcost);
 }
 
+const otRouteUpdateCounters *otThreadGetRouteUpdateCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<RouterTable>().GetRouteUpdateCounters();
+}
+
+void otThreadResetRouteUpdateCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<RouterTable>().ResetRouteUpdateCounters();
+}
+
 #endif // OPENTHREAD_FTD
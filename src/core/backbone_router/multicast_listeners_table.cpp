@@ -45,30 +45,47 @@ RegisterLogModule("BbrMlt");
 
 MulticastListenersTable::MulticastListenersTable(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mExpiryHeap(*this)
     , mTimer(aInstance)
 {
+    for (uint16_t &bucket : mBuckets)
+    {
+        bucket = kNone;
+    }
 }
 
 Error MulticastListenersTable::Add(const Ip6::Address &aAddress, Time aExpireTime)
 {
-    Error     error = kErrorNone;
-    bool      isNew = false;
-    Listener *entry;
+    Error    error = kErrorNone;
+    bool     isNew = false;
+    uint16_t index;
 
     VerifyOrExit(aAddress.IsMulticastLargerThanRealmLocal(), error = kErrorInvalidArgs);
 
-    entry = mListeners.FindMatching(aAddress);
+    index = Find(aAddress);
 
-    if (entry == nullptr)
+    if (index == kNone)
     {
+        Listener *entry;
+        uint16_t  bucket = GetBucket(aAddress);
+
+        index = mListeners.GetLength();
         entry = mListeners.PushBack();
+        VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
+
+        entry->mAddress      = aAddress;
+        entry->mExpireTime   = aExpireTime;
+        entry->mNextInBucket = mBuckets[bucket];
+        mBuckets[bucket]     = index;
+
         isNew = true;
     }
+    else
+    {
+        mListeners[index].mExpireTime = aExpireTime;
+    }
 
-    VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
-
-    entry->mAddress    = aAddress;
-    entry->mExpireTime = aExpireTime;
+    mExpiryHeap.Update(index);
 
     mTimer.FireAtIfEarlier(aExpireTime);
 
@@ -84,13 +101,13 @@ exit:
 
 void MulticastListenersTable::Remove(const Ip6::Address &aAddress)
 {
-    Error     error = kErrorNone;
-    Listener *entry;
+    Error    error = kErrorNone;
+    uint16_t index;
 
-    entry = mListeners.FindMatching(aAddress);
-    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+    index = Find(aAddress);
+    VerifyOrExit(index != kNone, error = kErrorNotFound);
 
-    mListeners.Remove(*entry);
+    RemoveAt(index);
 
     InvokeCallback(kEventRemoved, aAddress);
 
@@ -100,34 +117,110 @@ exit:
 
 void MulticastListenersTable::HandleTimer(void)
 {
-    TimeMilli    now = TimerMilli::GetNow();
-    NextFireTime nextTime(now);
+    TimeMilli now = TimerMilli::GetNow();
 
-    for (uint16_t i = 0; i < mListeners.GetLength();)
+    while (!mListeners.IsEmpty())
     {
-        if (mListeners[i].mExpireTime <= now)
-        {
-            Ip6::Address address = mListeners[i].mAddress;
+        uint16_t     index = mExpiryHeap.GetTop();
+        Ip6::Address address;
 
-            Log(kExpire, address, mListeners[i].mExpireTime, kErrorNone);
-            mListeners.Remove(mListeners[i]);
-            InvokeCallback(kEventRemoved, address);
-
-            // When the entry is removed from the array it is replaced
-            // with the last element. In this case, we do not
-            // increment `i`.
-        }
-        else
+        if (mListeners[index].mExpireTime > now)
         {
-            nextTime.UpdateIfEarlier(mListeners[i].mExpireTime);
-            i++;
+            mTimer.FireAt(mListeners[index].mExpireTime);
+            break;
         }
+
+        address = mListeners[index].mAddress;
+
+        Log(kExpire, address, mListeners[index].mExpireTime, kErrorNone);
+        RemoveAt(index);
+        InvokeCallback(kEventRemoved, address);
+    }
+}
+
+uint16_t MulticastListenersTable::Find(const Ip6::Address &aAddress) const
+{
+    uint16_t index = mBuckets[GetBucket(aAddress)];
+
+    while ((index != kNone) && !mListeners[index].Matches(aAddress))
+    {
+        index = mListeners[index].mNextInBucket;
     }
 
-    mTimer.FireAtIfEarlier(nextTime);
+    return index;
+}
+
+void MulticastListenersTable::RemoveAt(uint16_t aIndex)
+{
+    uint16_t lastIndex = mListeners.GetLength() - 1;
+
+    UnlinkFromBucket(aIndex);
+    mExpiryHeap.Remove(aIndex);
+
+    // `Array::Remove()` moves the last listener into the freed slot,
+    // so the bucket link and heap entry referring to it are updated
+    // first.
+
+    if (aIndex != lastIndex)
+    {
+        RelinkInBucket(lastIndex, aIndex);
+        mExpiryHeap.Renumber(lastIndex, aIndex);
+    }
+
+    mListeners.Remove(mListeners[aIndex]);
+}
+
+void MulticastListenersTable::UnlinkFromBucket(uint16_t aIndex)
+{
+    uint16_t *link = &mBuckets[GetBucket(mListeners[aIndex].mAddress)];
+
+    while (*link != aIndex)
+    {
+        link = &mListeners[*link].mNextInBucket;
+    }
+
+    *link = mListeners[aIndex].mNextInBucket;
+}
+
+void MulticastListenersTable::RelinkInBucket(uint16_t aOldIndex, uint16_t aNewIndex)
+{
+    uint16_t *link = &mBuckets[GetBucket(mListeners[aOldIndex].mAddress)];
+
+    while (*link != aOldIndex)
+    {
+        link = &mListeners[*link].mNextInBucket;
+    }
+
+    *link = aNewIndex;
+}
+
+bool MulticastListenersTable::IsExpireEarlier(uint16_t aIndexA, uint16_t aIndexB) const
+{
+    return mListeners[aIndexA].mExpireTime < mListeners[aIndexB].mExpireTime;
+}
+
+uint16_t MulticastListenersTable::GetBucket(const Ip6::Address &aAddress)
+{
+    // Folds the address into 32 bits and applies a multiplicative
+    // hash. Multicast groups often differ only in their trailing
+    // group ID bytes, which the multiplication spreads over the
+    // upper bits used to select the bucket.
+
+    static constexpr uint32_t kMultiplier = 2654435761u;
+
+    uint32_t hash = 0;
+
+    for (uint32_t word : aAddress.mFields.m32)
+    {
+        hash ^= word;
+    }
+
+    hash *= kMultiplier;
+
+    return static_cast<uint16_t>((hash >> 16) % kNumBuckets);
 }
 
-bool MulticastListenersTable::Has(const Ip6::Address &aAddress) const { return mListeners.ContainsMatching(aAddress); }
+bool MulticastListenersTable::Has(const Ip6::Address &aAddress) const { return Find(aAddress) != kNone; }
 
 void MulticastListenersTable::InvokeCallback(Event aEvent, const Ip6::Address &aAddress) const
 {
@@ -160,7 +253,7 @@ void MulticastListenersTable::Clear(void)
     {
         Ip6::Address address = mListeners.Back()->mAddress;
 
-        mListeners.PopBack();
+        RemoveAt(mListeners.GetLength() - 1);
         InvokeCallback(kEventRemoved, address);
     }
 
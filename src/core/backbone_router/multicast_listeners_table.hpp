@@ -43,7 +43,9 @@
 #include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/min_heap.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/notifier.hpp"
 #include "common/time.hpp"
 #include "common/timer.hpp"
@@ -51,6 +53,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 namespace BackboneRouter {
 
 /**
@@ -58,6 +62,8 @@ namespace BackboneRouter {
  */
 class MulticastListenersTable : public InstanceLocator, private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     typedef otBackboneRouterMulticastListenerCallback ListenerCallback; ///< Listener Callback.
     typedef otBackboneRouterMulticastListenerInfo     ListenerInfo;     ///< Listener info.
@@ -147,22 +153,43 @@ private:
         kExpire,
     };
 
+    // Listeners are stored densely in `mListeners` (which `GetNext()`
+    // iterates over). They are indexed by a chained hash on address
+    // (`mBuckets` and `mNextInBucket`) and ordered by expire time in
+    // the min-heap `mExpiryHeap`, which holds the listener indexes.
+
+    static constexpr uint16_t kNumBuckets = kTableSize;
+    static constexpr uint16_t kNone       = NumericLimits<uint16_t>::kMax;
+
+    static_assert(kTableSize < kNone, "kTableSize is too large");
+
     struct Listener
     {
         bool Matches(const Ip6::Address &aAddress) const { return mAddress == aAddress; }
 
         Ip6::Address mAddress;
         TimeMilli    mExpireTime;
+        uint16_t     mNextInBucket;
     };
 
-    void InvokeCallback(Event aEvent, const Ip6::Address &aAddress) const;
-    void HandleTimer(void);
-    void Log(Action aAction, const Ip6::Address &aAddress, TimeMilli aExpireTime, Error aError) const;
+    uint16_t Find(const Ip6::Address &aAddress) const;
+    void     RemoveAt(uint16_t aIndex);
+    void     UnlinkFromBucket(uint16_t aIndex);
+    void     RelinkInBucket(uint16_t aOldIndex, uint16_t aNewIndex);
+    bool     IsExpireEarlier(uint16_t aIndexA, uint16_t aIndexB) const;
+    void     InvokeCallback(Event aEvent, const Ip6::Address &aAddress) const;
+    void     HandleTimer(void);
+    void     Log(Action aAction, const Ip6::Address &aAddress, TimeMilli aExpireTime, Error aError) const;
+
+    static uint16_t GetBucket(const Ip6::Address &aAddress);
 
     using ListenerArray = Array<Listener, kTableSize, uint16_t>;
     using ExpireTimer   = TimerMilliIn<MulticastListenersTable, &MulticastListenersTable::HandleTimer>;
+    using ExpiryHeap    = MinHeap<MulticastListenersTable, kTableSize, &MulticastListenersTable::IsExpireEarlier>;
 
     ListenerArray              mListeners;
+    uint16_t                   mBuckets[kNumBuckets];
+    ExpiryHeap                 mExpiryHeap;
     ExpireTimer                mTimer;
     Callback<ListenerCallback> mCallback;
 };
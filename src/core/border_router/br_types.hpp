@@ -158,6 +158,20 @@ public:
      */
     bool IsStaleTimeCalculated(void) const { return mStaleTimeCalculated; }
 
+    /**
+     * Gets the next prefix entry in the same bucket of a prefix index.
+     *
+     * @returns The next prefix entry in the bucket, or `nullptr` if none.
+     */
+    LifetimedPrefix *GetNextInIndex(void) const { return mNextInIndex; }
+
+    /**
+     * Sets the next prefix entry in the same bucket of a prefix index.
+     *
+     * @param[in] aNext  The next prefix entry in the bucket, or `nullptr` if none.
+     */
+    void SetNextInIndex(LifetimedPrefix *aNext) { mNextInIndex = aNext; }
+
     /**
      * Sets the flag indicating that this prefix entry should be disregarded.
      *
@@ -190,11 +204,12 @@ protected:
 
     TimeMilli CalculateExpirationTime(uint32_t aLifetime) const;
 
-    Ip6::Prefix mPrefix;
-    bool        mDisregard : 1;
-    bool        mStaleTimeCalculated : 1;
-    uint32_t    mValidLifetime;
-    TimeMilli   mLastUpdateTime;
+    Ip6::Prefix      mPrefix;
+    bool             mDisregard : 1;
+    bool             mStaleTimeCalculated : 1;
+    uint32_t         mValidLifetime;
+    TimeMilli        mLastUpdateTime;
+    LifetimedPrefix *mNextInIndex;
 };
 
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -42,6 +42,7 @@
 #include <openthread/platform/infra_if.h>
 
 #include "border_router/br_log.hpp"
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -358,6 +359,13 @@ void RoutingManager::HandleNotifierEvents(Events aEvents)
         EvaluateState();
     }
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    if (aEvents.Contains(kEventThreadNetdataChanged))
+    {
+        InvalidateReachabilityCache();
+    }
+#endif
+
     if (mIsRunning && aEvents.Contains(kEventThreadNetdataChanged))
     {
         mOmrPrefixManager.HandleNetDataChange();
@@ -629,6 +637,9 @@ void RoutingManager::HandleLocalOnLinkPrefixChanged(void)
 
     VerifyOrExit(mIsRunning);
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    InvalidateReachabilityCache();
+#endif
     mRoutePublisher.Evaluate();
     Get<RxRaTracker>().HandleLocalOnLinkPrefixChanged();
     ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
@@ -663,15 +674,42 @@ bool RoutingManager::NetworkDataContainsUlaRoute(void) const
 
 void RoutingManager::CheckReachabilityToSendIcmpError(const Message &aMessage, const Ip6::Header &aIp6Header)
 {
-    bool                            matchesUlaOmrLowPrf = false;
-    NetworkData::Iterator           iterator            = NetworkData::kIteratorInit;
-    NetworkData::OnMeshPrefixConfig prefixConfig;
-    Ip6::MessageInfo                messageInfo;
+    bool             shouldSendError;
+    Ip6::MessageInfo messageInfo;
 
     VerifyOrExit(IsRunning() && IsInitialPolicyEvaluationDone());
 
     VerifyOrExit(!aIp6Header.GetDestination().IsMulticast());
 
+    if (!mReachabilityCache.Find(aIp6Header, shouldSendError))
+    {
+        shouldSendError = ShouldSendIcmpError(aIp6Header);
+        mReachabilityCache.Add(aIp6Header, shouldSendError);
+    }
+
+    VerifyOrExit(shouldSendError);
+
+    LogInfo("Send ICMP unreachable for fwd msg with local ULA src and non-local dst");
+    LogInfo("   src: %s", aIp6Header.GetSource().ToString().AsCString());
+    LogInfo("   dst: %s", aIp6Header.GetDestination().ToString().AsCString());
+
+    messageInfo.Clear();
+    messageInfo.SetPeerAddr(aIp6Header.GetSource());
+
+    IgnoreError(Get<Ip6::Icmp>().SendError(Ip6::Icmp6Header::kTypeDstUnreach,
+                                           Ip6::Icmp6Header::kCodeDstUnreachProhibited, messageInfo, aMessage));
+
+exit:
+    return;
+}
+
+bool RoutingManager::ShouldSendIcmpError(const Ip6::Header &aIp6Header) const
+{
+    bool                            shouldSend          = false;
+    bool                            matchesUlaOmrLowPrf = false;
+    NetworkData::Iterator           iterator            = NetworkData::kIteratorInit;
+    NetworkData::OnMeshPrefixConfig prefixConfig;
+
     // Validate that source matches a ULA OMR prefix with low preference
     // (indicating it is not infrastructure-derived).
 
@@ -699,18 +737,74 @@ void RoutingManager::CheckReachabilityToSendIcmpError(const Message &aMessage, c
     VerifyOrExit(!Get<RxRaTracker>().IsAddressReachableThroughExplicitRoute(aIp6Header.GetDestination()));
     VerifyOrExit(!Get<NetworkData::Leader>().IsNat64(aIp6Header.GetDestination()));
 
-    LogInfo("Send ICMP unreachable for fwd msg with local ULA src and non-local dst");
-    LogInfo("   src: %s", aIp6Header.GetSource().ToString().AsCString());
-    LogInfo("   dst: %s", aIp6Header.GetDestination().ToString().AsCString());
+    shouldSend = true;
 
-    messageInfo.Clear();
-    messageInfo.SetPeerAddr(aIp6Header.GetSource());
+exit:
+    return shouldSend;
+}
 
-    IgnoreError(Get<Ip6::Icmp>().SendError(Ip6::Icmp6Header::kTypeDstUnreach,
-                                           Ip6::Icmp6Header::kCodeDstUnreachProhibited, messageInfo, aMessage));
+//---------------------------------------------------------------------------------------------------------------------
+// ReachabilityCache
 
-exit:
-    return;
+RoutingManager::ReachabilityCache::ReachabilityCache(void)
+{
+    ClearAllBytes(mEntries);
+    mCounters.Clear();
+}
+
+void RoutingManager::ReachabilityCache::Invalidate(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.mValid = false;
+    }
+
+    mCounters.mInvalidations++;
+}
+
+bool RoutingManager::ReachabilityCache::Find(const Ip6::Header &aIp6Header, bool &aShouldSendError)
+{
+    const Entry &entry = mEntries[IndexFor(aIp6Header)];
+    bool         found = entry.Matches(aIp6Header);
+
+    if (found)
+    {
+        aShouldSendError = entry.mShouldSendError;
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
+    return found;
+}
+
+void RoutingManager::ReachabilityCache::Add(const Ip6::Header &aIp6Header, bool aShouldSendError)
+{
+    Entry &entry = mEntries[IndexFor(aIp6Header)];
+
+    entry.mSrcPrefix       = aIp6Header.GetSource().GetPrefix();
+    entry.mDstAddress      = aIp6Header.GetDestination();
+    entry.mValid           = true;
+    entry.mShouldSendError = aShouldSendError;
+}
+
+uint16_t RoutingManager::ReachabilityCache::IndexFor(const Ip6::Header &aIp6Header)
+{
+    // Hash over the source /64 prefix and the destination address.
+
+    Fnv1aHash hash;
+
+    hash.Feed(aIp6Header.GetSource().GetPrefix());
+    hash.Feed(aIp6Header.GetDestination());
+
+    return static_cast<uint16_t>(hash.GetHash() % kNumEntries);
+}
+
+bool RoutingManager::ReachabilityCache::Entry::Matches(const Ip6::Header &aIp6Header) const
+{
+    return mValid && (mDstAddress == aIp6Header.GetDestination()) && (mSrcPrefix == aIp6Header.GetSource().GetPrefix());
 }
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
@@ -1226,6 +1320,11 @@ void RoutingManager::OnLinkPrefixManager::SetState(State aState)
             mLocalPrefix.ToString().AsCString());
     mState = aState;
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    // `AddressMatchesLocalPrefix()` depends on the state.
+    Get<RoutingManager>().InvalidateReachabilityCache();
+#endif
+
     // Mark the Advertising PIO (AP) flag in the published route, when
     // the local on-link prefix is being published, advertised, or
     // deprecated.
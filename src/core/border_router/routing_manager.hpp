@@ -82,6 +82,9 @@
 #include "thread/network_data.hpp"
 
 namespace ot {
+
+class UnitTester;
+
 namespace BorderRouter {
 
 /**
@@ -94,6 +97,7 @@ class RoutingManager : public InstanceLocator
 {
     friend class ot::Notifier;
     friend class ot::Instance;
+    friend class ot::UnitTester;
     friend class NetDataBrTracker;
     friend class RxRaTracker;
 
@@ -543,6 +547,29 @@ public:
      * @param[in] aIp6Header  The IPv6 header of @p aMessage.
      */
     void CheckReachabilityToSendIcmpError(const Message &aMessage, const Ip6::Header &aIp6Header);
+
+    /**
+     * Represents the counters of the reachability check cache.
+     */
+    struct ReachabilityCacheCounters : public otBorderRoutingReachabilityCacheCounters,
+                                       public Clearable<ReachabilityCacheCounters>
+    {
+    };
+
+    /**
+     * Gets the reachability check cache counters.
+     *
+     * @returns The reachability check cache counters.
+     */
+    const ReachabilityCacheCounters &GetReachabilityCacheCounters(void) const
+    {
+        return mReachabilityCache.GetCounters();
+    }
+
+    /**
+     * Resets the reachability check cache counters.
+     */
+    void ResetReachabilityCacheCounters(void) { mReachabilityCache.ResetCounters(); }
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_TESTING_API_ENABLE
@@ -1063,6 +1090,50 @@ private:
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    //------------------------------------------------------------------------------------------------------------------
+    // ReachabilityCache
+
+    class ReachabilityCache
+    {
+        // Caches the outcome of `CheckReachabilityToSendIcmpError()`
+        // for recent (source /64, destination) pairs. The outcome
+        // depends only on the Network Data OMR and NAT64 prefixes,
+        // the RA tracker on-link and route prefixes and the local
+        // on-link prefix, so the cache is invalidated whenever any
+        // of them changes.
+
+    public:
+        ReachabilityCache(void);
+
+        void Invalidate(void);
+        bool Find(const Ip6::Header &aIp6Header, bool &aShouldSendError);
+        void Add(const Ip6::Header &aIp6Header, bool aShouldSendError);
+
+        const ReachabilityCacheCounters &GetCounters(void) const { return mCounters; }
+        void                             ResetCounters(void) { mCounters.Clear(); }
+
+    private:
+        static constexpr uint16_t kNumEntries = OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CACHE_SIZE;
+
+        struct Entry
+        {
+            bool Matches(const Ip6::Header &aIp6Header) const;
+
+            Ip6::NetworkPrefix mSrcPrefix;
+            Ip6::Address       mDstAddress;
+            bool               mValid : 1;
+            bool               mShouldSendError : 1;
+        };
+
+        static uint16_t IndexFor(const Ip6::Header &aIp6Header);
+
+        Entry                     mEntries[kNumEntries];
+        ReachabilityCacheCounters mCounters;
+    };
+
+#endif // OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
     //------------------------------------------------------------------------------------------------------------------
     // Methods
 
@@ -1085,6 +1156,11 @@ private:
     // Callback from `RxRaTracker`
     void HandleRxRaTrackerEvents(const RxRaTracker::Events &aEvents);
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    bool ShouldSendIcmpError(const Ip6::Header &aIp6Header) const;
+    void InvalidateReachabilityCache(void) { mReachabilityCache.Invalidate(); }
+#endif
+
     static bool IsValidBrUlaPrefix(const Ip6::Prefix &aBrUlaPrefix);
 
     //------------------------------------------------------------------------------------------------------------------
@@ -1124,6 +1200,10 @@ private:
     TxRaInfo   mTxRaInfo;
     Heap::Data mExtraRaOptions;
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    ReachabilityCache mReachabilityCache;
+#endif
+
     RoutingPolicyTimer mRoutingPolicyTimer;
 };
 
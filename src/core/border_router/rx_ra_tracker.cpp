@@ -36,6 +36,7 @@
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 #include "border_router/br_log.hpp"
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -62,6 +63,7 @@ RxRaTracker::RxRaTracker(Instance &aInstance)
 {
     mLocalRaHeader.Clear();
     mPendingEvents.Clear();
+    ClearPrefixIndex();
 }
 
 void RxRaTracker::SetEnabled(bool aEnable, Requester aRequester)
@@ -134,6 +136,10 @@ void RxRaTracker::Stop(void)
     mLocalRaHeader.Clear();
     mDecisionFactors.Clear();
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    Get<RoutingManager>().InvalidateReachabilityCache();
+#endif
+
     mExpirationTimer.Stop();
     mStaleTimer.Stop();
     mRouterTimer.Stop();
@@ -810,6 +816,12 @@ void RxRaTracker::Evaluate(void)
 
     removedRouters.Free();
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    // All changes to the on-link and route prefix tables end up
+    // here, so cached reachability results may be stale now.
+    Get<RoutingManager>().InvalidateReachabilityCache();
+#endif
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Determine decision factors (favored on-link prefix, has any
     // ULA/non-ULA on-link/route prefix, M/O flags).
@@ -869,16 +881,6 @@ void RxRaTracker::Evaluate(void)
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Schedule timers
 
-    // If multiple routers advertise the same on-link or route prefix,
-    // the stale time for the prefix is determined by the latest stale
-    // time among all corresponding entries.
-    //
-    // The "StaleTimeCalculated" flag is used to ensure stale time is
-    // calculated only once for each unique prefix. Initially, this
-    // flag is cleared on all entries. As we iterate over routers and
-    // their entries, `DetermineStaleTimeFor()` will consider all
-    // matching entries and mark "StaleTimeCalculated" flag on them.
-
     for (Router &router : mRouters)
     {
         if (router.ShouldCheckReachability())
@@ -890,21 +892,11 @@ void RxRaTracker::Evaluate(void)
         for (const OnLinkPrefix &entry : router.mOnLinkPrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
-
-            if (!entry.IsStaleTimeCalculated())
-            {
-                DetermineStaleTimeFor(entry, staleTime);
-            }
         }
 
         for (const RoutePrefix &entry : router.mRoutePrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
-
-            if (!entry.IsStaleTimeCalculated())
-            {
-                DetermineStaleTimeFor(entry, staleTime);
-            }
         }
 
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
@@ -920,6 +912,8 @@ void RxRaTracker::Evaluate(void)
         }
     }
 
+    DetermineStaleTime(staleTime);
+
     if (mLocalRaHeader.IsValid())
     {
         uint16_t interval = kStaleTime;
@@ -949,30 +943,95 @@ void RxRaTracker::Evaluate(void)
 #endif
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::DetermineStaleTime(NextFireTime &aStaleTime)
 {
-    TimeMilli prefixStaleTime = aStaleTime.GetNow();
-    bool      found           = false;
+    // If multiple routers advertise the same on-link or route prefix,
+    // the stale time for the prefix is determined by the latest stale
+    // time among all corresponding entries.
+    //
+    // Entries are grouped by prefix using `mPrefixIndex` (a hash
+    // of bucket chains rebuilt here), so that each entry is only
+    // compared against entries in its own bucket instead of all
+    // entries from all routers. The "StaleTimeCalculated" flag
+    // (cleared on all entries earlier in `Evaluate()`) ensures the
+    // stale time is calculated only once for each unique prefix.
+    // The first entry of a prefix in a bucket chain considers all
+    // the matching entries after it and marks them.
+    //
+    // On-link and route prefixes are indexed in two separate rounds
+    // since they are tracked independently.
+
+    ClearPrefixIndex();
 
     for (Router &router : mRouters)
     {
         for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
         {
-            if (!entry.Matches(aPrefix.GetPrefix()))
+            AddToPrefixIndex(entry);
+        }
+    }
+
+    for (LifetimedPrefix *head : mPrefixIndex)
+    {
+        for (LifetimedPrefix *entry = head; entry != nullptr; entry = entry->GetNextInIndex())
+        {
+            if (!entry->IsStaleTimeCalculated())
             {
-                continue;
+                DetermineStaleTimeFor(*static_cast<OnLinkPrefix *>(entry), aStaleTime);
             }
+        }
+    }
 
-            entry.SetStaleTimeCalculated(true);
+    ClearPrefixIndex();
 
-            if (entry.IsDeprecated())
+    for (Router &router : mRouters)
+    {
+        for (RoutePrefix &entry : router.mRoutePrefixes)
+        {
+            AddToPrefixIndex(entry);
+        }
+    }
+
+    for (LifetimedPrefix *head : mPrefixIndex)
+    {
+        for (LifetimedPrefix *entry = head; entry != nullptr; entry = entry->GetNextInIndex())
+        {
+            if (!entry->IsStaleTimeCalculated())
             {
-                continue;
+                DetermineStaleTimeFor(*static_cast<RoutePrefix *>(entry), aStaleTime);
             }
+        }
+    }
+
+    // The index holds pointers to entries which may be freed after
+    // this, so it is cleared and only ever used within this method.
+
+    ClearPrefixIndex();
+}
 
-            prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
-            found           = true;
+void RxRaTracker::DetermineStaleTimeFor(OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
+{
+    TimeMilli prefixStaleTime = aStaleTime.GetNow();
+    bool      found           = false;
+
+    for (LifetimedPrefix *next = &aPrefix; next != nullptr; next = next->GetNextInIndex())
+    {
+        OnLinkPrefix &entry = *static_cast<OnLinkPrefix *>(next);
+
+        if (!entry.Matches(aPrefix.GetPrefix()))
+        {
+            continue;
+        }
+
+        entry.SetStaleTimeCalculated(true);
+
+        if (entry.IsDeprecated())
+        {
+            continue;
         }
+
+        prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
+        found           = true;
     }
 
     if (found)
@@ -981,25 +1040,24 @@ void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTim
     }
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::DetermineStaleTimeFor(RoutePrefix &aPrefix, NextFireTime &aStaleTime)
 {
     TimeMilli prefixStaleTime = aStaleTime.GetNow();
     bool      found           = false;
 
-    for (Router &router : mRouters)
+    for (LifetimedPrefix *next = &aPrefix; next != nullptr; next = next->GetNextInIndex())
     {
-        for (RoutePrefix &entry : router.mRoutePrefixes)
+        RoutePrefix &entry = *static_cast<RoutePrefix *>(next);
+
+        if (!entry.Matches(aPrefix.GetPrefix()))
         {
-            if (!entry.Matches(aPrefix.GetPrefix()))
-            {
-                continue;
-            }
+            continue;
+        }
 
-            entry.SetStaleTimeCalculated(true);
+        entry.SetStaleTimeCalculated(true);
 
-            prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
-            found           = true;
-        }
+        prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
+        found           = true;
     }
 
     if (found)
@@ -1008,6 +1066,34 @@ void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime
     }
 }
 
+void RxRaTracker::ClearPrefixIndex(void)
+{
+    for (LifetimedPrefix *&head : mPrefixIndex)
+    {
+        head = nullptr;
+    }
+}
+
+void RxRaTracker::AddToPrefixIndex(LifetimedPrefix &aPrefix)
+{
+    LifetimedPrefix *&head = mPrefixIndex[GetPrefixIndexBucket(aPrefix.GetPrefix())];
+
+    aPrefix.SetNextInIndex(head);
+    head = &aPrefix;
+}
+
+uint16_t RxRaTracker::GetPrefixIndexBucket(const Ip6::Prefix &aPrefix)
+{
+    // Hash over the prefix length and its whole bytes.
+
+    Fnv1aHash hash;
+
+    hash.FeedByte(aPrefix.GetLength());
+    hash.FeedBytes(aPrefix.GetBytes(), aPrefix.GetLength() / kBitsPerByte);
+
+    return static_cast<uint16_t>(hash.GetHash() % kNumPrefixIndexBuckets);
+}
+
 void RxRaTracker::HandleStaleTimer(void)
 {
     VerifyOrExit(mIsRunning);
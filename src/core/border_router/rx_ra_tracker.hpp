@@ -331,7 +331,8 @@ public:
     void HandleLocalOnLinkPrefixChanged(void);
 
 private:
-    static constexpr uint32_t kStaleTime = 600; // 10 minutes.
+    static constexpr uint32_t kStaleTime             = 600; // 10 minutes.
+    static constexpr uint16_t kNumPrefixIndexBuckets = 32;
 
     typedef Ip6::Nd::Option    Option;
     typedef Ip6::Nd::TxMessage TxMessage;
@@ -612,8 +613,11 @@ private:
     void UpdateIfAddresses(const Ip6::Address &aAddress);
     void RemoveOrDeprecateOldEntries(TimeMilli aTimeThreshold);
     void Evaluate(void);
-    void DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
-    void DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime);
+    void DetermineStaleTime(NextFireTime &aStaleTime);
+    void DetermineStaleTimeFor(OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
+    void DetermineStaleTimeFor(RoutePrefix &aPrefix, NextFireTime &aStaleTime);
+    void ClearPrefixIndex(void);
+    void AddToPrefixIndex(LifetimedPrefix &aPrefix);
     void SendNeighborSolicitToRouter(const Router &aRouter);
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
     uint16_t CountReachablePeerBrs(void) const;
@@ -643,6 +647,7 @@ private:
     template <class Type> Entry<Type> *AllocateEntry(void);
 #endif
 
+    static uint16_t    GetPrefixIndexBucket(const Ip6::Prefix &aPrefix);
     static const char *RouterAdvOriginToString(RouterAdvOrigin aRaOrigin);
 
     using EventTask       = TaskletIn<RxRaTracker, &RxRaTracker::HandleEventTask>;
@@ -673,6 +678,7 @@ private:
     RdnssCallback        mRdnssCallback;
     RouterAdvert::Header mLocalRaHeader;
     TimeMilli            mLocalRaHeaderUpdateTime;
+    LifetimedPrefix     *mPrefixIndex[kNumPrefixIndexBuckets];
 
 #if !OPENTHREAD_CONFIG_BORDER_ROUTING_USE_HEAP_ENABLE
     Pool<SharedEntry, kMaxEntries>   mEntryPool;
@@ -28,6 +28,7 @@
 
 #include "coap.hpp"
 
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 /**
@@ -1530,11 +1531,30 @@ bool CoapBase::Request::IsObserveSubscription(void) const
 }
 #endif
 
+uint32_t CoapBase::HashToken(const Token &aToken)
+{
+    return Fnv1aHash().FeedBytes(aToken.GetBytes(), aToken.GetLength());
+}
+
+uint32_t CoapBase::HashPeer(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    uint8_t   idAndPort[sizeof(uint16_t) * 2];
+    Fnv1aHash hash;
+
+    BigEndian::WriteUint16(aMessageId, &idAndPort[0]);
+    BigEndian::WriteUint16(aMessageInfo.GetPeerPort(), &idAndPort[sizeof(uint16_t)]);
+
+    hash.Feed(aMessageInfo.GetPeerAddr());
+
+    return hash.Feed(idAndPort);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // CoapBase::PendingRequests
 
 CoapBase::PendingRequests::PendingRequests(Instance &aInstance, CoapBase &aCoapBase)
     : mCoapBase(aCoapBase)
+    , mNumUnindexed(0)
     , mDispatchingRequest(nullptr)
     , mTimer(aInstance, HandleTimer, this)
 {
@@ -1565,7 +1585,7 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     SuccessOrExit(error = aRequest.AppendMetadataToMessage());
 
-    mRequestMessages.Enqueue(*aRequest.mMessage);
+    Enqueue(*aRequest.mMessage, aTxMsg);
 
     mTimer.FireAtIfEarlier(aRequest.GetTimerFireTime());
 
@@ -1577,53 +1597,125 @@ exit:
 void CoapBase::PendingRequests::Remove(Request &aRequest)
 {
     VerifyOrExit(aRequest.HasMessage());
-    mRequestMessages.DequeueAndFree(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
+    aRequest.mMessage->Free();
     aRequest.Clear();
 
 exit:
     return;
 }
 
-Error CoapBase::PendingRequests::FindRelatedRequest(const Msg &aMsg, Request &aRequest)
+void CoapBase::PendingRequests::Enqueue(Message &aMessage, const Msg &aTxMsg)
 {
-    Error error = kErrorNotFound;
+    // Requests are indexed both by message ID (to match ACK or RST)
+    // and by token (to match separate responses). If the indexes are
+    // full, the request is left unindexed, and `FindRelatedRequest()`
+    // falls back to a linear search while any such request remains.
 
-    for (Message &message : mRequestMessages)
+    mRequestMessages.Enqueue(aMessage);
+
+    if (mMessageIdIndex.Add(aMessage, aTxMsg.GetMessageId()) != kErrorNone)
     {
-        aRequest.InitFrom(message);
+        mNumUnindexed++;
+        ExitNow();
+    }
 
-        if (aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
-            aRequest.GetDestinationAddress().GetIid().IsAnycastLocator())
-        {
-            switch (aMsg.GetType())
-            {
-            case kTypeReset:
-            case kTypeAck:
-                if (aMsg.GetMessageId() == message.ReadMessageId())
-                {
-                    ExitNow(error = kErrorNone);
-                }
+    SuccessOrAssert(mTokenIndex.Add(aMessage, HashToken(aTxMsg.GetToken())));
 
-                break;
+exit:
+    return;
+}
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aMsg.mMessage.HasSameTokenAs(message))
-                {
-                    ExitNow(error = kErrorNone);
-                }
+void CoapBase::PendingRequests::Dequeue(Message &aMessage)
+{
+    mRequestMessages.Dequeue(aMessage);
 
-                break;
+    if (mMessageIdIndex.Remove(aMessage))
+    {
+        IgnoreReturnValue(mTokenIndex.Remove(aMessage));
+    }
+    else
+    {
+        OT_ASSERT(mNumUnindexed > 0);
+        mNumUnindexed--;
+    }
+}
+
+Error CoapBase::PendingRequests::FindRelatedRequest(const Msg &aMsg, Request &aRequest)
+{
+    Error                                    error = kErrorNotFound;
+    const MessageIndex<kMaxIndexedRequests> *index = &mTokenIndex;
+    uint16_t                                 entry;
+
+    if (mNumUnindexed > 0)
+    {
+        for (Message &message : mRequestMessages)
+        {
+            if (Matches(aMsg, message, aRequest))
+            {
+                ExitNow(error = kErrorNone);
             }
         }
+
+        ExitNow();
     }
 
-    aRequest.Clear();
+    if (aMsg.IsAck() || aMsg.IsReset())
+    {
+        index = &mMessageIdIndex;
+        entry = index->GetFirst(aMsg.GetMessageId());
+    }
+    else
+    {
+        entry = index->GetFirst(HashToken(aMsg.GetToken()));
+    }
+
+    for (; entry != index->kNone; entry = index->GetNext(entry))
+    {
+        if (Matches(aMsg, index->GetMessage(entry), aRequest))
+        {
+            ExitNow(error = kErrorNone);
+        }
+    }
 
 exit:
+    if (error != kErrorNone)
+    {
+        aRequest.Clear();
+    }
+
     return error;
 }
 
+bool CoapBase::PendingRequests::Matches(const Msg &aMsg, Message &aMessage, Request &aRequest) const
+{
+    // Checks the message ID or token first, since it only reads the
+    // header, before reading the request metadata to check the peer.
+
+    bool matches = false;
+
+    switch (aMsg.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        VerifyOrExit(aMsg.GetMessageId() == aMessage.ReadMessageId());
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        VerifyOrExit(aMsg.mMessage.HasSameTokenAs(aMessage));
+        break;
+    }
+
+    aRequest.InitFrom(aMessage);
+
+    matches = aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
+              aRequest.GetDestinationAddress().GetIid().IsAnycastLocator();
+
+exit:
+    return matches;
+}
+
 void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult)
 {
     FinalizeRequest(aRequest, aResult, /* aResponse */ nullptr);
@@ -1633,7 +1725,7 @@ void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult
 {
     VerifyOrExit(aRequest.HasMessage());
 
-    mRequestMessages.Dequeue(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
 
     DispatchResponse(aRequest, aResult, aResponse);
 
@@ -1704,7 +1796,7 @@ Error CoapBase::PendingRequests::AbortAllMatching(const Matcher &aMatcher)
 
         if (aMatcher.Matches(request))
         {
-            mRequestMessages.Dequeue(message);
+            Dequeue(message);
             abortedMessages.Enqueue(message);
             error = kErrorNone;
         }
@@ -1781,7 +1873,7 @@ void CoapBase::PendingRequests::HandleTimer(void)
                 // even if the user callback (invoked during
                 // finalization) modifies any pending requests
 
-                mRequestMessages.Dequeue(message);
+                Dequeue(message);
                 expiredMessages.Enqueue(message);
                 continue;
             }
@@ -1833,6 +1925,7 @@ exit:
 CoapBase::ResponseCache::ResponseCache(Instance &aInstance)
     : mTimer(aInstance, ResponseCache::HandleTimer, this)
 {
+    mCounters.Clear();
 }
 
 Error CoapBase::ResponseCache::SendCachedResponse(const Msg &aRxMsg, CoapBase &aCoapBase)
@@ -1848,6 +1941,8 @@ Error CoapBase::ResponseCache::SendCachedResponse(const Msg &aRxMsg, CoapBase &a
 
     VerifyOrExit(match != nullptr, error = kErrorNotFound);
 
+    mCounters.mHits++;
+
     response = aCoapBase.CloneMessageWithout<ResponseMetadata>(*match);
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
 
@@ -1862,9 +1957,12 @@ const Message *CoapBase::ResponseCache::FindMatching(const Msg &aRxMsg) const
 {
     const Message *match        = nullptr;
     uint16_t       requestMsgId = aRxMsg.GetMessageId();
+    uint16_t       entry        = mIndex.GetFirst(HashPeer(requestMsgId, aRxMsg.mMessageInfo));
 
-    for (const Message &response : mResponses)
+    for (; entry != mIndex.kNone; entry = mIndex.GetNext(entry))
     {
+        const Message &response = mIndex.GetMessage(entry);
+
         if (response.ReadMessageId() == requestMsgId)
         {
             ResponseMetadata metadata;
@@ -1892,7 +1990,7 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
 
     VerifyOrExit(FindMatching(aTxMsg) == nullptr);
 
-    MaintainCacheSize();
+    MaintainCacheSize(aTxMsg.mMessage.GetBufferCount());
 
     responseClone = AsCoapMessagePtr(aTxMsg.mMessage.Clone<kNoReservedHeader>());
     VerifyOrExit(responseClone != nullptr);
@@ -1901,6 +1999,7 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
     metadata.mMessageInfo = aTxMsg.mMessageInfo;
 
     SuccessOrExit(metadata.AppendTo(*responseClone));
+    SuccessOrExit(mIndex.Add(*responseClone, HashPeer(aTxMsg.GetMessageId(), aTxMsg.mMessageInfo)));
 
     mResponses.Enqueue(*responseClone);
     responseClone = nullptr;
@@ -1911,39 +2010,57 @@ exit:
     FreeMessage(responseClone);
 }
 
-void CoapBase::ResponseCache::MaintainCacheSize(void)
+void CoapBase::ResponseCache::MaintainCacheSize(uint16_t aNewBuffers)
 {
-    // Checks the cache size. If the limit (`kMaxCacheSize`) is
-    // reached, removes the entry with the earliest expire time.
-
-    uint16_t  count       = 0;
-    Message  *msgToRemove = nullptr;
-    TimeMilli earliestExpireTime;
+    // Makes room for a new entry using `aNewBuffers` message buffers.
+    // While either the entry limit (`kMaxCacheSize`) or the buffer
+    // limit (`kMaxCacheBuffers`, if non-zero) would be exceeded,
+    // removes the entry with the earliest expire time.
 
-    for (Message &response : mResponses)
+    while (true)
     {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(response);
+        uint16_t  count       = 0;
+        uint16_t  numBuffers  = aNewBuffers;
+        Message  *msgToRemove = nullptr;
+        TimeMilli earliestExpireTime;
 
-        if ((msgToRemove == nullptr) || (metadata.mExpireTime < earliestExpireTime))
+        for (Message &response : mResponses)
         {
-            msgToRemove        = &response;
-            earliestExpireTime = metadata.mExpireTime;
+            ResponseMetadata metadata;
+
+            metadata.ReadFrom(response);
+
+            if ((msgToRemove == nullptr) || (metadata.mExpireTime < earliestExpireTime))
+            {
+                msgToRemove        = &response;
+                earliestExpireTime = metadata.mExpireTime;
+            }
+
+            count++;
+            numBuffers += response.GetBufferCount();
         }
 
-        count++;
-    }
+        VerifyOrExit(msgToRemove != nullptr);
+        VerifyOrExit((count >= kMaxCacheSize) || ((kMaxCacheBuffers != 0) && (numBuffers > kMaxCacheBuffers)));
 
-    if (count >= kMaxCacheSize)
-    {
-        mResponses.DequeueAndFree(*msgToRemove);
+        DequeueAndFree(*msgToRemove);
+        mCounters.mEvictions++;
     }
+
+exit:
+    return;
+}
+
+void CoapBase::ResponseCache::DequeueAndFree(Message &aResponse)
+{
+    IgnoreReturnValue(mIndex.Remove(aResponse));
+    mResponses.DequeueAndFree(aResponse);
 }
 
 void CoapBase::ResponseCache::RemoveAll(void)
 {
     mResponses.DequeueAndFreeAll();
+    mIndex.Clear();
     mTimer.Stop();
 }
 
@@ -1964,7 +2081,7 @@ void CoapBase::ResponseCache::HandleTimer(void)
 
         if (expireTime.GetNow() >= metadata.mExpireTime)
         {
-            mResponses.DequeueAndFree(response);
+            DequeueAndFree(response);
         }
         else
         {
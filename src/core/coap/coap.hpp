@@ -36,12 +36,14 @@
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/message_allocator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/owned_ptr.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
@@ -294,6 +296,8 @@ class CoapBase
       public MessageAllocator<CoapBase, ReservedHeaderSize::kCoapMessage, Message::kTypeIp6, ot::Coap::Message>,
       private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     /**
      * Function pointer callback invoked before CoAP processing a received CoAP message.
@@ -306,6 +310,15 @@ public:
      */
     typedef Error (*Interceptor)(void *aContext, const Msg &aRxMsg);
 
+    /**
+     * Represents the response cache counters.
+     */
+    struct ResponseCacheCounters : public Clearable<ResponseCacheCounters>
+    {
+        uint32_t mHits;      ///< Number of duplicate requests answered with a cached response.
+        uint32_t mEvictions; ///< Number of cached responses evicted before expiring to make room for a new one.
+    };
+
     /**
      * Clears all requests and responses used by this CoAP agent and stops all timers.
      */
@@ -695,6 +708,13 @@ public:
      */
     void GetRequestAndCachedResponsesQueueInfo(MessageQueue::Info &aQueueInfo) const;
 
+    /**
+     * Gets the response cache counters.
+     *
+     * @returns The response cache counters.
+     */
+    const ResponseCacheCounters &GetResponseCacheCounters(void) const { return mResponseCache.GetCounters(); }
+
     /**
      * Sends a CoAP message with custom transmission parameters using `ResponseHandlerSeparateParams` handle type.
      *
@@ -824,6 +844,40 @@ private:
 #endif
     };
 
+    template <uint16_t kNumEntries> class MessageIndex
+    {
+        // Chained hash index over messages held in a `MessageQueue`.
+        // Each entry records the message and the full hash of its key,
+        // so that most collisions are resolved without reading the
+        // message. Entries within a bucket are kept in insertion order,
+        // matching their order in the queue. Callers validate the
+        // candidate messages when iterating over a bucket.
+
+    public:
+        static constexpr uint16_t kNone = NumericLimits<uint16_t>::kMax;
+
+        MessageIndex(void) { Clear(); }
+
+        void     Clear(void);
+        Error    Add(Message &aMessage, uint32_t aHash);
+        bool     Remove(const Message &aMessage);
+        uint16_t GetFirst(uint32_t aHash) const { return FindFrom(mHeads[aHash % kNumEntries], aHash); }
+        uint16_t GetNext(uint16_t aEntry) const { return FindFrom(mNext[aEntry], mHashes[aEntry]); }
+        Message &GetMessage(uint16_t aEntry) const { return *mMessages[aEntry]; }
+
+    private:
+        uint16_t FindFrom(uint16_t aEntry, uint32_t aHash) const;
+
+        Message *mMessages[kNumEntries];
+        uint32_t mHashes[kNumEntries];
+        uint16_t mHeads[kNumEntries];
+        uint16_t mNext[kNumEntries];
+        uint16_t mFreeHead;
+    };
+
+    static uint32_t HashToken(const Token &aToken);
+    static uint32_t HashPeer(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+
     class PendingRequests;
 
     class Request
@@ -896,6 +950,8 @@ private:
 
     class PendingRequests
     {
+        friend class ot::UnitTester;
+
         struct Iterator;
 
     public:
@@ -915,6 +971,10 @@ private:
         void  GetInfo(MessageQueue::Info &aInfo) const { mRequestMessages.GetInfo(aInfo); }
 
     private:
+        static constexpr uint16_t kMaxIndexedRequests = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS;
+
+        static_assert(kMaxIndexedRequests != 0, "kMaxIndexedRequests MUST be non-zero");
+
         class Matcher
         {
         public:
@@ -940,6 +1000,9 @@ private:
             void               *mContext;
         };
 
+        void        Enqueue(Message &aMessage, const Msg &aTxMsg);
+        void        Dequeue(Message &aMessage);
+        bool        Matches(const Msg &aMsg, Message &aMessage, Request &aRequest) const;
         Error       AbortAllMatching(const Matcher &aMatcher);
         void        FinalizeRemovedRequestsIn(MessageQueue &aQueue, Error aResult);
         void        RetransmitRequest(const Request &aRequest);
@@ -949,14 +1012,19 @@ private:
         Error ProcessObserveSend(const Msg &aTxMsg, Request &aRequest);
 #endif
 
-        CoapBase         &mCoapBase;
-        MessageQueue      mRequestMessages;
-        const Request    *mDispatchingRequest;
-        TimerMilliContext mTimer;
+        CoapBase                         &mCoapBase;
+        MessageQueue                      mRequestMessages;
+        MessageIndex<kMaxIndexedRequests> mMessageIdIndex;
+        MessageIndex<kMaxIndexedRequests> mTokenIndex;
+        uint16_t                          mNumUnindexed;
+        const Request                    *mDispatchingRequest;
+        TimerMilliContext                 mTimer;
     };
 
     class ResponseCache
     {
+        friend class ot::UnitTester;
+
     public:
         explicit ResponseCache(Instance &aInstance);
 
@@ -965,8 +1033,11 @@ private:
         Error SendCachedResponse(const Msg &aRxMsg, CoapBase &aCoapBase);
         void  GetInfo(MessageQueue::Info &aInfo) const { mResponses.GetInfo(aInfo); }
 
+        const ResponseCacheCounters &GetCounters(void) const { return mCounters; }
+
     private:
-        static constexpr uint16_t kMaxCacheSize = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+        static constexpr uint16_t kMaxCacheSize    = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+        static constexpr uint16_t kMaxCacheBuffers = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSE_BUFFERS;
 
         static_assert(kMaxCacheSize != 0, "kMaxCacheSize MUST be non-zero");
 
@@ -977,12 +1048,15 @@ private:
         };
 
         const Message *FindMatching(const Msg &aRxMsg) const;
-        void           MaintainCacheSize(void);
+        void           MaintainCacheSize(uint16_t aNewBuffers);
+        void           DequeueAndFree(Message &aResponse);
         static void    HandleTimer(Timer &aTimer);
         void           HandleTimer(void);
 
-        MessageQueue      mResponses;
-        TimerMilliContext mTimer;
+        MessageQueue                mResponses;
+        MessageIndex<kMaxCacheSize> mIndex;
+        ResponseCacheCounters       mCounters;
+        TimerMilliContext           mTimer;
     };
 
     Message *InitMessage(Message *aMessage, Type aType, Uri aUri);
@@ -1094,6 +1168,95 @@ public:
 };
 #endif
 
+//---------------------------------------------------------------------------------------------------------------------
+// CoapBase::MessageIndex
+
+template <uint16_t kNumEntries> void CoapBase::MessageIndex<kNumEntries>::Clear(void)
+{
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        mMessages[i] = nullptr;
+        mHashes[i]   = 0;
+        mHeads[i]    = kNone;
+        mNext[i]     = (i + 1 < kNumEntries) ? static_cast<uint16_t>(i + 1) : kNone;
+    }
+
+    mFreeHead = 0;
+}
+
+template <uint16_t kNumEntries> Error CoapBase::MessageIndex<kNumEntries>::Add(Message &aMessage, uint32_t aHash)
+{
+    Error     error = kErrorNone;
+    uint16_t  entry = mFreeHead;
+    uint16_t *link;
+
+    VerifyOrExit(entry != kNone, error = kErrorNoBufs);
+
+    mFreeHead        = mNext[entry];
+    mMessages[entry] = &aMessage;
+    mHashes[entry]   = aHash;
+    mNext[entry]     = kNone;
+
+    // Append at the tail of the bucket to preserve insertion order.
+
+    link = &mHeads[aHash % kNumEntries];
+
+    while (*link != kNone)
+    {
+        link = &mNext[*link];
+    }
+
+    *link = entry;
+
+exit:
+    return error;
+}
+
+template <uint16_t kNumEntries> bool CoapBase::MessageIndex<kNumEntries>::Remove(const Message &aMessage)
+{
+    bool      removed = false;
+    uint16_t  entry;
+    uint16_t *link;
+
+    for (entry = 0; entry < kNumEntries; entry++)
+    {
+        if (mMessages[entry] == &aMessage)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(entry < kNumEntries);
+
+    link = &mHeads[mHashes[entry] % kNumEntries];
+
+    while (*link != entry)
+    {
+        link = &mNext[*link];
+    }
+
+    *link = mNext[entry];
+
+    mMessages[entry] = nullptr;
+    mNext[entry]     = mFreeHead;
+    mFreeHead        = entry;
+    removed          = true;
+
+exit:
+    return removed;
+}
+
+template <uint16_t kNumEntries>
+uint16_t CoapBase::MessageIndex<kNumEntries>::FindFrom(uint16_t aEntry, uint32_t aHash) const
+{
+    while ((aEntry != kNone) && (mHashes[aEntry] != aHash))
+    {
+        aEntry = mNext[aEntry];
+    }
+
+    return aEntry;
+}
+
 } // namespace Coap
 
 DefineCoreType(otCoapTxParameters, Coap::TxParameters);
@@ -72,6 +72,9 @@ public:
     explicit CrcCalculator(UintType aPolynomial)
         : mPolynomial(aPolynomial)
         , mCrc(0)
+#if OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+        , mSliceTables(FindSliceTables(aPolynomial))
+#endif
     {
     }
 
@@ -127,8 +130,19 @@ public:
     UintType Feed(const Message &aMessage, const OffsetRange &aOffsetRange);
 
 private:
+#if OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+    typedef UintType SliceTable[256];
+
+    static const SliceTable *FindSliceTables(UintType aPolynomial);
+
+    void FeedSliced(const uint8_t *aBytes, uint16_t aLength);
+#endif
+
     UintType mPolynomial;
     UintType mCrc;
+#if OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+    const SliceTable *mSliceTables;
+#endif
 };
 
 } // namespace ot
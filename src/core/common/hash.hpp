@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for non-cryptographic hash computations.
+ */
+
+#ifndef OT_CORE_COMMON_HASH_HPP_
+#define OT_CORE_COMMON_HASH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/type_traits.hpp"
+
+namespace ot {
+
+/**
+ * Implements the 32-bit FNV-1a hash.
+ *
+ * The hash is intended for bucketing entries in in-memory lookup tables. It MUST NOT be used where a cryptographic
+ * hash is required.
+ */
+class Fnv1aHash
+{
+public:
+    /**
+     * Initializes the `Fnv1aHash` object.
+     */
+    Fnv1aHash(void)
+        : mHash(kOffsetBasis)
+    {
+    }
+
+    /**
+     * Gets the current hash value.
+     *
+     * @returns The current hash value.
+     */
+    uint32_t GetHash(void) const { return mHash; }
+
+    /**
+     * Feeds a byte value into the hash computation.
+     *
+     * @param[in]  aByte  The byte value.
+     *
+     * @returns The current hash value.
+     */
+    uint32_t FeedByte(uint8_t aByte)
+    {
+        mHash = (mHash ^ aByte) * kPrime;
+        return mHash;
+    }
+
+    /**
+     * Feeds a sequence of bytes into the hash computation.
+     *
+     * @param[in]  aBytes   A pointer to buffer containing the bytes.
+     * @param[in]  aLength  Number of bytes in @p aBytes.
+     *
+     * @returns The current hash value.
+     */
+    uint32_t FeedBytes(const void *aBytes, uint16_t aLength);
+
+    /**
+     * Feeds an object (all its bytes) into the hash computation.
+     *
+     * @tparam    ObjectType   The object type.
+     *
+     * @param[in] aObject      A reference to the object.
+     *
+     * @returns The current hash value.
+     */
+    template <typename ObjectType> uint32_t Feed(const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        return FeedBytes(&aObject, sizeof(ObjectType));
+    }
+
+private:
+    static constexpr uint32_t kOffsetBasis = 2166136261u;
+    static constexpr uint32_t kPrime       = 16777619u;
+
+    uint32_t mHash;
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_HASH_HPP_
@@ -265,6 +265,11 @@ void Message::Free(void)
     // message, signaling `kErrorDrop`.
 
     InvokeTxCallback(kErrorDrop);
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE
+    GetIndirectTxChildMask().Clear();
+#endif
+
     Get<MessagePool>().Free(this);
 }
 
@@ -619,6 +624,42 @@ exit:
     return;
 }
 
+Error Message::GetView(const OffsetRange &aOffsetRange,
+                       uint8_t           *aBuffer,
+                       uint16_t           aBufferSize,
+                       FrameData         &aView) const
+{
+    Error    error  = kErrorNone;
+    uint16_t length = aOffsetRange.GetLength();
+    Chunk    chunk;
+
+    VerifyOrExit(aOffsetRange.GetEndOffset() <= GetLength(), error = kErrorParse);
+
+    if (length == 0)
+    {
+        aView.Init(aBuffer, 0);
+        ExitNow();
+    }
+
+    GetFirstChunk(aOffsetRange.GetOffset(), length, chunk);
+
+    if (length == 0)
+    {
+        // All bytes are within a single buffer, so we can use them
+        // in place without copying.
+
+        aView.Init(chunk.GetBytes(), chunk.GetLength());
+        ExitNow();
+    }
+
+    VerifyOrExit(aOffsetRange.GetLength() <= aBufferSize, error = kErrorNoBufs);
+    ReadBytes(aOffsetRange, aBuffer);
+    aView.Init(aBuffer, aOffsetRange.GetLength());
+
+exit:
+    return error;
+}
+
 uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
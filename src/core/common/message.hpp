@@ -48,6 +48,7 @@
 #include "common/const_cast.hpp"
 #include "common/data.hpp"
 #include "common/encoding.hpp"
+#include "common/frame_data.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
@@ -948,6 +949,46 @@ public:
         return Read(aOffsetRange, &aObject, sizeof(ObjectType));
     }
 
+    /**
+     * Gets a read-only view of the bytes in a given offset range, copying them only if they are not contiguous.
+     *
+     * If all bytes in @p aOffsetRange are stored within a single message buffer, @p aView is set to point directly
+     * into the message buffer and @p aBuffer is left unused. Otherwise the bytes are copied into @p aBuffer and
+     * @p aView points to @p aBuffer.
+     *
+     * The returned @p aView remains valid only while the message is not modified or freed, and while @p aBuffer
+     * remains valid.
+     *
+     * @param[in]  aOffsetRange  The offset range in the message to get the view of.
+     * @param[in]  aBuffer       A pointer to a buffer to use if the bytes are not contiguous.
+     * @param[in]  aBufferSize   The size of @p aBuffer (number of bytes).
+     * @param[out] aView         A reference to a `FrameData` to output the view.
+     *
+     * @retval kErrorNone     @p aView is successfully updated.
+     * @retval kErrorParse    Not enough bytes remaining in message to read the entire @p aOffsetRange.
+     * @retval kErrorNoBufs   The bytes are not contiguous and @p aBuffer is too small to hold them.
+     */
+    Error GetView(const OffsetRange &aOffsetRange, uint8_t *aBuffer, uint16_t aBufferSize, FrameData &aView) const;
+
+    /**
+     * Gets a read-only view of the bytes in a given offset range, copying them only if they are not contiguous.
+     *
+     * @tparam     kBufferSize   The size of @p aBuffer.
+     *
+     * @param[in]  aOffsetRange  The offset range in the message to get the view of.
+     * @param[in]  aBuffer       A buffer to use if the bytes are not contiguous.
+     * @param[out] aView         A reference to a `FrameData` to output the view.
+     *
+     * @retval kErrorNone     @p aView is successfully updated.
+     * @retval kErrorParse    Not enough bytes remaining in message to read the entire @p aOffsetRange.
+     * @retval kErrorNoBufs   The bytes are not contiguous and @p aBuffer is too small to hold them.
+     */
+    template <uint16_t kBufferSize>
+    Error GetView(const OffsetRange &aOffsetRange, uint8_t (&aBuffer)[kBufferSize], FrameData &aView) const
+    {
+        return GetView(aOffsetRange, aBuffer, kBufferSize, aView);
+    }
+
     /**
      * Reads a given number of bytes from the message at a given offset range and advances the offset range.
      *
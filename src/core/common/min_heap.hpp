@@ -0,0 +1,278 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for an indexed binary min-heap.
+ */
+
+#ifndef OT_CORE_COMMON_MIN_HEAP_HPP_
+#define OT_CORE_COMMON_MIN_HEAP_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
+
+namespace ot {
+
+/**
+ * Implements a binary min-heap over entry indexes of a table owned by another object.
+ *
+ * The heap does not store the entries themselves. It holds entry indexes (in range `[0, kMaxEntries)`) into a table
+ * owned by `OwnerType`, ordered using the owner's `IsLess` method. The heap also tracks the position of every entry so
+ * that an entry can be updated or removed in O(log n) without searching for it.
+ *
+ * The owner MUST call `Update()` whenever the sort key of an entry in the heap changes.
+ *
+ * @tparam OwnerType    The type of the object owning the table.
+ * @tparam kMaxEntries  The maximum number of entries (table size).
+ * @tparam IsLess       The owner's method to compare two entries. It returns TRUE if the first entry should be
+ *                      placed before the second one.
+ */
+template <typename OwnerType, uint16_t kMaxEntries, bool (OwnerType::*IsLess)(uint16_t, uint16_t) const>
+class MinHeap : private NonCopyable
+{
+    static constexpr uint16_t kNotInHeap = NumericLimits<uint16_t>::kMax;
+
+    static_assert(kMaxEntries < kNotInHeap, "kMaxEntries is too large");
+
+public:
+    /**
+     * Initializes the `MinHeap` as empty.
+     *
+     * @param[in] aOwner  The owner of the table (used to compare entries).
+     */
+    explicit MinHeap(const OwnerType &aOwner)
+        : mOwner(aOwner)
+    {
+        Clear();
+    }
+
+    /**
+     * Removes all entries from the heap.
+     */
+    void Clear(void)
+    {
+        mLength = 0;
+
+        for (uint16_t &position : mPositions)
+        {
+            position = kNotInHeap;
+        }
+    }
+
+    /**
+     * Indicates whether the heap is empty.
+     *
+     * @retval TRUE   The heap is empty.
+     * @retval FALSE  The heap is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0); }
+
+    /**
+     * Returns the number of entries in the heap.
+     *
+     * @returns The number of entries in the heap.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Returns the smallest entry in the heap.
+     *
+     * MUST be called only when the heap is not empty.
+     *
+     * @returns The index of the smallest entry.
+     */
+    uint16_t GetTop(void) const { return mEntries[0]; }
+
+    /**
+     * Indicates whether a given entry is in the heap.
+     *
+     * @param[in] aEntry  The entry index.
+     *
+     * @retval TRUE   The entry is in the heap.
+     * @retval FALSE  The entry is not in the heap.
+     */
+    bool Contains(uint16_t aEntry) const { return (mPositions[aEntry] != kNotInHeap); }
+
+    /**
+     * Adds an entry to the heap, or re-positions it if it is already in the heap.
+     *
+     * @param[in] aEntry  The entry index.
+     */
+    void Update(uint16_t aEntry)
+    {
+        if (!Contains(aEntry))
+        {
+            Set(mLength++, aEntry);
+        }
+
+        SiftUp(mPositions[aEntry]);
+        SiftDown(mPositions[aEntry]);
+    }
+
+    /**
+     * Removes an entry from the heap. No action is taken if the entry is not in the heap.
+     *
+     * @param[in] aEntry  The entry index.
+     */
+    void Remove(uint16_t aEntry)
+    {
+        uint16_t position = mPositions[aEntry];
+
+        VerifyOrExit(position != kNotInHeap);
+
+        mPositions[aEntry] = kNotInHeap;
+        mLength--;
+
+        VerifyOrExit(position != mLength);
+
+        Set(position, mEntries[mLength]);
+
+        if ((position > 0) && Less(position, GetParent(position)))
+        {
+            SiftUp(position);
+        }
+        else
+        {
+            SiftDown(position);
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * Changes the index of an entry in the heap, keeping its position.
+     *
+     * Is used when the owner moves an entry within its table (e.g., `Array::Remove()` moving the last entry into the
+     * freed slot).
+     *
+     * @param[in] aOldEntry  The current index of the entry. MUST be in the heap.
+     * @param[in] aNewEntry  The new index of the entry. MUST NOT be in the heap.
+     */
+    void Renumber(uint16_t aOldEntry, uint16_t aNewEntry)
+    {
+        Set(mPositions[aOldEntry], aNewEntry);
+        mPositions[aOldEntry] = kNotInHeap;
+    }
+
+    /**
+     * Indicates whether the heap property holds and the tracked positions are consistent.
+     *
+     * Is intended for use by unit tests.
+     *
+     * @retval TRUE   The heap is valid.
+     * @retval FALSE  The heap is not valid.
+     */
+    bool IsValid(void) const
+    {
+        bool isValid = true;
+
+        for (uint16_t position = 0; position < mLength; position++)
+        {
+            VerifyOrExit(mPositions[mEntries[position]] == position, isValid = false);
+            VerifyOrExit((position == 0) || !Less(position, GetParent(position)), isValid = false);
+        }
+
+    exit:
+        return isValid;
+    }
+
+private:
+    static uint16_t GetParent(uint16_t aPosition) { return (aPosition - 1) / 2; }
+
+    bool Less(uint16_t aPositionA, uint16_t aPositionB) const
+    {
+        return (mOwner.*IsLess)(mEntries[aPositionA], mEntries[aPositionB]);
+    }
+
+    void Set(uint16_t aPosition, uint16_t aEntry)
+    {
+        mEntries[aPosition] = aEntry;
+        mPositions[aEntry]  = aPosition;
+    }
+
+    void Swap(uint16_t aPositionA, uint16_t aPositionB)
+    {
+        uint16_t entry = mEntries[aPositionA];
+
+        Set(aPositionA, mEntries[aPositionB]);
+        Set(aPositionB, entry);
+    }
+
+    void SiftUp(uint16_t aPosition)
+    {
+        while (aPosition > 0)
+        {
+            uint16_t parent = GetParent(aPosition);
+
+            VerifyOrExit(Less(aPosition, parent));
+            Swap(aPosition, parent);
+            aPosition = parent;
+        }
+
+    exit:
+        return;
+    }
+
+    void SiftDown(uint16_t aPosition)
+    {
+        while (true)
+        {
+            uint16_t child = 2 * aPosition + 1;
+
+            VerifyOrExit(child < mLength);
+
+            if ((child + 1 < mLength) && Less(child + 1, child))
+            {
+                child++;
+            }
+
+            VerifyOrExit(Less(child, aPosition));
+            Swap(aPosition, child);
+            aPosition = child;
+        }
+
+    exit:
+        return;
+    }
+
+    const OwnerType &mOwner;
+    uint16_t         mLength;
+    uint16_t         mEntries[kMaxEntries];
+    uint16_t         mPositions[kMaxEntries];
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_MIN_HEAP_HPP_
@@ -178,12 +178,25 @@ const uint16_t Settings::kSensitiveKeys[] = {
     SettingsBase::kKeySrpEcdsaKey,
 };
 
-void Settings::Init(void) { Get<SettingsDriver>().Init(kSensitiveKeys, GetArrayLength(kSensitiveKeys)); }
+void Settings::Init(void)
+{
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    DiscardPendingWrites();
+#endif
+    Get<SettingsDriver>().Init(kSensitiveKeys, GetArrayLength(kSensitiveKeys));
+}
 
-void Settings::Deinit(void) { Get<SettingsDriver>().Deinit(); }
+void Settings::Deinit(void)
+{
+    Flush();
+    Get<SettingsDriver>().Deinit();
+}
 
 void Settings::Wipe(void)
 {
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    DiscardPendingWrites();
+#endif
     Get<SettingsDriver>().Wipe();
     LogInfo("Wiped all info");
 }
@@ -195,8 +208,14 @@ Settings::Key Settings::KeyForDatasetType(MeshCoP::Dataset::Type aType)
 
 void Settings::SaveOperationalDataset(MeshCoP::Dataset::Type aType, const MeshCoP::Dataset &aDataset)
 {
-    Key   key   = KeyForDatasetType(aType);
-    Error error = Get<SettingsDriver>().Set(key, aDataset.GetBytes(), aDataset.GetLength());
+    Key   key = KeyForDatasetType(aType);
+    Error error;
+
+    // Write out queued entries first so that `NetworkInfo` is never
+    // persisted out of order relative to the dataset.
+    Flush();
+
+    error = Get<SettingsDriver>().Set(key, aDataset.GetBytes(), aDataset.GetLength());
 
     Log(kActionSave, error, key);
 
@@ -219,8 +238,12 @@ exit:
 
 void Settings::DeleteOperationalDataset(MeshCoP::Dataset::Type aType)
 {
-    Key   key   = KeyForDatasetType(aType);
-    Error error = Get<SettingsDriver>().Delete(key);
+    Key   key = KeyForDatasetType(aType);
+    Error error;
+
+    Flush();
+
+    error = Get<SettingsDriver>().Delete(key);
 
     Log(kActionDelete, error, key);
 }
@@ -228,7 +251,11 @@ void Settings::DeleteOperationalDataset(MeshCoP::Dataset::Type aType)
 #if OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
 void Settings::SaveTcatCommissionerCertificate(uint8_t *aCert, uint16_t aCertLen)
 {
-    Error error = Get<SettingsDriver>().Set(kKeyTcatCommrCert, aCert, aCertLen);
+    Error error;
+
+    Flush();
+
+    error = Get<SettingsDriver>().Set(kKeyTcatCommrCert, aCert, aCertLen);
 
     Log(kActionSave, error, kKeyTcatCommrCert);
 
@@ -239,7 +266,11 @@ void Settings::SaveTcatCommissionerCertificate(uint8_t *aCert, uint16_t aCertLen
 #if OPENTHREAD_FTD
 Error Settings::AddChildInfo(const ChildInfo &aChildInfo)
 {
-    Error error = Get<SettingsDriver>().Add(kKeyChildInfo, &aChildInfo, sizeof(aChildInfo));
+    Error error;
+
+    Flush();
+
+    error = Get<SettingsDriver>().Add(kKeyChildInfo, &aChildInfo, sizeof(aChildInfo));
 
     Log(kActionAdd, error, kKeyChildInfo, &aChildInfo);
 
@@ -248,7 +279,11 @@ Error Settings::AddChildInfo(const ChildInfo &aChildInfo)
 
 void Settings::DeleteAllChildInfo(void)
 {
-    Error error = Get<SettingsDriver>().Delete(kKeyChildInfo);
+    Error error;
+
+    Flush();
+
+    error = Get<SettingsDriver>().Delete(kKeyChildInfo);
 
     Log(kActionDeleteAll, error, kKeyChildInfo);
 }
@@ -275,6 +310,8 @@ Error Settings::ChildInfoIterator::Delete(void)
     Error error = kErrorNone;
 
     VerifyOrExit(!mIsDone, error = kErrorInvalidState);
+
+    Get<Settings>().Flush();
     SuccessOrExit(error = Get<SettingsDriver>().Delete(kKeyChildInfo, mIndex));
 
 exit:
@@ -305,6 +342,8 @@ Error Settings::AddOrUpdateBrOnLinkPrefix(const BrOnLinkPrefix &aBrOnLinkPrefix)
     BrOnLinkPrefix brPrefix;
     bool           didUpdate = false;
 
+    Flush();
+
     while (ReadBrOnLinkPrefix(index, brPrefix) == kErrorNone)
     {
         if (brPrefix.GetPrefix() == aBrOnLinkPrefix.GetPrefix())
@@ -335,6 +374,8 @@ void Settings::RemoveBrOnLinkPrefix(const Ip6::Prefix &aPrefix)
 {
     BrOnLinkPrefix brPrefix;
 
+    Flush();
+
     for (int index = 0; ReadBrOnLinkPrefix(index, brPrefix) == kErrorNone; index++)
     {
         if (brPrefix.GetPrefix() == aPrefix)
@@ -346,7 +387,11 @@ void Settings::RemoveBrOnLinkPrefix(const Ip6::Prefix &aPrefix)
     }
 }
 
-void Settings::DeleteAllBrOnLinkPrefixes(void) { IgnoreError(Get<SettingsDriver>().Delete(kKeyBrOnLinkPrefixes)); }
+void Settings::DeleteAllBrOnLinkPrefixes(void)
+{
+    Flush();
+    IgnoreError(Get<SettingsDriver>().Delete(kKeyBrOnLinkPrefixes));
+}
 
 Error Settings::ReadBrOnLinkPrefix(int aIndex, BrOnLinkPrefix &aBrOnLinkPrefix)
 {
@@ -372,7 +417,20 @@ Error Settings::ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const
     Error    error;
     uint16_t length = aMaxLength;
 
-    error = Get<SettingsDriver>().Get(aKey, aValue, &length);
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    const PendingWrite *pendingWrite = FindPendingWrite(aKey);
+
+    if (pendingWrite != nullptr)
+    {
+        memcpy(aValue, pendingWrite->mValue, Min(length, pendingWrite->mLength));
+        error = kErrorNone;
+    }
+    else
+#endif
+    {
+        error = Get<SettingsDriver>().Get(aKey, aValue, &length);
+    }
+
     Log(kActionRead, error, aKey, aValue);
 
     return error;
@@ -383,29 +441,229 @@ void Settings::SaveEntry(Key aKey, const void *aValue, void *aPrev, uint16_t aLe
     Error    error      = kErrorNone;
     uint16_t readLength = aLength;
     Action   action     = kActionSave;
+    bool     hasPrev;
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    const PendingWrite *pendingWrite = FindPendingWrite(aKey);
 
-    if ((Get<SettingsDriver>().Get(aKey, aPrev, &readLength) == kErrorNone) && (readLength == aLength) &&
-        (memcmp(aValue, aPrev, aLength) == 0))
+    if (pendingWrite != nullptr)
+    {
+        // A queued write is the effective current value of `aKey`.
+
+        readLength = pendingWrite->mLength;
+        memcpy(aPrev, pendingWrite->mValue, Min(readLength, aLength));
+        hasPrev = true;
+    }
+    else
+#endif
+    {
+        hasPrev = (Get<SettingsDriver>().Get(aKey, aPrev, &readLength) == kErrorNone);
+    }
+
+    hasPrev = hasPrev && (readLength == aLength);
+
+    if (hasPrev && (memcmp(aValue, aPrev, aLength) == 0))
     {
         action = kActionResave;
     }
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    else if (QueueWrite(aKey, aValue, hasPrev ? aPrev : nullptr, aLength))
+    {
+        // Saved (and logged) later from `Flush()`.
+        ExitNow();
+    }
+#endif
     else
     {
+        // Queued writes are flushed first so the store always sees
+        // entries in the order they were saved.
+        Flush();
         error = Get<SettingsDriver>().Set(aKey, aValue, aLength);
     }
 
     Log(action, error, aKey, aValue);
 
     SuccessOrAssert(error);
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+exit:
+#endif
+    return;
 }
 
 void Settings::DeleteEntry(Key aKey)
 {
-    Error error = Get<SettingsDriver>().Delete(aKey);
+    Error error;
+
+    Flush();
+
+    error = Get<SettingsDriver>().Delete(aKey);
 
     Log(kActionDelete, error, aKey);
 }
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+void Settings::Flush(void)
+{
+    mWriteBehindTimer.Stop();
+
+    for (uint8_t i = 0; i < mNumPendingWrites; i++)
+    {
+        const PendingWrite &pendingWrite = mPendingWrites[i];
+        Error               error;
+
+        error = Get<SettingsDriver>().Set(pendingWrite.mKey, pendingWrite.mValue, pendingWrite.mLength);
+
+        mWriteBehindCounters.mFlushedWrites++;
+        Log(kActionSave, error, pendingWrite.mKey, pendingWrite.mValue);
+
+        SuccessOrAssert(error);
+    }
+
+    mNumPendingWrites = 0;
+}
+
+void Settings::DiscardPendingWrites(void)
+{
+    mWriteBehindTimer.Stop();
+    mNumPendingWrites = 0;
+}
+
+const Settings::PendingWrite *Settings::FindPendingWrite(Key aKey) const
+{
+    const PendingWrite *match = nullptr;
+
+    for (uint8_t i = 0; i < mNumPendingWrites; i++)
+    {
+        if (mPendingWrites[i].mKey == aKey)
+        {
+            match = &mPendingWrites[i];
+            break;
+        }
+    }
+
+    return match;
+}
+
+bool Settings::QueueWrite(Key aKey, const void *aValue, const void *aPrev, uint16_t aLength)
+{
+    bool          queued = false;
+    PendingWrite *pendingWrite;
+
+    VerifyOrExit(aLength <= kMaxPendingLength);
+    VerifyOrExit(CanDeferWrite(aKey, aValue, aPrev));
+
+    pendingWrite = AsNonConst(FindPendingWrite(aKey));
+
+    if ((pendingWrite != nullptr) && HasDependentWriteAfter(*pendingWrite))
+    {
+        // Coalescing into the existing slot would move this write ahead
+        // of a dependent key queued after it, so flush the queue and
+        // start a new slot instead.
+
+        Flush();
+        pendingWrite = nullptr;
+    }
+
+    if (pendingWrite != nullptr)
+    {
+        mWriteBehindCounters.mCoalescedWrites++;
+    }
+    else
+    {
+        if (mNumPendingWrites == kMaxPendingWrites)
+        {
+            Flush();
+        }
+
+        pendingWrite       = &mPendingWrites[mNumPendingWrites++];
+        pendingWrite->mKey = aKey;
+    }
+
+    pendingWrite->mLength = aLength;
+    memcpy(pendingWrite->mValue, aValue, aLength);
+
+    mWriteBehindCounters.mQueuedWrites++;
+
+    if (!mWriteBehindTimer.IsRunning())
+    {
+        mWriteBehindTimer.Start(kWriteBehindWindow);
+    }
+
+    queued = true;
+
+exit:
+    return queued;
+}
+
+bool Settings::HasDependentWriteAfter(const PendingWrite &aPendingWrite) const
+{
+    bool hasDependent = false;
+
+    for (const PendingWrite *pendingWrite = &aPendingWrite + 1; pendingWrite < &mPendingWrites[mNumPendingWrites];
+         pendingWrite++)
+    {
+        if (AreDependentKeys(aPendingWrite.mKey, pendingWrite->mKey))
+        {
+            hasDependent = true;
+            break;
+        }
+    }
+
+    return hasDependent;
+}
+
+bool Settings::CanDeferWrite(Key aKey, const void *aValue, const void *aPrev)
+{
+    bool canDefer = false;
+
+    switch (aKey)
+    {
+    case kKeyNetworkInfo:
+    {
+        // Key sequence and frame counters must reach the store before
+        // they are used so a reboot never reuses a nonce. Only saves
+        // that leave them unchanged are deferred.
+
+        const NetworkInfo *info = static_cast<const NetworkInfo *>(aValue);
+        const NetworkInfo *prev = static_cast<const NetworkInfo *>(aPrev);
+
+        canDefer = (prev != nullptr) && (info->GetKeySequence() == prev->GetKeySequence()) &&
+                   (info->GetMleFrameCounter() == prev->GetMleFrameCounter()) &&
+                   (info->GetMacFrameCounter() == prev->GetMacFrameCounter());
+        break;
+    }
+
+    case kKeyParentInfo:
+    case kKeySrpClientInfo:
+    case kKeySrpServerInfo:
+        canDefer = true;
+        break;
+
+    default:
+        // All other keys are written through. This includes the
+        // identity keys (SLAAC IID secret, BR ULA prefix, Border Agent
+        // ID): they are generated once and values derived from them
+        // are advertised right away, so a reset before a flush must
+        // not bring the device back with a different identity.
+        break;
+    }
+
+    return canDefer;
+}
+
+bool Settings::AreDependentKeys(Key aFirstKey, Key aSecondKey)
+{
+    // `ParentInfo` is only meaningful together with the `NetworkInfo`
+    // (role, RLOC16) it was saved with.
+
+    return ((aFirstKey == kKeyNetworkInfo) && (aSecondKey == kKeyParentInfo)) ||
+           ((aFirstKey == kKeyParentInfo) && (aSecondKey == kKeyNetworkInfo));
+}
+
+#endif // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
 void Settings::Log(Action aAction, Error aError, Key aKey, const void *aValue)
 {
     OT_UNUSED_VARIABLE(aAction);
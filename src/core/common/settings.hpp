@@ -45,6 +45,7 @@
 #include "common/log.hpp"
 #include "common/non_copyable.hpp"
 #include "common/settings_driver.hpp"
+#include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/border_agent.hpp"
@@ -715,7 +716,14 @@ public:
      */
     explicit Settings(Instance &aInstance)
         : SettingsBase(aInstance)
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        , mNumPendingWrites(0)
+        , mWriteBehindTimer(aInstance)
+#endif
     {
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        mWriteBehindCounters.Clear();
+#endif
     }
 
     /**
@@ -734,9 +742,42 @@ public:
 
     /**
      * Removes all settings from the non-volatile store.
+     *
+     * Any queued (write-behind) writes are discarded.
      */
     void Wipe(void);
 
+    /**
+     * Writes all queued (write-behind) saves to the non-volatile store.
+     *
+     * Queued saves are written in the order their keys were first queued. Does nothing if
+     * `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE` is disabled.
+     */
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    void Flush(void);
+#else
+    void Flush(void) {}
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    /**
+     * Represents the write-behind counters.
+     */
+    struct WriteBehindCounters : public Clearable<WriteBehindCounters>
+    {
+        uint32_t mQueuedWrites;    ///< Number of saves queued (not written through).
+        uint32_t mCoalescedWrites; ///< Number of queued saves replacing an earlier queued save of the same key.
+        uint32_t mFlushedWrites;   ///< Number of queued saves written to the non-volatile store.
+    };
+
+    /**
+     * Gets the write-behind counters.
+     *
+     * @returns The write-behind counters.
+     */
+    const WriteBehindCounters &GetWriteBehindCounters(void) const { return mWriteBehindCounters; }
+#endif
+
     /**
      * Saves the Operational Dataset (active or pending).
      *
@@ -1087,7 +1128,38 @@ private:
 
     static void Log(Action aAction, Error aError, Key aKey, const void *aValue = nullptr);
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    static constexpr uint8_t  kMaxPendingWrites = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_ENTRIES;
+    static constexpr uint16_t kMaxPendingLength = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_VALUE_SIZE;
+    static constexpr uint32_t kWriteBehindWindow = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW;
+
+    struct PendingWrite
+    {
+        Key      mKey;
+        uint16_t mLength;
+        uint8_t  mValue[kMaxPendingLength];
+    };
+
+    const PendingWrite *FindPendingWrite(Key aKey) const;
+    bool                QueueWrite(Key aKey, const void *aValue, const void *aPrev, uint16_t aLength);
+    bool                HasDependentWriteAfter(const PendingWrite &aPendingWrite) const;
+    void                DiscardPendingWrites(void);
+    void                HandleWriteBehindTimer(void) { Flush(); }
+
+    static bool CanDeferWrite(Key aKey, const void *aValue, const void *aPrev);
+    static bool AreDependentKeys(Key aFirstKey, Key aSecondKey);
+
+    using WriteBehindTimer = TimerMilliIn<Settings, &Settings::HandleWriteBehindTimer>;
+#endif
+
     static const uint16_t kSensitiveKeys[];
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    uint8_t             mNumPendingWrites;
+    PendingWrite        mPendingWrites[kMaxPendingWrites];
+    WriteBehindTimer    mWriteBehindTimer;
+    WriteBehindCounters mWriteBehindCounters;
+#endif
 };
 
 } // namespace ot
@@ -138,6 +138,18 @@
 #define OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CACHE_SIZE
+ *
+ * Specifies the number of entries in the cache of reachability check results, keyed by the source /64 prefix and the
+ * destination address of forwarded messages.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CACHE_SIZE
+#define OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CACHE_SIZE 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_BORDER_ROUTING_MAX_DISCOVERED_ROUTERS
  *
@@ -148,6 +148,21 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD (0xffff * 14 / 100)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS
+ *
+ * Define to 1 to have Channel Manager compare channels by their estimated retransmission cost instead of only the
+ * averaged channel occupancy.
+ *
+ * The cost of a channel is the larger of its occupancy and the 90th percentile of its busy ratio over the Channel
+ * Monitor time buckets, so that a channel which is quiet on average but busy during some periods is penalized.
+ *
+ * Requires `OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE`.
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS 0
+#endif
+
 /**
  * @}
  */
@@ -110,6 +110,32 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW 960
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+ *
+ * Define to 1 to enable detailed per-channel statistics (RSSI histogram and busy ratio per time bucket) in Channel
+ * Monitor.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE` is set).
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_BUCKET_INTERVAL
+ *
+ * The interval in milliseconds covered by each busy ratio time bucket in the per-channel statistics.
+ *
+ * The buckets form a ring of `OT_CHANNEL_MONITOR_NUM_TIME_BUCKETS` entries. With the default one hour interval the
+ * ring covers the last day split by hour.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE` is set.
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_BUCKET_INTERVAL
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_BUCKET_INTERVAL (60 * 60 * 1000)
+#endif
+
 /**
  * @}
  */
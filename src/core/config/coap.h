@@ -54,6 +54,32 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSE_BUFFERS
+ *
+ * Maximum number of message buffers used by cached responses for CoAP Confirmable messages.
+ *
+ * When adding a new response would exceed this limit (or `OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES`), the
+ * cached responses with the earliest expiration time are evicted first.
+ *
+ * Zero (the default) disables the buffer limit so only the number of cached responses is bounded.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSE_BUFFERS
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS
+ *
+ * Maximum number of pending CoAP requests tracked by the hash indexes used to match received responses.
+ *
+ * Requests beyond this number are still tracked, but while any such request is pending, matching falls back to a
+ * linear search over all pending requests.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
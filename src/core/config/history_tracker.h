@@ -126,6 +126,33 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE
+ *
+ * Specifies the maximum number of entries in the aggregated RX/TX flow history list.
+ *
+ * A flow entry keeps the message and byte counters of all RX or TX messages with the same source, destination,
+ * IP protocol, ports and neighbor within one time bucket (see `OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL`)
+ * so it covers a much longer time than the per-message RX and TX lists with the same memory.
+ *
+ * Can be set to zero to configure History Tracker module not to collect any flow history.
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL
+ *
+ * Specifies the duration (in msec) of a time bucket in the aggregated RX/TX flow history list.
+ *
+ * Messages of the same flow are counted in one entry until the bucket ends, after which a new entry is added for the
+ * flow on its next message.
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL (5 * 60 * 1000)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_EXCLUDE_THREAD_CONTROL_MESSAGES
  *
@@ -245,6 +272,19 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_AIL_ROUTER_LIST_SIZE 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+ *
+ * Define as 1 to additionally pass every new History Tracker entry to the platform through
+ * `otPlatHistoryTrackerSaveEntry()`.
+ *
+ * This allows a platform to keep a persistent (and typically much deeper) copy of the history lists, independent of
+ * the in-RAM list sizes configured above.
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE 0
+#endif
+
 /**
  * @}
  */
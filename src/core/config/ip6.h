@@ -216,6 +216,18 @@
 #define OPENTHREAD_CONFIG_TCP_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TCP_RTT_GRADIENT_CC_DEFAULT
+ *
+ * Define as 1 to have new TCP endpoints use the RTT-gradient congestion control algorithm instead of New Reno.
+ *
+ * The RTT-gradient algorithm does not reduce the congestion window on losses that occur while the RTT is not
+ * increasing, which suits multi-hop paths where most losses are link-layer losses rather than congestion.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_RTT_GRADIENT_CC_DEFAULT
+#define OPENTHREAD_CONFIG_TCP_RTT_GRADIENT_CC_DEFAULT 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TLS_ENABLE
  *
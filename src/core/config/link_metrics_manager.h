@@ -61,6 +61,28 @@
 #define OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ON_BY_DEFAULT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_DEFAULT_BATCH_SIZE
+ *
+ * The default maximum number of Link Metrics Management Requests sent by Link Metrics Manager per batch slot.
+ *
+ * When non-zero, subjects that need (re)configuration are queued and at most this many requests are sent every
+ * `OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_BATCH_SLOT_INTERVAL`, spreading the MLE traffic instead of sending a request
+ * to every neighbor at once. Zero disables batching.
+ */
+#ifndef OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_DEFAULT_BATCH_SIZE
+#define OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_DEFAULT_BATCH_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_BATCH_SLOT_INTERVAL
+ *
+ * The batch slot interval in milliseconds used by Link Metrics Manager when batching is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_BATCH_SLOT_INTERVAL
+#define OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_BATCH_SLOT_INTERVAL 2000
+#endif
+
 /**
  * @}
  */
@@ -65,6 +65,28 @@
 #define OPENTHREAD_CONFIG_MESH_DIAG_RESPONSE_TIMEOUT 5000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_CONCURRENCY
+ *
+ * Specifies the default maximum number of routers queried concurrently during topology discovery.
+ *
+ * A new query is sent as soon as an earlier one is answered or times out, so the discovery is pipelined while the
+ * number of outstanding responses (and the resulting traffic burst) stays bounded.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_CONCURRENCY
+#define OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_CONCURRENCY 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_MAX_RETRIES
+ *
+ * Specifies the default maximum number of times a query to a router is re-sent during topology discovery when no
+ * response is received within the response timeout. MUST NOT be larger than `OT_MESH_DIAG_MAX_DISCOVER_RETRIES` (10).
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_MAX_RETRIES
+#define OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_MAX_RETRIES 1
+#endif
+
 /**
  * @}
  */
@@ -413,6 +413,54 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+ *
+ * Define to 1 to enable a write-behind layer for settings.
+ *
+ * When enabled, saves of single-value settings entries (e.g., `NetworkInfo`, `ParentInfo`, `SrpClientInfo`) are
+ * queued and written to the non-volatile store after `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW`. Repeated saves
+ * of the same key within the window are coalesced into a single write. Writes that must be durable immediately (e.g.,
+ * frame counter or key sequence updates, sensitive keys, identity keys such as the BR ULA prefix) are always written
+ * through.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW
+ *
+ * Specifies the maximum time in milliseconds a queued settings write is delayed before being flushed.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_ENTRIES
+ *
+ * Specifies the maximum number of distinct settings keys with a queued write. The queue is flushed when full.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_VALUE_SIZE
+ *
+ * Specifies the maximum size in bytes of a settings value that can be queued. Larger values are written through.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_VALUE_SIZE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_MAX_VALUE_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -611,6 +659,18 @@
 #define OPENTHREAD_ENABLE_VENDOR_EXTENSION 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+ *
+ * Define as 1 to enable slicing-by-8 table-driven CRC computation in `CrcCalculator`.
+ *
+ * When enabled, CRC16-CCITT, CRC16-ANSI and CRC32-ANSI are computed eight bytes at a time using pre-computed lookup
+ * tables (about 16 KB of constant data). Other polynomials use the bit-wise computation.
+ */
+#ifndef OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+#define OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_EXAMPLES_SIMULATION
  *
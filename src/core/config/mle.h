@@ -64,6 +64,57 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE
+ *
+ * Define as 1 to use a compact representation for the set of children in the metadata of each message (used for
+ * indirect transmission to sleepy children).
+ *
+ * When enabled, small sets are stored as a list of child indexes (up to
+ * `OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE` entries) and larger sets spill to a heap-allocated bit-set.
+ * Otherwise, a bit-set sized by `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN` is kept in every message. Enabling this is
+ * recommended when `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN` is large (e.g., on a host-based FTD).
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE
+ *
+ * The number of child indexes stored inline in a compact child mask before it spills to a heap-allocated bit-set.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE
+#define OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_RX_TLV_INDEX_SIZE
+ *
+ * The maximum number of TLVs indexed when an MLE message is received.
+ *
+ * TLV lookups on a received MLE message use the index built when the message is received. Lookups for TLVs beyond
+ * this limit fall back to scanning the message.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_RX_TLV_INDEX_SIZE
+#define OPENTHREAD_CONFIG_MLE_RX_TLV_INDEX_SIZE 24
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE
+ *
+ * The maximum number of neighboring routers with a pending route update.
+ *
+ * Route updates from received MLE Advertisements are coalesced and processed together from a tasklet. If a route
+ * update is received from a new neighbor while the maximum number of updates are pending, the pending ones are
+ * processed immediately.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE
+#define OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
@@ -68,6 +68,33 @@
      OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_JOINER_ENABLE || OPENTHREAD_CONFIG_BLE_TCAT_ENABLE)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE
+ *
+ * The maximum number of sessions kept in the server-side DTLS/TLS session cache of a `SecureTransport`.
+ *
+ * When non-zero, a server (e.g., the Border Agent) remembers recently established sessions by their session ID, so
+ * that a reconnecting peer can resume a session with an abbreviated handshake instead of a full EC-JPAKE handshake.
+ * A client likewise remembers its last session and offers it when reconnecting to the same peer. Cached sessions are
+ * dropped whenever the PSK or credentials change or the transport is closed. Set to zero to disable the cache.
+ */
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_TIMEOUT
+ *
+ * The lifetime (in seconds) of a session in the DTLS/TLS session cache.
+ *
+ * A cached session can only be resumed within this time from the full handshake that established it. Resuming a
+ * session does not extend its lifetime. Only applicable when `OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE`
+ * is non-zero.
+ */
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_TIMEOUT
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_TIMEOUT 600
+#endif
+
 /**
  * @}
  */
@@ -443,7 +443,14 @@ Instance *Instance::GetActiveInstance(void) { return gActiveInstance; }
 
 #endif // OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
 
-void Instance::Reset(void) { otPlatReset(this); }
+void Instance::Reset(void)
+{
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    Get<Settings>().Flush();
+#endif
+
+    otPlatReset(this);
+}
 
 #if OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE
 Error Instance::ResetToBootloader(void) { return otPlatResetToBootloader(this); }
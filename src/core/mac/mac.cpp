@@ -2565,7 +2565,7 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
             csl->GetPhase(), neighbor->GetCslPhase());
 
 #if OPENTHREAD_FTD
-    Get<CslTxScheduler>().Update();
+    Get<CslTxScheduler>().Update(*static_cast<Child *>(neighbor));
 #endif
 
 exit:
@@ -556,6 +556,16 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_BORDER_AGENT_COMMISSIONER_EVICTION_API_ENABLE
 
+const Manager::Counters &Manager::GetCounters(void)
+{
+    const SecureTransport::HandshakeCounters &handshakeCounters = mDtlsTransport.GetHandshakeCounters();
+
+    mCounters.mPskcFullHandshakes    = handshakeCounters.mFullHandshakes;
+    mCounters.mPskcResumedHandshakes = handshakeCounters.mResumedHandshakes;
+
+    return mCounters;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Manager::SessionIterator
 
@@ -259,7 +259,7 @@ public:
      *
      * @returns The border agent counters.
      */
-    const Counters &GetCounters(void) { return mCounters; }
+    const Counters &GetCounters(void);
 
 private:
     static constexpr uint16_t kUdpPort          = OPENTHREAD_CONFIG_BORDER_AGENT_UDP_PORT;
@@ -47,6 +47,26 @@ namespace MeshCoP {
 
 RegisterLogModule("SecTransport");
 
+//---------------------------------------------------------------------------------------------------------------------
+// SslConfig
+
+SslConfig::SslConfig(bool aIsServer)
+    : mIsServer(aIsServer)
+{
+    mbedtls_ssl_config_init(&mConf);
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
+    mbedtls_ssl_cookie_init(&mCookieCtx);
+#endif
+}
+
+SslConfig::~SslConfig(void)
+{
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
+    mbedtls_ssl_cookie_free(&mCookieCtx);
+#endif
+    mbedtls_ssl_config_free(&mConf);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // SecureSession
 
@@ -60,6 +80,7 @@ void SecureSession::Init(void)
 {
     mTimerSet       = false;
     mIsServer       = false;
+    mIsResumed      = false;
     mState          = kStateDisconnected;
     mMessageSubType = Message::kSubTypeNone;
     mConnectEvent   = kDisconnectedError;
@@ -68,28 +89,12 @@ void SecureSession::Init(void)
 
     MarkAsNotUsed();
     ClearAllBytes(mSsl);
-    ClearAllBytes(mConf);
-#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
-    ClearAllBytes(mCookieCtx);
-#endif
 }
 
 void SecureSession::FreeMbedtls(void)
 {
-#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
-    if (mTransport.mDatagramTransport)
-    {
-        mbedtls_ssl_cookie_free(&mCookieCtx);
-    }
-#endif
-#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
-    if (mTransport.mExtension != nullptr)
-    {
-        mTransport.mExtension->mEcdheEcdsaInfo.Free();
-    }
-#endif
-    mbedtls_ssl_config_free(&mConf);
     mbedtls_ssl_free(&mSsl);
+    mConfig.Reset();
 }
 
 void SecureSession::SetState(State aState)
@@ -175,129 +180,14 @@ Error SecureSession::Setup(void)
 
     mTransport.DecremenetRemainingConnectionAttempts();
 
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Setup the mbedtls_ssl_config `mConf`.
-
-    mbedtls_ssl_config_init(&mConf);
-
-    rval = mbedtls_ssl_config_defaults(&mConf, mIsServer ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
-                                       mTransport.mDatagramTransport ? MBEDTLS_SSL_TRANSPORT_DATAGRAM
-                                                                     : MBEDTLS_SSL_TRANSPORT_STREAM,
-                                       MBEDTLS_SSL_PRESET_DEFAULT);
-    VerifyOrExit(rval == 0);
-
-#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
-    if (mTransport.mVerifyPeerCertificate &&
-        (mTransport.mCipherSuite == SecureTransport::kEcdheEcdsaWithAes128Ccm8 ||
-         mTransport.mCipherSuite == SecureTransport::kEcdheEcdsaWithAes128GcmSha256))
-    {
-        mbedtls_ssl_conf_authmode(&mConf, MBEDTLS_SSL_VERIFY_REQUIRED);
-    }
-    else
-    {
-        mbedtls_ssl_conf_authmode(&mConf, MBEDTLS_SSL_VERIFY_NONE);
-    }
-#endif
-
-#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
-    mbedtls_ssl_conf_rng(&mConf, Crypto::MbedTls::CryptoSecurePrng, nullptr);
-#endif
-#if (MBEDTLS_VERSION_NUMBER >= 0x03020000)
-    mbedtls_ssl_conf_min_tls_version(&mConf, MBEDTLS_SSL_VERSION_TLS1_2);
-    mbedtls_ssl_conf_max_tls_version(&mConf, MBEDTLS_SSL_VERSION_TLS1_2);
-#else
-    mbedtls_ssl_conf_min_version(&mConf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
-    mbedtls_ssl_conf_max_version(&mConf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
-#endif
-
-    {
-        // We use `kCipherSuites[mCipherSuite]` to look up the cipher
-        // suites array to pass to `mbedtls_ssl_conf_ciphersuites()`
-        // associated with `mCipherSuite`. We validate that the `enum`
-        // values are correct and match the order in the `kCipherSuites[]`
-        // array.
-
-        struct EnumCheck
-        {
-            InitEnumValidatorCounter();
-            ValidateNextEnum(SecureTransport::kEcjpakeWithAes128Ccm8);
-#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_PSK_ENABLED)
-            ValidateNextEnum(SecureTransport::kPskWithAes128Ccm8);
-#endif
-#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
-            ValidateNextEnum(SecureTransport::kEcdheEcdsaWithAes128Ccm8);
-            ValidateNextEnum(SecureTransport::kEcdheEcdsaWithAes128GcmSha256);
-#endif
-        };
-
-        mbedtls_ssl_conf_ciphersuites(&mConf, SecureTransport::kCipherSuites[mTransport.mCipherSuite]);
-    }
-
-    if (mTransport.mCipherSuite == SecureTransport::kEcjpakeWithAes128Ccm8)
-    {
-#if (MBEDTLS_VERSION_NUMBER >= 0x03010000)
-        mbedtls_ssl_conf_groups(&mConf, SecureTransport::kGroups);
-#else
-        mbedtls_ssl_conf_curves(&mConf, SecureTransport::kCurves);
-#endif
-#if defined(MBEDTLS_KEY_EXCHANGE__WITH_CERT__ENABLED) || defined(MBEDTLS_KEY_EXCHANGE_WITH_CERT_ENABLED)
-#if (MBEDTLS_VERSION_NUMBER >= 0x03020000)
-        mbedtls_ssl_conf_sig_algs(&mConf, SecureTransport::kSignatures);
-#else
-        mbedtls_ssl_conf_sig_hashes(&mConf, SecureTransport::kHashes);
-#endif
-#endif
-    }
-
-#if (MBEDTLS_VERSION_NUMBER < 0x03000000)
-    mbedtls_ssl_conf_export_keys_cb(&mConf, SecureTransport::HandleMbedtlsExportKeys, &mTransport);
-#endif
-
-    mbedtls_ssl_conf_handshake_timeout(&mConf, 8000, 60000);
-    mbedtls_ssl_conf_dbg(&mConf, SecureTransport::HandleMbedtlsDebug, &mTransport);
-
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Setup the `Extension` components.
-
-#if OPENTHREAD_CONFIG_TLS_API_ENABLE
-    if (mTransport.mExtension != nullptr)
-    {
-#if defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
-        mTransport.mExtension->mEcdheEcdsaInfo.Init();
-#endif
-        rval = mTransport.mExtension->SetApplicationSecureKeys(mConf);
-        VerifyOrExit(rval == 0);
-    }
-#endif
-
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Setup the mbedtls_ssl_cookie_ctx `mCookieCtx`.
-
-#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
-    if (mTransport.mDatagramTransport)
-    {
-        mbedtls_ssl_cookie_init(&mCookieCtx);
-
-        if (mIsServer)
-        {
-#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
-            rval = mbedtls_ssl_cookie_setup(&mCookieCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr);
-#else
-            rval = mbedtls_ssl_cookie_setup(&mCookieCtx);
-#endif
-            VerifyOrExit(rval == 0);
-
-            mbedtls_ssl_conf_dtls_cookies(&mConf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, &mCookieCtx);
-        }
-    }
-#endif
+    SuccessOrExit(error = mTransport.SetupConfig(*this));
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Setup the mbedtls_ssl_context `mSsl`.
 
     mbedtls_ssl_init(&mSsl);
 
-    rval = mbedtls_ssl_setup(&mSsl, &mConf);
+    rval = mbedtls_ssl_setup(&mSsl, &mConfig->mConf);
     VerifyOrExit(rval == 0);
 
     mbedtls_ssl_set_bio(&mSsl, this, HandleMbedtlsTransmit, HandleMbedtlsReceive, /* RecvTimeoutFn */ nullptr);
@@ -324,6 +214,13 @@ Error SecureSession::Setup(void)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+    if (!mIsServer)
+    {
+        mTransport.ApplyClientSession(*this);
+    }
+#endif
+
     mReceiveMessage = nullptr;
     mMessageSubType = Message::kSubTypeNone;
 
@@ -530,10 +427,37 @@ void SecureSession::Process(void)
     {
         if (IsConnecting())
         {
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+            mTransport.mSessionCacheHit = false;
+            rval                        = mbedtls_ssl_handshake(&mSsl);
+
+            if (mTransport.mSessionCacheHit)
+            {
+                mIsResumed = true;
+            }
+#else
             rval = mbedtls_ssl_handshake(&mSsl);
+#endif
 
             if (IsMbedtlsHandshakeOver(&mSsl))
             {
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+                if (!mIsServer && mTransport.SaveClientSession(*this))
+                {
+                    mIsResumed = true;
+                }
+#endif
+
+                if (mIsResumed)
+                {
+                    mTransport.mHandshakeCounters.mResumedHandshakes++;
+                }
+                else
+                {
+                    mTransport.mHandshakeCounters.mFullHandshakes++;
+                }
+
+                LogInfo("Handshake completed (%s)", mIsResumed ? "resumed" : "full");
                 SetState(kStateConnected);
                 mConnectEvent = kConnected;
                 mConnectedCallback.InvokeIfSet(mConnectEvent);
@@ -602,6 +526,7 @@ void SecureSession::Process(void)
         else if (shouldReset)
         {
             mbedtls_ssl_session_reset(&mSsl);
+            mIsResumed = false;
 
             if (mTransport.mCipherSuite == SecureTransport::kEcjpakeWithAes128Ccm8)
             {
@@ -677,9 +602,427 @@ SecureTransport::SecureTransport(Instance &aInstance, LinkSecurityMode aLayerTwo
 #endif
 {
     ClearAllBytes(mPsk);
+    mHandshakeCounters.Clear();
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    mSessionCacheHit = false;
+    mbedtls_ssl_cache_init(&mSessionCache);
+    mbedtls_ssl_cache_set_max_entries(&mSessionCache, OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE);
+    ClearAllBytes(mCachedSessionIds);
+#endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+    mHasClientSession = false;
+    mClientSessionExpireTime.SetValue(0);
+    mbedtls_ssl_session_init(&mClientSession);
+#endif
     OT_UNUSED_VARIABLE(mVerifyPeerCertificate);
 }
 
+Error SecureTransport::SetupConfig(SecureSession &aSession)
+{
+    // Sessions of the same role (client or server) share the current
+    // `SslConfig`. A new one is built when there is none (e.g., after
+    // the cipher suite, keys or auth mode changed) or when it was
+    // built for the other role. A session still using an older config
+    // keeps it alive through its own reference until it is freed.
+
+    Error error = kErrorNone;
+
+    if (mConfig.IsNull() || (mConfig->mIsServer != aSession.mIsServer))
+    {
+        SuccessOrExit(error = BuildConfig(aSession.mIsServer));
+    }
+
+    aSession.mConfig = mConfig;
+
+exit:
+    return error;
+}
+
+Error SecureTransport::BuildConfig(bool aIsServer)
+{
+    Error               error = kErrorNone;
+    int                 rval  = 0;
+    SslConfig          *config;
+    mbedtls_ssl_config *conf;
+
+    config = SslConfig::Allocate(aIsServer);
+    VerifyOrExit(config != nullptr, error = kErrorNoBufs);
+
+    mConfig.Reset(config);
+    conf = &config->mConf;
+
+    rval = mbedtls_ssl_config_defaults(conf, aIsServer ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
+                                       mDatagramTransport ? MBEDTLS_SSL_TRANSPORT_DATAGRAM
+                                                          : MBEDTLS_SSL_TRANSPORT_STREAM,
+                                       MBEDTLS_SSL_PRESET_DEFAULT);
+    VerifyOrExit(rval == 0);
+
+#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+    if (mVerifyPeerCertificate &&
+        (mCipherSuite == kEcdheEcdsaWithAes128Ccm8 || mCipherSuite == kEcdheEcdsaWithAes128GcmSha256))
+    {
+        mbedtls_ssl_conf_authmode(conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    }
+    else
+    {
+        mbedtls_ssl_conf_authmode(conf, MBEDTLS_SSL_VERIFY_NONE);
+    }
+#endif
+
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+    mbedtls_ssl_conf_rng(conf, Crypto::MbedTls::CryptoSecurePrng, nullptr);
+#endif
+#if (MBEDTLS_VERSION_NUMBER >= 0x03020000)
+    mbedtls_ssl_conf_min_tls_version(conf, MBEDTLS_SSL_VERSION_TLS1_2);
+    mbedtls_ssl_conf_max_tls_version(conf, MBEDTLS_SSL_VERSION_TLS1_2);
+#else
+    mbedtls_ssl_conf_min_version(conf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+    mbedtls_ssl_conf_max_version(conf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+#endif
+
+    {
+        // We use `kCipherSuites[mCipherSuite]` to look up the cipher
+        // suites array to pass to `mbedtls_ssl_conf_ciphersuites()`
+        // associated with `mCipherSuite`. We validate that the `enum`
+        // values are correct and match the order in the `kCipherSuites[]`
+        // array.
+
+        struct EnumCheck
+        {
+            InitEnumValidatorCounter();
+            ValidateNextEnum(kEcjpakeWithAes128Ccm8);
+#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_PSK_ENABLED)
+            ValidateNextEnum(kPskWithAes128Ccm8);
+#endif
+#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+            ValidateNextEnum(kEcdheEcdsaWithAes128Ccm8);
+            ValidateNextEnum(kEcdheEcdsaWithAes128GcmSha256);
+#endif
+        };
+
+        mbedtls_ssl_conf_ciphersuites(conf, kCipherSuites[mCipherSuite]);
+    }
+
+    if (mCipherSuite == kEcjpakeWithAes128Ccm8)
+    {
+#if (MBEDTLS_VERSION_NUMBER >= 0x03010000)
+        mbedtls_ssl_conf_groups(conf, kGroups);
+#else
+        mbedtls_ssl_conf_curves(conf, kCurves);
+#endif
+#if defined(MBEDTLS_KEY_EXCHANGE__WITH_CERT__ENABLED) || defined(MBEDTLS_KEY_EXCHANGE_WITH_CERT_ENABLED)
+#if (MBEDTLS_VERSION_NUMBER >= 0x03020000)
+        mbedtls_ssl_conf_sig_algs(conf, kSignatures);
+#else
+        mbedtls_ssl_conf_sig_hashes(conf, kHashes);
+#endif
+#endif
+    }
+
+#if (MBEDTLS_VERSION_NUMBER < 0x03000000)
+    mbedtls_ssl_conf_export_keys_cb(conf, HandleMbedtlsExportKeys, this);
+#endif
+
+    mbedtls_ssl_conf_handshake_timeout(conf, 8000, 60000);
+    mbedtls_ssl_conf_dbg(conf, HandleMbedtlsDebug, this);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Setup the `Extension` components.
+
+#if OPENTHREAD_CONFIG_TLS_API_ENABLE
+    if (mExtension != nullptr)
+    {
+        // The `Extension` is only used by single-session transports
+        // (`ApplicationCoapSecure` and `Tls`), so the parsed keys are
+        // not referenced by any config other than the one being built.
+
+        FreeExtensionKeys();
+#if defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+        mExtension->mEcdheEcdsaInfo.Init();
+#endif
+        rval = mExtension->SetApplicationSecureKeys(*conf);
+        VerifyOrExit(rval == 0);
+    }
+#endif
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Setup the mbedtls_ssl_cookie_ctx `mCookieCtx`.
+
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
+    if (mDatagramTransport && aIsServer)
+    {
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+        rval = mbedtls_ssl_cookie_setup(&config->mCookieCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr);
+#else
+        rval = mbedtls_ssl_cookie_setup(&config->mCookieCtx);
+#endif
+        VerifyOrExit(rval == 0);
+
+        mbedtls_ssl_conf_dtls_cookies(conf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, &config->mCookieCtx);
+    }
+#endif
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Setup the server-side session cache.
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    if (aIsServer)
+    {
+        mbedtls_ssl_conf_session_cache(conf, this, HandleMbedtlsSessionCacheGet, HandleMbedtlsSessionCacheSet);
+    }
+#endif
+
+exit:
+    if ((error == kErrorNone) && (rval != 0))
+    {
+        error = Crypto::MbedTls::MapError(rval);
+        mConfig.Reset();
+    }
+
+    return error;
+}
+
+void SecureTransport::InvalidateConfig(void)
+{
+    // Sessions established with the previous parameters must not be
+    // resumed either.
+
+    mConfig.Reset();
+    ClearSessionCache();
+}
+
+void SecureTransport::FreeExtensionKeys(void)
+{
+#if OPENTHREAD_CONFIG_TLS_API_ENABLE && defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+    if (mExtension != nullptr)
+    {
+        mExtension->mEcdheEcdsaInfo.Free();
+    }
+#endif
+}
+
+void SecureTransport::ClearSessionCache(void)
+{
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    mbedtls_ssl_cache_free(&mSessionCache);
+    mbedtls_ssl_cache_init(&mSessionCache);
+    mbedtls_ssl_cache_set_max_entries(&mSessionCache, OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE);
+    ClearAllBytes(mCachedSessionIds);
+#endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+    ClearClientSession();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+
+// `MBEDTLS_HAVE_TIME` is not available on all platforms, so the
+// `mbedtls_ssl_cache_context` only bounds the number of cached
+// sessions. The lifetime of each session is tracked here by its
+// session ID and a lookup is treated as a miss once it expires.
+
+bool SecureTransport::CachedSessionId::Matches(const unsigned char *aId, size_t aLength) const
+{
+    return !IsEmpty() && (mLength == aLength) && (memcmp(mId, aId, aLength) == 0);
+}
+
+void SecureTransport::AddCachedSessionId(const unsigned char *aId, size_t aLength)
+{
+    CachedSessionId *entry = nullptr;
+
+    VerifyOrExit((aLength > 0) && (aLength <= kMaxSessionIdLength));
+
+    // Reuse an entry with the same ID, or an empty one, or else
+    // replace the one that expires first.
+
+    for (CachedSessionId &cachedId : mCachedSessionIds)
+    {
+        if (cachedId.Matches(aId, aLength) || cachedId.IsEmpty())
+        {
+            entry = &cachedId;
+            break;
+        }
+
+        if ((entry == nullptr) || (cachedId.mExpireTime < entry->mExpireTime))
+        {
+            entry = &cachedId;
+        }
+    }
+
+    entry->mLength     = static_cast<uint8_t>(aLength);
+    entry->mExpireTime = TimerMilli::GetNow() + kSessionCacheTimeout;
+    memcpy(entry->mId, aId, aLength);
+
+exit:
+    return;
+}
+
+bool SecureTransport::IsCachedSessionIdValid(const unsigned char *aId, size_t aLength) const
+{
+    bool isValid = false;
+
+    for (const CachedSessionId &cachedId : mCachedSessionIds)
+    {
+        if (cachedId.Matches(aId, aLength))
+        {
+            isValid = (TimerMilli::GetNow() < cachedId.mExpireTime);
+            break;
+        }
+    }
+
+    return isValid;
+}
+
+#if (MBEDTLS_VERSION_NUMBER >= 0x03000000)
+
+int SecureTransport::HandleMbedtlsSessionCacheGet(void                *aContext,
+                                                  const unsigned char *aSessionId,
+                                                  size_t               aSessionIdLength,
+                                                  mbedtls_ssl_session *aSession)
+{
+    SecureTransport *transport = static_cast<SecureTransport *>(aContext);
+    int              rval      = MBEDTLS_ERR_SSL_CACHE_ENTRY_NOT_FOUND;
+
+    VerifyOrExit(transport->IsCachedSessionIdValid(aSessionId, aSessionIdLength));
+
+    rval = mbedtls_ssl_cache_get(&transport->mSessionCache, aSessionId, aSessionIdLength, aSession);
+
+    if (rval == 0)
+    {
+        transport->mSessionCacheHit = true;
+    }
+
+exit:
+    return rval;
+}
+
+int SecureTransport::HandleMbedtlsSessionCacheSet(void                      *aContext,
+                                                  const unsigned char       *aSessionId,
+                                                  size_t                     aSessionIdLength,
+                                                  const mbedtls_ssl_session *aSession)
+{
+    SecureTransport *transport = static_cast<SecureTransport *>(aContext);
+    int              rval;
+
+    rval = mbedtls_ssl_cache_set(&transport->mSessionCache, aSessionId, aSessionIdLength, aSession);
+
+    if (rval == 0)
+    {
+        transport->AddCachedSessionId(aSessionId, aSessionIdLength);
+    }
+
+    return rval;
+}
+
+#else
+
+int SecureTransport::HandleMbedtlsSessionCacheGet(void *aContext, mbedtls_ssl_session *aSession)
+{
+    SecureTransport *transport = static_cast<SecureTransport *>(aContext);
+    int              rval      = 1;
+
+    VerifyOrExit(transport->IsCachedSessionIdValid(aSession->id, aSession->id_len));
+
+    rval = mbedtls_ssl_cache_get(&transport->mSessionCache, aSession);
+
+    if (rval == 0)
+    {
+        transport->mSessionCacheHit = true;
+    }
+
+exit:
+    return rval;
+}
+
+int SecureTransport::HandleMbedtlsSessionCacheSet(void *aContext, const mbedtls_ssl_session *aSession)
+{
+    SecureTransport *transport = static_cast<SecureTransport *>(aContext);
+    int              rval;
+
+    rval = mbedtls_ssl_cache_set(&transport->mSessionCache, aSession);
+
+    if (rval == 0)
+    {
+        transport->AddCachedSessionId(aSession->id, aSession->id_len);
+    }
+
+    return rval;
+}
+
+#endif // (MBEDTLS_VERSION_NUMBER >= 0x03000000)
+
+#endif // OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+
+void SecureTransport::ClearClientSession(void)
+{
+    mbedtls_ssl_session_free(&mClientSession);
+    mbedtls_ssl_session_init(&mClientSession);
+    mHasClientSession = false;
+}
+
+void SecureTransport::ApplyClientSession(SecureSession &aSession)
+{
+    // Offer the last session to the same peer for resumption, as
+    // long as it has not expired.
+
+    VerifyOrExit(mHasClientSession);
+    VerifyOrExit(aSession.mMessageInfo.GetPeerAddr() == mClientSessionPeer.GetAddress());
+    VerifyOrExit(aSession.mMessageInfo.GetPeerPort() == mClientSessionPeer.GetPort());
+
+    if (TimerMilli::GetNow() >= mClientSessionExpireTime)
+    {
+        ClearClientSession();
+        ExitNow();
+    }
+
+    IgnoreReturnValue(mbedtls_ssl_set_session(&aSession.mSsl, &mClientSession));
+
+exit:
+    return;
+}
+
+bool SecureTransport::SaveClientSession(SecureSession &aSession)
+{
+    // Saves the session negotiated by a client handshake and returns
+    // whether it resumed the previously saved one, i.e., whether the
+    // server accepted the offered session ID. A resumed session keeps
+    // its original expiration time.
+
+    bool      isResumed     = false;
+    size_t    idLength      = 0;
+    TimeMilli oldExpireTime = mClientSessionExpireTime;
+    uint8_t   id[sizeof(mClientSession.MBEDTLS_PRIVATE(id))];
+
+    if (mHasClientSession)
+    {
+        idLength = mClientSession.MBEDTLS_PRIVATE(id_len);
+        memcpy(id, mClientSession.MBEDTLS_PRIVATE(id), idLength);
+    }
+
+    ClearClientSession();
+
+    if (mbedtls_ssl_get_session(&aSession.mSsl, &mClientSession) != 0)
+    {
+        ClearClientSession();
+        ExitNow();
+    }
+
+    isResumed = (idLength > 0) && (mClientSession.MBEDTLS_PRIVATE(id_len) == idLength) &&
+                (memcmp(mClientSession.MBEDTLS_PRIVATE(id), id, idLength) == 0);
+
+    mHasClientSession = true;
+    mClientSessionPeer.SetAddress(aSession.mMessageInfo.GetPeerAddr());
+    mClientSessionPeer.SetPort(aSession.mMessageInfo.GetPeerPort());
+    mClientSessionExpireTime = isResumed ? oldExpireTime : TimerMilli::GetNow() + kSessionCacheTimeout;
+
+exit:
+    return isResumed;
+}
+
+#endif // OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+
 Error SecureTransport::Open(uint16_t aPort, Ip6::NetifIdentifier aNetifIdentifier)
 {
     Error error;
@@ -784,6 +1127,9 @@ void SecureTransport::Close(void)
     }
 
     RemoveDisconnectedSessions();
+    mConfig.Reset();
+    FreeExtensionKeys();
+    ClearSessionCache();
 
     if (UsesSocket())
     {
@@ -835,10 +1181,26 @@ Error SecureTransport::SetPsk(const uint8_t *aPsk, uint8_t aPskLength)
 
     VerifyOrExit(aPskLength <= sizeof(mPsk), error = kErrorInvalidArgs);
 
+    // The EC-JPAKE password is set per `mbedtls_ssl_context`, so the
+    // current config remains valid unless the cipher suite changes.
+    // Sessions established under a different PSK must not be resumed.
+
+    if ((mCipherSuite == kEcjpakeWithAes128Ccm8) && (mPskLength == aPskLength) && (memcmp(mPsk, aPsk, aPskLength) == 0))
+    {
+        ExitNow();
+    }
+
+    if (mCipherSuite != kEcjpakeWithAes128Ccm8)
+    {
+        mConfig.Reset();
+    }
+
     memcpy(mPsk, aPsk, aPskLength);
     mPskLength   = aPskLength;
     mCipherSuite = kEcjpakeWithAes128Ccm8;
 
+    ClearSessionCache();
+
 exit:
     return error;
 }
@@ -1161,6 +1523,7 @@ void SecureTransport::Extension::SetCertificate(const uint8_t *aX509Certificate,
 
     mSecureTransport.mCipherSuite =
         mSecureTransport.mDatagramTransport ? kEcdheEcdsaWithAes128Ccm8 : kEcdheEcdsaWithAes128GcmSha256;
+    mSecureTransport.InvalidateConfig();
 }
 
 void SecureTransport::Extension::SetCaCertificateChain(const uint8_t *aX509CaCertificateChain,
@@ -1171,6 +1534,7 @@ void SecureTransport::Extension::SetCaCertificateChain(const uint8_t *aX509CaCer
 
     mEcdheEcdsaInfo.mCaChainSrc    = aX509CaCertificateChain;
     mEcdheEcdsaInfo.mCaChainLength = aX509CaCertChainLength;
+    mSecureTransport.InvalidateConfig();
 }
 
 #endif // MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
@@ -1199,6 +1563,7 @@ void SecureTransport::Extension::SetPreSharedKey(const uint8_t *aPsk,
     mPskInfo.mPreSharedKeyIdLength = aPskIdLength;
 
     mSecureTransport.mCipherSuite = kPskWithAes128Ccm8;
+    mSecureTransport.InvalidateConfig();
 }
 
 #endif // MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
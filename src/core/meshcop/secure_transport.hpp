@@ -65,6 +65,28 @@
 #define OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT 0
 #endif
 
+#ifdef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+#error "OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE MUST NOT be defined directly."
+#endif
+
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_CACHE_C) && \
+    (OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE > 0)
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE 1
+#include <mbedtls/ssl_cache.h>
+#else
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE 0
+#endif
+
+#ifdef OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+#error "OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE MUST NOT be defined directly."
+#endif
+
+#if defined(MBEDTLS_SSL_CLI_C) && (OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE > 0)
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE 1
+#else
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE 0
+#endif
+
 #if OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
 #ifndef MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 #error OPENTHREAD_CONFIG_BLE_TCAT_ENABLE requires MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
@@ -86,12 +108,14 @@
 #include <openthread/coap_secure.h>
 
 #include "common/callback.hpp"
+#include "common/heap_allocatable.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/log.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
+#include "common/retain_ptr.hpp"
 #include "common/timer.hpp"
 #include "crypto/sha256.hpp"
 #include "meshcop/meshcop.hpp"
@@ -109,6 +133,38 @@ class Dtls;
 class Tls;
 #endif
 
+/**
+ * Represents an mbedTLS SSL configuration along with its DTLS cookie context.
+ *
+ * An `SslConfig` is built by a `SecureTransport` and shared by all of its sessions of the same role. It is retain
+ * counted so that a session keeps the config it was set up with, even after the transport builds a new one.
+ */
+class SslConfig : public Heap::Allocatable<SslConfig>, public RetainCountable, private NonCopyable
+{
+    friend class SecureSession;
+    friend class SecureTransport;
+
+public:
+    /**
+     * Initializes the `SslConfig`.
+     *
+     * @param[in] aIsServer  Whether the config is for server (TRUE) or client (FALSE) sessions.
+     */
+    explicit SslConfig(bool aIsServer);
+
+    /**
+     * Frees the mbedTLS config and cookie context.
+     */
+    ~SslConfig(void);
+
+private:
+    bool               mIsServer;
+    mbedtls_ssl_config mConf;
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
+    mbedtls_ssl_cookie_ctx mCookieCtx;
+#endif
+};
+
 /**
  * Represents a secure session.
  */
@@ -297,6 +353,7 @@ private:
 
     bool                     mTimerSet : 1;
     bool                     mIsServer : 1;
+    bool                     mIsResumed : 1;
     State                    mState;
     Message::SubType         mMessageSubType;
     ConnectEvent             mConnectEvent;
@@ -308,11 +365,8 @@ private:
     Ip6::MessageInfo         mMessageInfo;
     Callback<ConnectHandler> mConnectedCallback;
     Callback<ReceiveHandler> mReceiveCallback;
-    mbedtls_ssl_config       mConf;
+    RetainPtr<SslConfig>     mConfig;
     mbedtls_ssl_context      mSsl;
-#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
-    mbedtls_ssl_cookie_ctx mCookieCtx;
-#endif
 };
 
 /**
@@ -327,6 +381,15 @@ public:
     static constexpr size_t  kSecureTransportRandomBufferSize = 32;
     static constexpr uint8_t kPskMaxLength                    = 32; ///< Maximum PSK length.
 
+    /**
+     * Represents the handshake counters of a `SecureTransport`.
+     */
+    struct HandshakeCounters : public Clearable<HandshakeCounters>
+    {
+        uint32_t mFullHandshakes;    ///< Number of completed full handshakes.
+        uint32_t mResumedHandshakes; ///< Number of completed abbreviated handshakes resuming a cached session.
+    };
+
     /**
      * Pointer to function that is called to send an encrypted message.
      *
@@ -558,6 +621,7 @@ public:
         void SetSslAuthMode(bool aVerifyPeerCertificate)
         {
             mSecureTransport.mVerifyPeerCertificate = aVerifyPeerCertificate;
+            mSecureTransport.InvalidateConfig();
         }
 
     protected:
@@ -748,6 +812,13 @@ public:
      */
     LinkedList<SecureSession> &GetSessions(void) { return mSessions; }
 
+    /**
+     * Gets the handshake counters.
+     *
+     * @returns The handshake counters.
+     */
+    const HandshakeCounters &GetHandshakeCounters(void) const { return mHandshakeCounters; }
+
 #if OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT
     /**
      * Defines the keylog callback.
@@ -791,13 +862,62 @@ private:
         kUnspecifiedCipherSuite,
     };
 
-    void RemoveDisconnectedSessions(void);
-    void DecremenetRemainingConnectionAttempts(void);
-    bool HasNoRemainingConnectionAttempts(void) const;
-    int  Transmit(const unsigned char    *aBuf,
-                  size_t                  aLength,
-                  const Ip6::MessageInfo &aMessageInfo,
-                  Message::SubType        aMessageSubType);
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE > 0
+    static constexpr uint32_t kSessionCacheTimeout =
+        Time::SecToMsec(OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_TIMEOUT);
+#endif
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    static constexpr uint8_t kMaxSessionIdLength = 32;
+
+    struct CachedSessionId
+    {
+        bool IsEmpty(void) const { return (mLength == 0); }
+        bool Matches(const unsigned char *aId, size_t aLength) const;
+
+        uint8_t   mLength;
+        uint8_t   mId[kMaxSessionIdLength];
+        TimeMilli mExpireTime;
+    };
+#endif
+
+    Error SetupConfig(SecureSession &aSession);
+    Error BuildConfig(bool aIsServer);
+    void  InvalidateConfig(void);
+    void  FreeExtensionKeys(void);
+    void  ClearSessionCache(void);
+    void  RemoveDisconnectedSessions(void);
+    void  DecremenetRemainingConnectionAttempts(void);
+    bool  HasNoRemainingConnectionAttempts(void) const;
+    int   Transmit(const unsigned char    *aBuf,
+                   size_t                  aLength,
+                   const Ip6::MessageInfo &aMessageInfo,
+                   Message::SubType        aMessageSubType);
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    void AddCachedSessionId(const unsigned char *aId, size_t aLength);
+    bool IsCachedSessionIdValid(const unsigned char *aId, size_t aLength) const;
+
+#if (MBEDTLS_VERSION_NUMBER >= 0x03000000)
+    static int HandleMbedtlsSessionCacheGet(void                *aContext,
+                                            const unsigned char *aSessionId,
+                                            size_t               aSessionIdLength,
+                                            mbedtls_ssl_session *aSession);
+    static int HandleMbedtlsSessionCacheSet(void                      *aContext,
+                                            const unsigned char       *aSessionId,
+                                            size_t                     aSessionIdLength,
+                                            const mbedtls_ssl_session *aSession);
+#else
+    static int HandleMbedtlsSessionCacheGet(void *aContext, mbedtls_ssl_session *aSession);
+    static int HandleMbedtlsSessionCacheSet(void *aContext, const mbedtls_ssl_session *aSession);
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+    void ClearClientSession(void);
+    void ApplyClientSession(SecureSession &aSession);
+    bool SaveClientSession(SecureSession &aSession);
+#endif
 
     static void HandleMbedtlsDebug(void *aContext, int aLevel, const char *aFile, int aLine, const char *aStr);
     void        HandleMbedtlsDebug(int aLevel, const char *aFile, int aLine, const char *aStr);
@@ -875,12 +995,25 @@ private:
     Callback<AcceptCallback>        mAcceptCallback;
     Callback<RemoveSessionCallback> mRemoveSessionCallback;
     Callback<TransportCallback>     mTransportCallback;
+    HandshakeCounters               mHandshakeCounters;
+    RetainPtr<SslConfig>            mConfig;
 #if OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT
     Callback<KeylogCallback> mKeylogCallback;
 #endif
 #if OPENTHREAD_CONFIG_TLS_API_ENABLE
     Extension *mExtension;
 #endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_ENABLE
+    bool                      mSessionCacheHit;
+    mbedtls_ssl_cache_context mSessionCache;
+    CachedSessionId           mCachedSessionIds[OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE];
+#endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_CLIENT_SESSION_CACHE_ENABLE
+    bool                mHasClientSession;
+    Ip6::SockAddr       mClientSessionPeer;
+    TimeMilli           mClientSessionExpireTime;
+    mbedtls_ssl_session mClientSession;
+#endif
 };
 
 /**
@@ -74,12 +74,50 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // Sum 16-bit words into a 32-bit accumulator and fold the carries
+    // once at the end (RFC 1071), instead of adding byte by byte. The
+    // accumulator cannot overflow as `aLength` is at most 0xffff.
+
+    uint32_t sum;
+
+    if ((aLength > 0) && mAtOddIndex)
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    sum = mValue;
+
+    for (; aLength >= sizeof(uint16_t); aBuffer += sizeof(uint16_t), aLength -= sizeof(uint16_t))
     {
-        AddUint8(aBuffer[i]);
+        sum += BigEndian::ReadUint16(aBuffer);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
     }
 }
 
+void Checksum::AddChecksum(const Checksum &aChecksum)
+{
+    // Combines a checksum computed separately over the bytes that
+    // immediately follow the ones already summed. Requires that they
+    // start at an even index.
+
+    OT_ASSERT(!mAtOddIndex);
+
+    AddUint16(aChecksum.mValue);
+    mAtOddIndex = aChecksum.mAtOddIndex;
+}
+
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 {
     uint16_t checksum = GetValue();
@@ -98,10 +136,22 @@ void Checksum::Calculate(const Ip6::Address &aSource,
                          const Ip6::Address &aDestination,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
+{
+    Calculate(aSource, aDestination, aIpProto, aMessage, Checksum(), 0);
+}
+
+void Checksum::Calculate(const Ip6::Address &aSource,
+                         const Ip6::Address &aDestination,
+                         uint8_t             aIpProto,
+                         const Message      &aMessage,
+                         const Checksum     &aPayloadSum,
+                         uint16_t            aPayloadLength)
 {
     Message::Chunk chunk;
     uint16_t       length = aMessage.DetermineLengthAfterOffset();
 
+    OT_ASSERT(aPayloadLength <= length);
+
     // Pseudo-header for checksum calculation (RFC-2460).
 
     AddData(aSource.GetBytes(), sizeof(Ip6::Address));
@@ -109,7 +159,10 @@ void Checksum::Calculate(const Ip6::Address &aSource,
     AddUint16(length);
     AddUint16(static_cast<uint16_t>(aIpProto));
 
-    // Add message content (from offset to the end) to checksum.
+    // Add message content (from offset to the end, excluding the
+    // already summed payload) to checksum.
+
+    length -= aPayloadLength;
 
     aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
 
@@ -118,6 +171,11 @@ void Checksum::Calculate(const Ip6::Address &aSource,
         AddData(chunk.GetBytes(), chunk.GetLength());
         aMessage.GetNextChunk(length, chunk);
     }
+
+    if (aPayloadLength > 0)
+    {
+        AddChecksum(aPayloadSum);
+    }
 }
 
 void Checksum::Calculate(const Ip4::Address &aSource,
@@ -169,6 +227,16 @@ void Checksum::UpdateMessageChecksum(Message            &aMessage,
                                      const Ip6::Address &aSource,
                                      const Ip6::Address &aDestination,
                                      uint8_t             aIpProto)
+{
+    UpdateMessageChecksum(aMessage, aSource, aDestination, aIpProto, Checksum(), 0);
+}
+
+void Checksum::UpdateMessageChecksum(Message            &aMessage,
+                                     const Ip6::Address &aSource,
+                                     const Ip6::Address &aDestination,
+                                     uint8_t             aIpProto,
+                                     const Checksum     &aPayloadSum,
+                                     uint16_t            aPayloadLength)
 {
     uint16_t headerOffset;
     Checksum checksum;
@@ -193,7 +261,7 @@ void Checksum::UpdateMessageChecksum(Message            &aMessage,
 
     // Clear the checksum before calculating it.
     aMessage.Write<uint16_t>(aMessage.GetOffset() + headerOffset, 0);
-    checksum.Calculate(aSource, aDestination, aIpProto, aMessage);
+    checksum.Calculate(aSource, aDestination, aIpProto, aMessage, aPayloadSum, aPayloadLength);
     checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
 
 exit:
@@ -39,13 +39,18 @@
 #include <stdint.h>
 
 #include "common/message.hpp"
-#include "net/ip4_types.hpp"
 #include "net/ip6_address.hpp"
 #include "net/ip6_headers.hpp"
 #include "net/socket.hpp"
 
 namespace ot {
 
+namespace Ip4 {
+// Forward declarations, `net/ip4_types.hpp` includes `net/tcp6.hpp` which depends on `Checksum`.
+class Address;
+class Header;
+} // namespace Ip4
+
 /**
  * Implements IP checksum calculation and verification.
  */
@@ -54,6 +59,26 @@ class Checksum
     friend class ChecksumTester;
 
 public:
+    /**
+     * Initializes an empty `Checksum`.
+     *
+     * An empty `Checksum` can be used to sum the trailing payload bytes of a message while they are written, see
+     * `UpdateMessageChecksum(aMessage, aSource, aDestination, aIpProto, aPayloadSum, aPayloadLength)`.
+     */
+    Checksum(void)
+        : mValue(0)
+        , mAtOddIndex(false)
+    {
+    }
+
+    /**
+     * Adds a sequence of bytes to the checksum.
+     *
+     * @param[in] aBuffer  A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     */
+    void AddData(const uint8_t *aBuffer, uint16_t aLength);
+
     /**
      * Verifies the checksum in a given message (if UDP/ICMP6).
      *
@@ -82,6 +107,30 @@ public:
                                       const Ip6::Address &aDestination,
                                       uint8_t             aIpProto);
 
+    /**
+     * Calculates and then updates the checksum in a given message (if TCP/UDP/ICMPv6) whose trailing payload bytes
+     * have already been summed by the caller.
+     *
+     * This allows a sender to sum the payload while copying it into the message, so that the message content is only
+     * walked over once. Only the bytes preceding the payload (i.e., the TCP/UDP/ICMPv6 header) are read back from the
+     * message.
+     *
+     * @param[in,out] aMessage        The message to update the checksum in. The `aMessage.GetOffset()` should point to
+     *                                start of the TCP/UDP/ICMPv6 header.
+     * @param[in] aSource             The source address.
+     * @param[in] aDestination        The destination address.
+     * @param[in] aIpProto            The Internet Protocol value.
+     * @param[in] aPayloadSum         The checksum over the last @p aPayloadLength bytes of @p aMessage.
+     * @param[in] aPayloadLength      The number of trailing bytes summed in @p aPayloadSum. The bytes preceding them
+     *                                (from `aMessage.GetOffset()`) MUST be of even length.
+     */
+    static void UpdateMessageChecksum(Message            &aMessage,
+                                      const Ip6::Address &aSource,
+                                      const Ip6::Address &aDestination,
+                                      uint8_t             aIpProto,
+                                      const Checksum     &aPayloadSum,
+                                      uint16_t            aPayloadLength);
+
     /**
      * Calculates and then updates the checksum in a given IPv4 message (if TCP/UDP/ICMP(v4)).
      *
@@ -105,21 +154,21 @@ public:
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
 private:
-    Checksum(void)
-        : mValue(0)
-        , mAtOddIndex(false)
-    {
-    }
-
     uint16_t GetValue(void) const { return mValue; }
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
-    void     AddData(const uint8_t *aBuffer, uint16_t aLength);
+    void     AddChecksum(const Checksum &aChecksum);
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
                        uint8_t             aIpProto,
                        const Message      &aMessage);
+    void     Calculate(const Ip6::Address &aSource,
+                       const Ip6::Address &aDestination,
+                       uint8_t             aIpProto,
+                       const Message      &aMessage,
+                       const Checksum     &aPayloadSum,
+                       uint16_t            aPayloadLength);
     void     Calculate(const Ip4::Address &aSource,
                        const Ip4::Address &aDestination,
                        uint8_t             aIpProto,
@@ -384,6 +384,15 @@ void Ip6::EnqueueDatagram(Message &aMessage)
 }
 
 Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aIpProto)
+{
+    return SendDatagram(aMessage, aMessageInfo, aIpProto, Checksum(), 0);
+}
+
+Error Ip6::SendDatagram(Message        &aMessage,
+                        MessageInfo    &aMessageInfo,
+                        uint8_t         aIpProto,
+                        const Checksum &aPayloadSum,
+                        uint16_t        aPayloadLength)
 {
     Error    error = kErrorNone;
     Header   header;
@@ -437,7 +446,8 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     SuccessOrExit(error = aMessage.Prepend(header));
 
-    Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto);
+    Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto, aPayloadSum,
+                                    aPayloadLength);
 
     if (aMessageInfo.GetPeerAddr().IsMulticastLargerThanRealmLocal())
     {
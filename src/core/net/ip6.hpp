@@ -158,6 +158,27 @@ public:
      */
     Error SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aIpProto);
 
+    /**
+     * Sends an IPv6 datagram whose trailing payload bytes have already been summed for the upper-layer checksum.
+     *
+     * Behaves as `SendDatagram(aMessage, aMessageInfo, aIpProto)`, except that only the upper-layer header is read
+     * back from @p aMessage when calculating the checksum.
+     *
+     * @param[in]  aMessage        A reference to the message.
+     * @param[in]  aMessageInfo    A reference to the message info associated with @p aMessage.
+     * @param[in]  aIpProto        The Internet Protocol value.
+     * @param[in]  aPayloadSum     The checksum over the last @p aPayloadLength bytes of @p aMessage.
+     * @param[in]  aPayloadLength  The number of trailing bytes summed in @p aPayloadSum.
+     *
+     * @retval kErrorNone     Successfully enqueued the message into an output interface.
+     * @retval kErrorNoBufs   Insufficient available buffer to add the IPv6 headers.
+     */
+    Error SendDatagram(Message        &aMessage,
+                       MessageInfo    &aMessageInfo,
+                       uint8_t         aIpProto,
+                       const Checksum &aPayloadSum,
+                       uint16_t        aPayloadLength);
+
     /**
      * Sends a raw IPv6 datagram with a fully formed IPv6 header.
      *
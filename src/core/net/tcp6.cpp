@@ -49,6 +49,10 @@ static_assert(alignof(struct tcpcb) == alignof(decltype(Tcp::Endpoint::mTcb)),
               "mTcb field in otTcpEndpoint is aligned incorrectly");
 static_assert(offsetof(Tcp::Endpoint, mTcb) == 0, "mTcb field in otTcpEndpoint has nonzero offset");
 
+static_assert(Tcp::Endpoint::kCongestionControlNewReno == TCP_CC_NEWRENO, "kCongestionControlNewReno is incorrect");
+static_assert(Tcp::Endpoint::kCongestionControlRttGradient == TCP_CC_RTTGRAD,
+              "kCongestionControlRttGradient is incorrect");
+
 static_assert(sizeof(struct tcpcb_listen) == sizeof(Tcp::Listener::mTcbListen),
               "mTcbListen field in otTcpListener is sized incorrectly");
 static_assert(alignof(struct tcpcb_listen) == alignof(decltype(Tcp::Listener::mTcbListen)),
@@ -60,6 +64,7 @@ Tcp::Tcp(Instance &aInstance)
     , mTimer(aInstance)
     , mTasklet(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+    , mTxPayloadLength(0)
 {
     OT_UNUSED_VARIABLE(mEphemeralPort);
 }
@@ -99,6 +104,7 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
     }
 
     tp.accepted_from = nullptr;
+    tp.cc_state.algo = OPENTHREAD_CONFIG_TCP_RTT_GRADIENT_CC_DEFAULT ? TCP_CC_RTTGRAD : TCP_CC_NEWRENO;
     initialize_tcb(&tp);
 
     /* Note that we do not need to zero-initialize mReceiveLinks. */
@@ -306,6 +312,28 @@ exit:
     return error;
 }
 
+Error Tcp::Endpoint::SetCongestionControl(CongestionControl aCongestionControl)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsClosed(), error = kErrorInvalidState);
+    GetTcb().cc_state.algo = aCongestionControl;
+
+exit:
+    return error;
+}
+
+Tcp::Endpoint::CongestionControl Tcp::Endpoint::GetCongestionControl(void) const
+{
+    return static_cast<CongestionControl>(GetTcb().cc_state.algo);
+}
+
+uint16_t Tcp::Endpoint::GetIgnoredLossCount(void) const { return GetTcb().cc_state.ignored_losses; }
+
+uint32_t Tcp::Endpoint::GetSentSegmentCount(void) const { return GetTcb().t_sndpack; }
+
+uint32_t Tcp::Endpoint::GetRetransmittedSegmentCount(void) const { return GetTcb().t_sndrexmitpack; }
+
 bool Tcp::Endpoint::IsClosed(void) const { return GetTcb().t_state == TCP6S_CLOSED; }
 
 uint8_t Tcp::Endpoint::TimerFlagToIndex(uint8_t aTimerFlag)
@@ -959,9 +987,35 @@ otMessage *tcplp_sys_new_message(otInstance *aInstance)
         message->SetLinkSecurityEnabled(true);
     }
 
+    /*
+     * TCPlp builds and sends one segment at a time, so the payload checksum
+     * can be tracked per instance.
+     */
+    instance.Get<Tcp>().mTxPayloadSum    = Checksum();
+    instance.Get<Tcp>().mTxPayloadLength = 0;
+
     return message;
 }
 
+void tcplp_sys_write_payload(otInstance    *aInstance,
+                             otMessage     *aMessage,
+                             uint16_t       aOffset,
+                             const uint8_t *aData,
+                             uint16_t       aLength)
+{
+    Tcp     &tcp     = AsCoreType(aInstance).Get<Tcp>();
+    Message &message = AsCoreType(aMessage);
+
+    /*
+     * Sum the payload while it is copied into the segment, so that the
+     * checksum calculation in `SendDatagram()` only needs to read back the
+     * TCP header instead of walking the whole message again.
+     */
+    message.WriteBytes(aOffset, aData, aLength);
+    tcp.mTxPayloadSum.AddData(aData, aLength);
+    tcp.mTxPayloadLength += aLength;
+}
+
 void tcplp_sys_free_message(otInstance *aInstance, otMessage *aMessage)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -977,7 +1031,9 @@ void tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessag
 
     LogDebg("Sending TCP segment: payload_size = %d", static_cast<int>(message.GetLength()));
 
-    IgnoreError(instance.Get<ot::Ip6::Ip6>().SendDatagram(message, info, kProtoTcp));
+    IgnoreError(instance.Get<ot::Ip6::Ip6>().SendDatagram(message, info, kProtoTcp, instance.Get<Tcp>().mTxPayloadSum,
+                                                          instance.Get<Tcp>().mTxPayloadLength));
+    instance.Get<Tcp>().mTxPayloadLength = 0;
 }
 
 uint32_t tcplp_sys_get_ticks(void) { return TimerMilli::GetNow().GetValue(); }
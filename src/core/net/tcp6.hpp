@@ -46,6 +46,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/timer.hpp"
+#include "net/checksum.hpp"
 #include "net/ip6_headers.hpp"
 #include "net/socket.hpp"
 
@@ -68,6 +69,14 @@ void tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay
 
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 void tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+
+otMessage *tcplp_sys_new_message(otInstance *aInstance);
+void       tcplp_sys_write_payload(otInstance    *aInstance,
+                                   otMessage     *aMessage,
+                                   uint16_t       aOffset,
+                                   const uint8_t *aData,
+                                   uint16_t       aLength);
+void       tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessageInfo *aMessageInfo);
 }
 
 namespace ot {
@@ -97,6 +106,15 @@ public:
         friend class LinkedList<Endpoint>;
 
     public:
+        /**
+         * Represents a congestion control algorithm.
+         */
+        enum CongestionControl : uint8_t
+        {
+            kCongestionControlNewReno     = 0, ///< New Reno (RFC 5681).
+            kCongestionControlRttGradient = 1, ///< RTT gradient, does not back off on non-congestive loss.
+        };
+
         /**
          * Initializes a TCP endpoint.
          *
@@ -337,6 +355,50 @@ public:
          */
         Error Deinitialize(void);
 
+        /**
+         * Sets the congestion control algorithm used by this Endpoint.
+         *
+         * The selection persists across connections made with this Endpoint. The
+         * default is set by `OPENTHREAD_CONFIG_TCP_RTT_GRADIENT_CC_DEFAULT`.
+         *
+         * @param[in]  aCongestionControl  The congestion control algorithm.
+         *
+         * @retval kErrorNone          Successfully set the congestion control algorithm.
+         * @retval kErrorInvalidState  The Endpoint is not in the closed state.
+         */
+        Error SetCongestionControl(CongestionControl aCongestionControl);
+
+        /**
+         * Gets the congestion control algorithm used by this Endpoint.
+         *
+         * @returns The congestion control algorithm.
+         */
+        CongestionControl GetCongestionControl(void) const;
+
+        /**
+         * Gets the number of losses on the current connection that the congestion
+         * control algorithm did not treat as congestion.
+         *
+         * This is always zero with `kCongestionControlNewReno`.
+         *
+         * @returns The number of losses recovered from without reducing the congestion window.
+         */
+        uint16_t GetIgnoredLossCount(void) const;
+
+        /**
+         * Gets the number of new data segments sent on the current connection.
+         *
+         * @returns The number of data segments sent, excluding retransmissions.
+         */
+        uint32_t GetSentSegmentCount(void) const;
+
+        /**
+         * Gets the number of data segments retransmitted on the current connection.
+         *
+         * @returns The number of data segments retransmitted.
+         */
+        uint32_t GetRetransmittedSegmentCount(void) const;
+
         /**
          * Converts a reference to a struct tcpcb to a reference to its
          * enclosing Endpoint.
@@ -553,6 +615,14 @@ public:
     bool IsInitialized(const Listener &aListener) const { return mListeners.Contains(aListener); }
 
 private:
+    friend otMessage *::tcplp_sys_new_message(otInstance *aInstance);
+    friend void ::tcplp_sys_write_payload(otInstance    *aInstance,
+                                          otMessage     *aMessage,
+                                          uint16_t       aOffset,
+                                          const uint8_t *aData,
+                                          uint16_t       aLength);
+    friend void ::tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessageInfo *aMessageInfo);
+
     static constexpr uint16_t kDynamicPortMin = 49152;
     static constexpr uint16_t kDynamicPortMax = 65535;
 
@@ -585,6 +655,11 @@ private:
     LinkedList<Endpoint> mEndpoints;
     LinkedList<Listener> mListeners;
     uint16_t             mEphemeralPort;
+
+    // Checksum over the payload of the segment being built, summed as the
+    // payload is copied in (see `tcplp_sys_write_payload()`).
+    Checksum mTxPayloadSum;
+    uint16_t mTxPayloadLength;
 };
 
 } // namespace Ip6
@@ -160,7 +160,7 @@ Error Interface::Send(Packet &aPacket, bool aIsDiscovery)
 
     case Header::kTypeUnicast:
     case Header::kTypeAck:
-        peerEntry = Get<PeerTable>().FindMatching(aPacket.GetHeader().GetDestination());
+        peerEntry = Get<PeerTable>().FindPeer(aPacket.GetHeader().GetDestination());
         VerifyOrExit(peerEntry != nullptr, error = kErrorAbort);
         VerifyOrExit(peerEntry->HasValidSockAddr(), error = kErrorAbort);
         peerEntry->UpdateLastInteractionTime();
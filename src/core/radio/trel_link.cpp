@@ -340,7 +340,7 @@ void Link::ProcessReceivedPacket(Packet &aPacket, const Ip6::SockAddr &aSockAddr
     VerifyOrExit(aPacket.GetHeader().GetSource() != Get<Mac::Mac>().GetExtAddress());
 
     mRxPacketSenderAddr = aSockAddr;
-    mRxPacketPeer       = Get<PeerTable>().FindMatching(aPacket.GetHeader().GetSource());
+    mRxPacketPeer       = Get<PeerTable>().FindPeer(aPacket.GetHeader().GetSource());
 
     if (mRxPacketPeer != nullptr)
     {
@@ -34,6 +34,7 @@
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -64,6 +65,8 @@ void Peer::Init(Instance &aInstance)
 #else
     mDnssdState = kDnssdResolved;
 #endif
+
+    Get<PeerTable>().AddToIndex(*this);
 }
 
 void Peer::Free(void)
@@ -72,6 +75,8 @@ void Peer::Free(void)
 
     Log(kDeleted);
 
+    Get<PeerTable>().RemoveFromIndex(*this);
+
 #if OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
     Heap::Allocatable<Peer>::Free();
 #else
@@ -153,10 +158,26 @@ exit:
 
 void Peer::SetExtAddress(const Mac::ExtAddress &aExtAddress)
 {
+    Get<PeerTable>().RemoveFromIndex(*this);
+
     mExtAddress = aExtAddress;
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
     mExtAddressSet = true;
 #endif
+
+    Get<PeerTable>().AddToIndex(*this);
+}
+
+void Peer::SetSockAddr(const Ip6::SockAddr &aSockAddr)
+{
+    VerifyOrExit(GetSockAddr() != aSockAddr);
+
+    Get<PeerTable>().RemoveFromIndex(*this);
+    mSockAddr = aSockAddr;
+    Get<PeerTable>().AddToIndex(*this);
+
+exit:
+    return;
 }
 
 bool Peer::Matches(const Mac::ExtAddress &aExtAddress) const
@@ -214,7 +235,7 @@ void Peer::SetPort(uint16_t aPort)
     VerifyOrExit(mPort != aPort);
 
     mPort = aPort;
-    AsCoreType(&mSockAddr).SetPort(mPort);
+    SetSockAddr(Ip6::SockAddr(GetSockAddr().GetAddress(), mPort));
 
 exit:
     return;
@@ -349,6 +370,84 @@ PeerTable::PeerTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
 {
+    ClearAllBytes(mExtAddressBuckets);
+    ClearAllBytes(mSockAddrBuckets);
+}
+
+const Peer *PeerTable::FindPeer(const Mac::ExtAddress &aExtAddress) const
+{
+    const Peer *peer = mExtAddressBuckets[GetBucket(aExtAddress)];
+
+    while ((peer != nullptr) && !peer->Matches(aExtAddress))
+    {
+        peer = peer->mNextByExtAddress;
+    }
+
+    return peer;
+}
+
+const Peer *PeerTable::FindPeer(const Ip6::SockAddr &aSockAddr) const
+{
+    const Peer *peer = mSockAddrBuckets[GetBucket(aSockAddr)];
+
+    while ((peer != nullptr) && !peer->Matches(aSockAddr))
+    {
+        peer = peer->mNextBySockAddr;
+    }
+
+    return peer;
+}
+
+void PeerTable::AddToIndex(Peer &aPeer)
+{
+    Peer *&extAddressHead = mExtAddressBuckets[GetBucket(aPeer.GetExtAddress())];
+    Peer *&sockAddrHead   = mSockAddrBuckets[GetBucket(aPeer.GetSockAddr())];
+
+    aPeer.mNextByExtAddress = extAddressHead;
+    extAddressHead          = &aPeer;
+
+    aPeer.mNextBySockAddr = sockAddrHead;
+    sockAddrHead          = &aPeer;
+}
+
+void PeerTable::RemoveFromIndex(Peer &aPeer)
+{
+    Peer **link;
+
+    for (link = &mExtAddressBuckets[GetBucket(aPeer.GetExtAddress())]; *link != nullptr;
+         link = &(*link)->mNextByExtAddress)
+    {
+        if (*link == &aPeer)
+        {
+            *link = aPeer.mNextByExtAddress;
+            break;
+        }
+    }
+
+    for (link = &mSockAddrBuckets[GetBucket(aPeer.GetSockAddr())]; *link != nullptr; link = &(*link)->mNextBySockAddr)
+    {
+        if (*link == &aPeer)
+        {
+            *link = aPeer.mNextBySockAddr;
+            break;
+        }
+    }
+}
+
+uint16_t PeerTable::GetBucket(const Mac::ExtAddress &aExtAddress)
+{
+    return static_cast<uint16_t>(Fnv1aHash().Feed(aExtAddress) & (kNumBuckets - 1));
+}
+
+uint16_t PeerTable::GetBucket(const Ip6::SockAddr &aSockAddr)
+{
+    uint16_t  port = aSockAddr.GetPort();
+    Fnv1aHash hash;
+
+    hash.Feed(aSockAddr.GetAddress());
+    hash.Feed(port);
+
+    return static_cast<uint16_t>(hash.GetHash() & (kNumBuckets - 1));
 }
 
 Peer *PeerTable::AllocatePeer(void)
@@ -42,6 +42,7 @@
 #include <openthread/platform/trel.h>
 
 #include "common/as_core_type.hpp"
+#include "common/const_cast.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
 #include "common/heap_data.hpp"
@@ -250,7 +251,7 @@ private:
     void     SetDnssdState(DnssdState aState);
     void     SetExtAddress(const Mac::ExtAddress &aExtAddress);
     void     SetExtPanId(const MeshCoP::ExtendedPanId &aExtPanId) { mExtPanId = aExtPanId; }
-    void     SetSockAddr(const Ip6::SockAddr &aSockAddr) { mSockAddr = aSockAddr; }
+    void     SetSockAddr(const Ip6::SockAddr &aSockAddr);
     bool     Matches(const Mac::ExtAddress &aExtAddress) const;
     bool     Matches(const Ip6::SockAddr &aSockAddr) const { return GetSockAddr() == aSockAddr; }
     bool     Matches(const Peer &aPeer) const { return this == &aPeer; }
@@ -278,6 +279,8 @@ private:
 #endif
 
     Peer      *mNext;
+    Peer      *mNextByExtAddress;
+    Peer      *mNextBySockAddr;
     DnssdState mDnssdState;
     UptimeSec  mLastInteractionTime;
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
@@ -353,6 +356,46 @@ public:
      */
     uint16_t GetNumberOfPeers(void) const;
 
+    /**
+     * Finds a peer in the table matching a given Extended MAC Address.
+     *
+     * Uses a hash index, so the lookup cost does not grow with the number of peers.
+     *
+     * @param[in] aExtAddress  The Extended MAC Address to search for.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if not found.
+     */
+    Peer *FindPeer(const Mac::ExtAddress &aExtAddress) { return AsNonConst(AsConst(this)->FindPeer(aExtAddress)); }
+
+    /**
+     * Finds a peer in the table matching a given Extended MAC Address.
+     *
+     * @param[in] aExtAddress  The Extended MAC Address to search for.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if not found.
+     */
+    const Peer *FindPeer(const Mac::ExtAddress &aExtAddress) const;
+
+    /**
+     * Finds a peer in the table matching a given IPv6 socket address.
+     *
+     * Uses a hash index, so the lookup cost does not grow with the number of peers.
+     *
+     * @param[in] aSockAddr  The IPv6 socket address to search for.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if not found.
+     */
+    Peer *FindPeer(const Ip6::SockAddr &aSockAddr) { return AsNonConst(AsConst(this)->FindPeer(aSockAddr)); }
+
+    /**
+     * Finds a peer in the table matching a given IPv6 socket address.
+     *
+     * @param[in] aSockAddr  The IPv6 socket address to search for.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if not found.
+     */
+    const Peer *FindPeer(const Ip6::SockAddr &aSockAddr) const;
+
 private:
 #if !OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
 #if OPENTHREAD_CONFIG_TREL_PEER_TABLE_SIZE != 0
@@ -363,13 +406,29 @@ private:
 #endif
 #endif
 
+    // Every allocated peer is linked (from `Peer::Init()` until
+    // `Peer::Free()`) into two chained hash indexes, one by Extended
+    // MAC Address and one by socket address. A peer is unlinked and
+    // relinked whenever either key changes.
+
+    static constexpr uint16_t kNumBuckets = 64;
+
+    static_assert((kNumBuckets & (kNumBuckets - 1)) == 0, "kNumBuckets must be a power of two");
+
     Peer *AllocatePeer(void);
     Error EvictPeer(void);
     void  HandleTimer(void);
+    void  AddToIndex(Peer &aPeer);
+    void  RemoveFromIndex(Peer &aPeer);
+
+    static uint16_t GetBucket(const Mac::ExtAddress &aExtAddress);
+    static uint16_t GetBucket(const Ip6::SockAddr &aSockAddr);
 
     using PeerTimer = TimerMilliIn<PeerTable, &PeerTable::HandleTimer>;
 
     PeerTimer mTimer;
+    Peer     *mExtAddressBuckets[kNumBuckets];
+    Peer     *mSockAddrBuckets[kNumBuckets];
 #if !OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
     Pool<Peer, PoolSize> mPool;
 #endif
@@ -192,7 +192,7 @@ void PeerDiscoverer::HandleDiscoveredPeerInfo(const PeerInfo &aInfo)
 
     if (aInfo.IsRemoved())
     {
-        peer = Get<PeerTable>().FindMatching(txtInfo.mExtAddress);
+        peer = Get<PeerTable>().FindPeer(txtInfo.mExtAddress);
         VerifyOrExit(peer != nullptr);
         peer->SetDnssdState(Peer::kDnssdRemoved);
         peer->Log(Peer::kUpdated);
@@ -205,7 +205,7 @@ void PeerDiscoverer::HandleDiscoveredPeerInfo(const PeerInfo &aInfo)
     // different Extended MAC address. This ensures that we do not
     // keep stale entries in the peer table.
 
-    peer = Get<PeerTable>().FindMatching(aInfo.GetSockAddr());
+    peer = Get<PeerTable>().FindPeer(aInfo.GetSockAddr());
 
     if ((peer != nullptr) && !peer->Matches(txtInfo.mExtAddress))
     {
@@ -215,7 +215,7 @@ void PeerDiscoverer::HandleDiscoveredPeerInfo(const PeerInfo &aInfo)
 
     if (peer == nullptr)
     {
-        peer = Get<PeerTable>().FindMatching(txtInfo.mExtAddress);
+        peer = Get<PeerTable>().FindPeer(txtInfo.mExtAddress);
     }
 
     if (peer == nullptr)
@@ -688,7 +688,7 @@ void PeerDiscoverer::UpdatePeerAddresses(Peer &aPeer, const Peer::AddressArray &
 
     if (shouldChangeSockAddr && (aPeer.GetSockAddr().GetAddress() != aSortedAddresses[0]))
     {
-        AsCoreType(&aPeer.mSockAddr).SetAddress(aSortedAddresses[0]);
+        aPeer.SetSockAddr(Ip6::SockAddr(aSortedAddresses[0], aPeer.GetSockAddr().GetPort()));
         aPeer.mSockAddrUpdatedBasedOnRx = false;
     }
 
@@ -794,6 +794,7 @@ template <> void AddressResolver::HandleTmf<kUriAddressQuery>(Coap::Msg &aMsg)
 {
     Ip6::Address target;
     uint32_t     lastTransactionTime;
+    const Child *child;
 
     VerifyOrExit(aMsg.IsNonConfirmable());
 
@@ -809,26 +810,21 @@ template <> void AddressResolver::HandleTmf<kUriAddressQuery>(Coap::Msg &aMsg)
         ExitNow();
     }
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
-    {
-        if (child.IsFullThreadDevice() || child.GetLinkFailures() >= Mle::kFailedChildTransmissions)
-        {
-            continue;
-        }
+    child = Get<ChildTable>().FindChild(target, Child::kInStateValid, CanAnswerQueryFor);
+    VerifyOrExit(child != nullptr);
 
-        if (child.HasIp6Address(target))
-        {
-            lastTransactionTime = Time::MsecToSec(TimerMilli::GetNow() - child.GetLastHeard());
-            SendAddressQueryResponse(target, child.GetMeshLocalIid(), &lastTransactionTime,
-                                     aMsg.mMessageInfo.GetPeerAddr());
-            ExitNow();
-        }
-    }
+    lastTransactionTime = Time::MsecToSec(TimerMilli::GetNow() - child->GetLastHeard());
+    SendAddressQueryResponse(target, child->GetMeshLocalIid(), &lastTransactionTime, aMsg.mMessageInfo.GetPeerAddr());
 
 exit:
     return;
 }
 
+bool AddressResolver::CanAnswerQueryFor(const Child &aChild)
+{
+    return !aChild.IsFullThreadDevice() && (aChild.GetLinkFailures() < Mle::kFailedChildTransmissions);
+}
+
 void AddressResolver::SendAddressQueryResponse(const Ip6::Address             &aTarget,
                                                const Ip6::InterfaceIdentifier &aMeshLocalIid,
                                                const uint32_t                 *aLastTransactionTime,
@@ -53,6 +53,8 @@
 
 namespace ot {
 
+class Child;
+
 /**
  * @addtogroup core-arp
  *
@@ -378,6 +380,7 @@ private:
     const char *ListToString(const CacheEntryList *aList) const;
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
+    static bool                         CanAnswerQueryFor(const Child &aChild);
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
     static const char *EntryChangeToString(EntryChange aChange);
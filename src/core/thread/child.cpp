@@ -80,6 +80,7 @@ void Child::Clear(void)
 
     ClearAllBytes(*this);
     Init(instance);
+    Get<ChildTable>().UpdateIndexes(*this);
 }
 
 void Child::ClearIp6Addresses(void)
@@ -89,6 +90,7 @@ void Child::ClearIp6Addresses(void)
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     mMlrRegisteredSet.Clear();
 #endif
+    Get<ChildTable>().UpdateIndexes(*this);
 }
 
 void Child::SetDeviceMode(Mle::DeviceMode aMode)
@@ -166,6 +168,11 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     error = mIp6Addresses.PushBack(aAddress);
 
 exit:
+    if (error == kErrorNone)
+    {
+        Get<ChildTable>().UpdateIndexes(*this);
+    }
+
     return error;
 }
 
@@ -206,6 +213,11 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     error = kErrorNone;
 
 exit:
+    if (error == kErrorNone)
+    {
+        Get<ChildTable>().UpdateIndexes(*this);
+    }
+
     return error;
 }
 
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the compact child mask.
+ */
+
+#include "child_mask.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/heap.hpp"
+
+namespace ot {
+
+void CompactChildMask::Clear(void)
+{
+    if (mBitSet != nullptr)
+    {
+        Heap::Free(mBitSet);
+        mBitSet = nullptr;
+    }
+
+    mLength = 0;
+}
+
+bool CompactChildMask::Has(uint16_t aChildIndex) const
+{
+    bool has = false;
+
+    if (mBitSet != nullptr)
+    {
+        ExitNow(has = mBitSet->Has(aChildIndex));
+    }
+
+    for (uint8_t i = 0; (i < mLength) && (mList[i] <= aChildIndex); i++)
+    {
+        if (mList[i] == aChildIndex)
+        {
+            ExitNow(has = true);
+        }
+    }
+
+exit:
+    return has;
+}
+
+Error CompactChildMask::Add(uint16_t aChildIndex)
+{
+    Error   error = kErrorNone;
+    uint8_t index;
+
+    if (mBitSet != nullptr)
+    {
+        mBitSet->Add(aChildIndex);
+        ExitNow();
+    }
+
+    index = 0;
+
+    while ((index < mLength) && (mList[index] < aChildIndex))
+    {
+        index++;
+    }
+
+    VerifyOrExit((index == mLength) || (mList[index] != aChildIndex));
+
+    if (mLength < kListSize)
+    {
+        memmove(&mList[index + 1], &mList[index], (mLength - index) * sizeof(mList[0]));
+        mList[index] = aChildIndex;
+        mLength++;
+        ExitNow();
+    }
+
+    // The inline list is full, spill to a heap-allocated bit-set.
+
+    mBitSet = static_cast<ChildBitSet *>(Heap::CAlloc(1, sizeof(ChildBitSet)));
+    VerifyOrExit(mBitSet != nullptr, error = kErrorNoBufs);
+
+    for (index = 0; index < mLength; index++)
+    {
+        mBitSet->Add(mList[index]);
+    }
+
+    mBitSet->Add(aChildIndex);
+    mLength = 0;
+
+exit:
+    return error;
+}
+
+void CompactChildMask::Remove(uint16_t aChildIndex)
+{
+    if (mBitSet != nullptr)
+    {
+        mBitSet->Remove(aChildIndex);
+
+        if (mBitSet->IsEmpty())
+        {
+            Clear();
+        }
+
+        ExitNow();
+    }
+
+    for (uint8_t index = 0; index < mLength; index++)
+    {
+        if (mList[index] == aChildIndex)
+        {
+            mLength--;
+            memmove(&mList[index], &mList[index + 1], (mLength - index) * sizeof(mList[0]));
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+} // namespace ot
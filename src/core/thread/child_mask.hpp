@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/bit_set.hpp"
+#include "common/error.hpp"
 
 namespace ot {
 
@@ -49,11 +50,94 @@ namespace ot {
  * @{
  */
 
+/**
+ * Represents a compact set of child table indexes.
+ *
+ * Small sets are stored inline as a sorted list of child indexes. When the list is full, the set spills to a
+ * heap-allocated bit-set covering all children. This keeps the inline size independent of
+ * `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`.
+ *
+ * An all-zero `CompactChildMask` represents an empty set, so it can be initialized by clearing the bytes of the object
+ * containing it. `Clear()` MUST be called before a non-empty `CompactChildMask` is discarded so that the heap-allocated
+ * bit-set (if any) is freed.
+ */
+class CompactChildMask
+{
+public:
+    /**
+     * Clears the set (removes all child indexes and frees any heap-allocated bit-set).
+     */
+    void Clear(void);
+
+    /**
+     * Indicates whether the set is empty.
+     *
+     * @retval TRUE   The set is empty.
+     * @retval FALSE  The set is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0) && (mBitSet == nullptr); }
+
+    /**
+     * Indicates whether the set contains a given child index.
+     *
+     * @param[in] aChildIndex  The child index.
+     *
+     * @retval TRUE   The set contains @p aChildIndex.
+     * @retval FALSE  The set does not contain @p aChildIndex.
+     */
+    bool Has(uint16_t aChildIndex) const;
+
+    /**
+     * Adds a child index to the set.
+     *
+     * @param[in] aChildIndex  The child index to add.
+     *
+     * @retval kErrorNone    Successfully added @p aChildIndex (or it was already in the set).
+     * @retval kErrorNoBufs  The inline list is full and could not allocate the bit-set.
+     */
+    Error Add(uint16_t aChildIndex);
+
+    /**
+     * Removes a child index from the set.
+     *
+     * @param[in] aChildIndex  The child index to remove.
+     */
+    void Remove(uint16_t aChildIndex);
+
+    /**
+     * Indicates whether the set has spilled from the inline list to a heap-allocated bit-set.
+     *
+     * @retval TRUE   The set uses a heap-allocated bit-set.
+     * @retval FALSE  The set uses the inline list.
+     */
+    bool IsSpilled(void) const { return (mBitSet != nullptr); }
+
+private:
+    static constexpr uint8_t kListSize = OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE;
+
+    typedef BitSet<OPENTHREAD_CONFIG_MLE_MAX_CHILDREN> ChildBitSet;
+
+    uint8_t      mLength;
+    uint16_t     mList[kListSize];
+    ChildBitSet *mBitSet;
+};
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE
+
+/**
+ * Represents the set of children (child table indexes) used in message metadata.
+ */
+typedef CompactChildMask ChildMask;
+
+#else
+
 /**
  * Represents a bit-set of child mask.
  */
 typedef BitSet<OPENTHREAD_CONFIG_MLE_MAX_CHILDREN> ChildMask;
 
+#endif
+
 /**
  * @}
  */
@@ -35,6 +35,7 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -74,6 +75,52 @@ exit:
     return;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// `ChildTable::Index`
+
+template <uint16_t kNumEntries> void ChildTable::Index<kNumEntries>::Clear(void)
+{
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        mHeads[i]   = kNone;
+        mNext[i]    = kNone;
+        mBuckets[i] = kNone;
+    }
+}
+
+template <uint16_t kNumEntries> void ChildTable::Index<kNumEntries>::Add(uint16_t aEntry, uint32_t aHash)
+{
+    uint16_t bucket = static_cast<uint16_t>(aHash % kNumEntries);
+
+    OT_ASSERT(mBuckets[aEntry] == kNone);
+
+    mNext[aEntry]    = mHeads[bucket];
+    mHeads[bucket]   = aEntry;
+    mBuckets[aEntry] = bucket;
+}
+
+template <uint16_t kNumEntries> void ChildTable::Index<kNumEntries>::Remove(uint16_t aEntry)
+{
+    uint16_t *link;
+
+    VerifyOrExit(mBuckets[aEntry] != kNone);
+
+    for (link = &mHeads[mBuckets[aEntry]]; *link != kNone; link = &mNext[*link])
+    {
+        if (*link == aEntry)
+        {
+            *link = mNext[aEntry];
+            break;
+        }
+    }
+
+    mNext[aEntry]    = kNone;
+    mBuckets[aEntry] = kNone;
+
+exit:
+    return;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // `ChildTable`
 
@@ -99,6 +146,10 @@ void ChildTable::Clear(void)
     {
         child.Clear();
     }
+
+    mRloc16Index.Clear();
+    mExtAddressIndex.Clear();
+    mIp6AddressIndex.Clear();
 }
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex) { return mChildren.At(aChildIndex); }
@@ -136,7 +187,37 @@ uint16_t ChildTable::AllocateNewChildRloc16(void)
 
 const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
-    return mChildren.FindMatching(aMatcher);
+    const Child               *child = nullptr;
+    const Index<kMaxChildren> *index;
+    uint16_t                   entry;
+
+    VerifyOrExit(IsIndexable(aMatcher.mStateFilter), child = mChildren.FindMatching(aMatcher));
+
+    if (aMatcher.mExtAddress != nullptr)
+    {
+        index = &mExtAddressIndex;
+        entry = index->GetFirst(Hash(*aMatcher.mExtAddress));
+    }
+    else if (aMatcher.mShortAddress != Mac::kShortAddrInvalid)
+    {
+        index = &mRloc16Index;
+        entry = index->GetFirst(Hash(aMatcher.mShortAddress));
+    }
+    else
+    {
+        ExitNow(child = mChildren.FindMatching(aMatcher));
+    }
+
+    for (; entry != index->kNone; entry = index->GetNext(entry))
+    {
+        if (mChildren[entry].Matches(aMatcher))
+        {
+            ExitNow(child = &mChildren[entry]);
+        }
+    }
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
@@ -154,6 +235,57 @@ Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter
     return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
 }
 
+const Child *ChildTable::FindChild(const Ip6::Address &aIp6Address,
+                                   Child::StateFilter  aFilter,
+                                   Predicate           aPredicate) const
+{
+    const Child *child = nullptr;
+    bool         isMeshLocal;
+    uint16_t     index;
+
+    VerifyOrExit(!aIp6Address.IsUnspecified());
+
+    if (!IsIndexable(aFilter))
+    {
+        for (const Child &entry : mChildren)
+        {
+            if (entry.Matches(aFilter) && entry.HasIp6Address(aIp6Address) &&
+                ((aPredicate == nullptr) || aPredicate(entry)))
+            {
+                ExitNow(child = &entry);
+            }
+        }
+
+        ExitNow();
+    }
+
+    isMeshLocal = Get<Mle::Mle>().IsMeshLocalAddress(aIp6Address);
+    index       = mIp6AddressIndex.GetFirst(isMeshLocal ? Hash(aIp6Address.GetIid()) : Hash(aIp6Address));
+
+    for (; index != mIp6AddressIndex.kNone; index = mIp6AddressIndex.GetNext(index))
+    {
+        const Child &entry = mChildren[index / kMaxChildIpAddresses];
+
+        // The mesh-local IID is tracked at offset zero and other
+        // addresses at non-zero offsets, so entries from a different
+        // address kind that happen to share the bucket are skipped.
+
+        if (((index % kMaxChildIpAddresses) == 0) != isMeshLocal)
+        {
+            continue;
+        }
+
+        if (entry.Matches(aFilter) && entry.HasIp6Address(aIp6Address) &&
+            ((aPredicate == nullptr) || aPredicate(entry)))
+        {
+            ExitNow(child = &entry);
+        }
+    }
+
+exit:
+    return child;
+}
+
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
 {
     return mChildren.ContainsMatching(Child::AddressMatcher(aFilter));
@@ -324,20 +456,78 @@ exit:
 
 bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
 {
-    bool hasChild = false;
+    const Child *child = FindChild(aIp6Address, Child::kInStateValidOrRestoring);
 
-    for (const Child &child : mChildren)
+    return (child != nullptr) && !child->IsRxOnWhenIdle();
+}
+
+void ChildTable::UpdateIndexes(const Neighbor &aNeighbor)
+{
+    const Child *child;
+    uint16_t     childIndex;
+    uint16_t     ip6Entry;
+
+    VerifyOrExit(Contains(aNeighbor));
+
+    child      = static_cast<const Child *>(&aNeighbor);
+    childIndex = static_cast<uint16_t>(child - mChildren.GetArrayBuffer());
+    ip6Entry   = childIndex * kMaxChildIpAddresses;
+
+    mRloc16Index.Remove(childIndex);
+    mExtAddressIndex.Remove(childIndex);
+
+    for (uint16_t offset = 0; offset < kMaxChildIpAddresses; offset++)
     {
-        if (child.IsStateValidOrRestoring() && !child.IsRxOnWhenIdle() && child.HasIp6Address(aIp6Address))
-        {
-            hasChild = true;
-            break;
-        }
+        mIp6AddressIndex.Remove(ip6Entry + offset);
+    }
+
+    // Entries in `kStateInvalid` are not indexed. Lookups with a
+    // state filter accepting invalid entries use a linear search.
+
+    VerifyOrExit(!child->IsStateInvalid());
+
+    mRloc16Index.Add(childIndex, Hash(child->GetRloc16()));
+    mExtAddressIndex.Add(childIndex, Hash(child->GetExtAddress()));
+
+    if (!child->GetMeshLocalIid().IsUnspecified())
+    {
+        mIp6AddressIndex.Add(ip6Entry, Hash(child->GetMeshLocalIid()));
+    }
+
+    for (const Ip6::Address &address : child->GetIp6Addresses())
+    {
+        ip6Entry++;
+        mIp6AddressIndex.Add(ip6Entry, Hash(address));
     }
 
-    return hasChild;
+exit:
+    return;
+}
+
+bool ChildTable::IsIndexable(Child::StateFilter aFilter)
+{
+    bool indexable = true;
+
+    switch (aFilter)
+    {
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        indexable = false;
+        break;
+    default:
+        break;
+    }
+
+    return indexable;
 }
 
+uint32_t ChildTable::Hash(const Mac::ExtAddress &aExtAddress) { return Fnv1aHash().Feed(aExtAddress); }
+
+uint32_t ChildTable::Hash(const Ip6::InterfaceIdentifier &aIid) { return Fnv1aHash().Feed(aIid); }
+
+uint32_t ChildTable::Hash(const Ip6::Address &aAddress) { return Fnv1aHash().Feed(aAddress); }
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 
 Error ChildTable::OverrideMaxChildIpAddresses(uint8_t aMaxIpAddresses)
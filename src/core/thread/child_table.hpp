@@ -43,6 +43,7 @@
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "thread/child.hpp"
 
 namespace ot {
@@ -56,6 +57,16 @@ class ChildTable : public InstanceLocator, private NonCopyable
     class IteratorBuilder;
 
 public:
+    /**
+     * Represents a predicate function used to accept or reject a candidate `Child` entry during a search.
+     *
+     * @param[in] aChild  The candidate child.
+     *
+     * @retval TRUE   The child is accepted.
+     * @retval FALSE  The child is rejected.
+     */
+    typedef bool (*Predicate)(const Child &aChild);
+
     /**
      * Represents an iterator for iterating through the child entries in the child table.
      */
@@ -175,6 +186,61 @@ public:
      */
     Child *FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter);
 
+    /**
+     * Searches the child table for a `Child` with a given registered IPv6 address also matching a given state
+     * filter.
+     *
+     * Both the mesh-local EID and the other registered IPv6 addresses of the child are considered.
+     *
+     * @param[in]  aIp6Address  A reference to an IPv6 address.
+     * @param[in]  aFilter      A child state filter.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `nullptr` otherwise.
+     */
+    Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter)
+    {
+        return AsNonConst(AsConst(this)->FindChild(aIp6Address, aFilter));
+    }
+
+    /**
+     * Searches the child table for a `Child` with a given registered IPv6 address also matching a given state
+     * filter.
+     *
+     * @param[in]  aIp6Address  A reference to an IPv6 address.
+     * @param[in]  aFilter      A child state filter.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `nullptr` otherwise.
+     */
+    const Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter) const
+    {
+        return FindChild(aIp6Address, aFilter, nullptr);
+    }
+
+    /**
+     * Searches the child table for a `Child` with a given registered IPv6 address also matching a given state
+     * filter and accepted by a given predicate.
+     *
+     * A child that has the address and matches @p aFilter but is rejected by @p aPredicate is skipped, and the
+     * search continues with the next candidate.
+     *
+     * @param[in]  aIp6Address  A reference to an IPv6 address.
+     * @param[in]  aFilter      A child state filter.
+     * @param[in]  aPredicate   A function returning `true` if a child is accepted, or `nullptr` to accept any child.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `nullptr` otherwise.
+     */
+    const Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, Predicate aPredicate) const;
+
+    /**
+     * Updates the lookup indexes of the child table for a given neighbor.
+     *
+     * MUST be called whenever the state, RLOC16, extended address or registered IPv6 addresses of a child entry
+     * change. Does nothing if @p aNeighbor is not an entry in the child table.
+     *
+     * @param[in]  aNeighbor  A reference to the neighbor (child entry) that changed.
+     */
+    void UpdateIndexes(const Neighbor &aNeighbor);
+
     /**
      * Indicates whether the child table contains any child matching a given state filter.
      *
@@ -348,6 +414,40 @@ private:
     static constexpr uint16_t kMaxChildren         = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
     static constexpr uint8_t  kMaxChildIpAddresses = OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD;
 
+    static_assert(kMaxChildren <= Mle::kMaxChildId,
+                  "OPENTHREAD_CONFIG_MLE_MAX_CHILDREN exceeds the number of child IDs");
+
+    // Each child uses `kMaxChildIpAddresses` entries in the IPv6
+    // address index: the entry at offset zero tracks the mesh-local
+    // IID, and the following ones track `Child::GetIp6Addresses()`.
+    static constexpr uint16_t kNumIp6IndexEntries = kMaxChildren * kMaxChildIpAddresses;
+
+    static_assert(kNumIp6IndexEntries < NumericLimits<uint16_t>::kMax, "Too many children or addresses per child");
+
+    template <uint16_t kNumEntries> class Index
+    {
+        // Chained hash index mapping key hash values to entry numbers
+        // (e.g., child table index). It only tracks which bucket each
+        // entry is linked in. Callers validate the candidate entries
+        // when iterating over a bucket to resolve hash collisions.
+
+    public:
+        static constexpr uint16_t kNone = NumericLimits<uint16_t>::kMax;
+
+        Index(void) { Clear(); }
+
+        void     Clear(void);
+        void     Add(uint16_t aEntry, uint32_t aHash);
+        void     Remove(uint16_t aEntry);
+        uint16_t GetFirst(uint32_t aHash) const { return mHeads[aHash % kNumEntries]; }
+        uint16_t GetNext(uint16_t aEntry) const { return mNext[aEntry]; }
+
+    private:
+        uint16_t mHeads[kNumEntries];
+        uint16_t mNext[kNumEntries];
+        uint16_t mBuckets[kNumEntries];
+    };
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -369,11 +469,20 @@ private:
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
+    static bool     IsIndexable(Child::StateFilter aFilter);
+    static uint32_t Hash(uint16_t aRloc16) { return aRloc16; }
+    static uint32_t Hash(const Mac::ExtAddress &aExtAddress);
+    static uint32_t Hash(const Ip6::InterfaceIdentifier &aIid);
+    static uint32_t Hash(const Ip6::Address &aAddress);
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMaxChildIpAddresses;
 #endif
     Array<Child, kMaxChildren, uint16_t> mChildren;
     uint16_t                             mNextChildId;
+    Index<kMaxChildren>                  mRloc16Index;
+    Index<kMaxChildren>                  mExtAddressIndex;
+    Index<kNumIp6IndexEntries>           mIp6AddressIndex;
 };
 
 } // namespace ot
@@ -43,7 +43,11 @@ CslTxScheduler::CslTxScheduler(Instance &aInstance)
     , mNeighborCslWindow(0)
     , mFrameContext()
     , mTimer(aInstance)
+#if OPENTHREAD_FTD
+    , mWindowHeap(*this)
+#endif
 {
+    mCounters.Clear();
     HandleRadioBusLatencyChanged();
 }
 
@@ -102,6 +106,28 @@ exit:
     return;
 }
 
+#if OPENTHREAD_FTD
+
+void CslTxScheduler::Update(Child &aChild)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    if (IsCslTxCandidate(aChild))
+    {
+        mNextWindows[childIndex] =
+            aChild.DetermineNextCslWindow(Get<Radio::Radio>().GetNow(), mCslFrameRequestAheadUs);
+        mWindowHeap.Update(childIndex);
+    }
+    else
+    {
+        mWindowHeap.Remove(childIndex);
+    }
+
+    Update();
+}
+
+#endif // OPENTHREAD_FTD
+
 void CslTxScheduler::Clear(void)
 {
 #if OPENTHREAD_FTD
@@ -115,6 +141,8 @@ void CslTxScheduler::Clear(void)
         child.SetCslPhase(0);
         child.SetCslLastHeard(TimeMilli(0));
     }
+
+    mWindowHeap.Clear();
 #endif
 
     mFrameContext.mMessageNextOffset = 0;
@@ -136,22 +164,11 @@ void CslTxScheduler::RescheduleCslTx(void)
     mCslTxNeighbor = nullptr;
 
 #if OPENTHREAD_FTD
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-    {
-        Radio::Time64 txWindow;
+    mCslTxNeighbor = PeekEarliestCslChild(radioNow);
 
-        if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
-        {
-            continue;
-        }
-
-        txWindow = child.DetermineNextCslWindow(radioNow, mCslFrameRequestAheadUs);
-
-        if ((mCslTxNeighbor == nullptr) || (txWindow < mNeighborCslWindow))
-        {
-            mCslTxNeighbor     = &child;
-            mNeighborCslWindow = txWindow;
-        }
+    if (mCslTxNeighbor != nullptr)
+    {
+        mNeighborCslWindow = mNextWindows[mWindowHeap.GetTop()];
     }
 #endif
 
@@ -167,6 +184,52 @@ void CslTxScheduler::RescheduleCslTx(void)
     }
 }
 
+#if OPENTHREAD_FTD
+
+Child *CslTxScheduler::PeekEarliestCslChild(Radio::Time64 aRadioNow)
+{
+    Child *child = nullptr;
+
+    while (!mWindowHeap.IsEmpty())
+    {
+        uint16_t childIndex = mWindowHeap.GetTop();
+
+        child = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if ((child == nullptr) || !IsCslTxCandidate(*child))
+        {
+            child = nullptr;
+            mWindowHeap.Remove(childIndex);
+            continue;
+        }
+
+        // A window computed earlier stays the next one until it comes
+        // within the frame request lead time. Only the top entry is
+        // checked since all others are at or after it.
+
+        VerifyOrExit(mNextWindows[childIndex] < aRadioNow + mCslFrameRequestAheadUs);
+
+        mNextWindows[childIndex] = child->DetermineNextCslWindow(aRadioNow, mCslFrameRequestAheadUs);
+        mWindowHeap.Update(childIndex);
+        child = nullptr;
+    }
+
+exit:
+    return child;
+}
+
+bool CslTxScheduler::IsCslTxCandidate(const Child &aChild)
+{
+    return !aChild.IsStateInvalid() && aChild.IsCslSynchronized() && (aChild.GetIndirectMessageCount() > 0);
+}
+
+bool CslTxScheduler::IsWindowEarlier(uint16_t aChildIndexA, uint16_t aChildIndexB) const
+{
+    return mNextWindows[aChildIndexA] < mNextWindows[aChildIndexB];
+}
+
+#endif // OPENTHREAD_FTD
+
 void CslTxScheduler::HandleTimer(void)
 {
     VerifyOrExit(mCslTxNeighbor != nullptr);
@@ -284,8 +347,11 @@ Mac::TxFrame *CslTxScheduler::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     // If MAC was delayed by other operations and started the CSL TX
     // operation late, the target window may be missed, so we abort.
 
+    mCounters.mTxWindows++;
+
     if (mNeighborCslWindow < Get<Radio::Radio>().GetNow())
     {
+        mCounters.mMissedWindows++;
         frame = nullptr;
         ExitNow();
     }
@@ -33,8 +33,10 @@
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
 
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
+#include "common/min_heap.hpp"
 #include "common/non_copyable.hpp"
 #include "common/time.hpp"
 #include "common/timer.hpp"
@@ -54,6 +56,7 @@ namespace ot {
  * @{
  */
 
+class Child;
 class CslNeighbor;
 
 /**
@@ -68,6 +71,15 @@ class CslTxScheduler : public InstanceLocator, private NonCopyable
 public:
     static constexpr uint8_t kMaxCslTriggeredTxAttempts = OPENTHREAD_CONFIG_MAC_MAX_TX_ATTEMPTS_INDIRECT_POLLS;
 
+    /**
+     * Represents the CSL tx scheduler counters.
+     */
+    struct Counters : public Clearable<Counters>
+    {
+        uint32_t mTxWindows;     ///< Number of CSL windows for which a frame was requested by MAC.
+        uint32_t mMissedWindows; ///< Number of CSL windows that had already passed when MAC requested the frame.
+    };
+
     /**
      * Defines all the neighbor info required for scheduling CSL transmissions.
      *
@@ -230,17 +242,58 @@ public:
      */
     void Update(void);
 
+#if OPENTHREAD_FTD
+    /**
+     * Updates the CSL transmission schedule after a change to a given child.
+     *
+     * Should be called when the CSL parameters (synchronization, period, phase, last RX timestamp) or the pending
+     * indirect message of @p aChild change. The child's next CSL window is re-determined before performing `Update()`.
+     *
+     * @param[in] aChild  The child whose CSL state or pending indirect message changed.
+     */
+    void Update(Child &aChild);
+#endif
+
     /**
      * Clears all the states inside `CslTxScheduler` and the related states in each child.
      */
     void Clear(void);
 
+    /**
+     * Gets the CSL tx scheduler counters.
+     *
+     * @returns The CSL tx scheduler counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the CSL tx scheduler counters.
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     typedef IndirectSenderBase::FrameContext FrameContext;
 
     void RescheduleCslTx(void);
     void HandleTimer(void);
 
+#if OPENTHREAD_FTD
+    // Children that may need a CSL transmission are kept in the
+    // min-heap `mWindowHeap`, holding child indexes ordered by their
+    // next CSL tx window in `mNextWindows`. A heap entry is
+    // re-validated only when it reaches the top, so children that
+    // lose CSL sync or their indirect message are dropped lazily.
+
+    static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+
+    Child *PeekEarliestCslChild(Radio::Time64 aRadioNow);
+    bool   IsWindowEarlier(uint16_t aChildIndexA, uint16_t aChildIndexB) const;
+
+    static bool IsCslTxCandidate(const Child &aChild);
+
+    using WindowHeap = MinHeap<CslTxScheduler, kMaxChildren, &CslTxScheduler::IsWindowEarlier>;
+#endif
+
     // Callbacks from `Mac`
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     void          HandleSentFrame(const Mac::TxFrame &aFrame, Error aError);
@@ -257,6 +310,11 @@ private:
     Radio::Time64 mNeighborCslWindow;
     FrameContext  mFrameContext;
     CslTxTimer    mTimer;
+    Counters      mCounters;
+#if OPENTHREAD_FTD
+    WindowHeap    mWindowHeap;
+    Radio::Time64 mNextWindows[kMaxChildren];
+#endif
 };
 
 /**
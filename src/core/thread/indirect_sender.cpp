@@ -99,7 +99,11 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     childIndex = Get<ChildTable>().GetChildIndex(aChild);
     VerifyOrExit(!aMessage.GetIndirectTxChildMask().Has(childIndex));
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_ENABLE
+    SuccessOrExit(aMessage.GetIndirectTxChildMask().Add(childIndex));
+#else
     aMessage.GetIndirectTxChildMask().Add(childIndex);
+#endif
     mSourceMatchController.IncrementMessageCount(aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
@@ -151,7 +155,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -214,7 +218,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
     }
 
@@ -252,7 +256,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
         aChild.SetWaitingForMessageUpdate(true);
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
 
         ExitNow();
@@ -285,7 +289,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
     aChild.SetWaitingForMessageUpdate(true);
     mDataPollHandler.RequestFrameChange(DataPollHandler::kReplaceFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -311,7 +315,7 @@ void IndirectSender::UpdateIndirectMessage(Child &aChild)
     aChild.SetIndirectTxSuccess(true);
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
     if (message != nullptr)
@@ -441,7 +445,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
     {
         aChild.SetIndirectFragmentOffset(nextOffset);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
         ExitNow();
     }
@@ -978,7 +978,10 @@ bool Mle::IsCslSupported(void) const { return IsChild() && GetParent().IsThreadV
 
 void Mle::InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo)
 {
-    aNeighbor.GetExtAddress().SetFromIid(aRxInfo.mMessageInfo.GetPeerAddr().GetIid());
+    Mac::ExtAddress extAddress;
+
+    extAddress.SetFromIid(aRxInfo.mMessageInfo.GetPeerAddr().GetIid());
+    aNeighbor.SetExtAddress(extAddress);
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.GetLinkInfo().AddRss(aRxInfo.mMessage.GetAverageRss());
     aNeighbor.ResetLinkFailures();
@@ -1629,6 +1632,8 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     SuccessOrExit(error = aMessage.ReadAtAndAdvanceOffset(command));
 
+    mRxTlvIndex.Build(aMessage);
+
     extAddr.SetFromIid(aMessageInfo.GetPeerAddr().GetIid());
     neighbor = (command == kCommandChildIdResponse) ? mNeighborTable.FindParent(extAddr)
                                                     : mNeighborTable.FindNeighbor(extAddr);
@@ -1859,6 +1864,8 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 #endif
 
 exit:
+    mRxTlvIndex.Clear();
+
     // We skip logging failures for broadcast MLE messages since it
     // can be common to receive such messages from adjacent Thread
     // networks.
@@ -1977,7 +1984,7 @@ void Mle::HandleAdvertisement(RxInfo &aRxInfo)
 
     VerifyOrExit(IsAttached());
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeAdvertisement, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -2044,7 +2051,7 @@ void Mle::HandleDataResponse(RxInfo &aRxInfo)
     {
         OffsetRange offsetRange;
 
-        if (Tlv::FindTlvValueOffsetRange(aRxInfo.mMessage, Tlv::kLinkMetricsReport, offsetRange) == kErrorNone)
+        if (aRxInfo.mMessage.FindTlvValueOffsetRange(Tlv::kLinkMetricsReport, offsetRange) == kErrorNone)
         {
             Get<LinkMetrics::Initiator>().HandleReport(aRxInfo.mMessage, offsetRange,
                                                        aRxInfo.mMessageInfo.GetPeerAddr());
@@ -2108,7 +2115,7 @@ Error Mle::HandleLeaderData(RxInfo &aRxInfo)
         VerifyOrExit(IsNetworkDataNewer(leaderData));
     }
 
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, activeTimestamp))
+    switch (aRxInfo.mMessage.Find<ActiveTimestampTlv>(activeTimestamp))
     {
     case kErrorNone:
 #if OPENTHREAD_FTD
@@ -2136,7 +2143,7 @@ Error Mle::HandleLeaderData(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, pendingTimestamp))
+    switch (aRxInfo.mMessage.Find<PendingTimestampTlv>(pendingTimestamp))
     {
     case kErrorNone:
 #if OPENTHREAD_FTD
@@ -2260,7 +2267,7 @@ void Mle::HandleChildUpdateRequestOnChild(RxInfo &aRxInfo)
         mPrevRoleRestorer.HandleChildUpdateRequest(aRxInfo);
     }
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeChildUpdateRequestAsChild, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -2287,7 +2294,7 @@ void Mle::HandleChildUpdateRequestOnChild(RxInfo &aRxInfo)
     {
         uint8_t status;
 
-        switch (Tlv::Find<StatusTlv>(aRxInfo.mMessage, status))
+        switch (aRxInfo.mMessage.Find<StatusTlv>(status))
         {
         case kErrorNone:
             VerifyOrExit(status != kStatusError, IgnoreError(BecomeDetached()));
@@ -2308,7 +2315,7 @@ void Mle::HandleChildUpdateRequestOnChild(RxInfo &aRxInfo)
         {
             SuccessOrExit(error = HandleLeaderData(aRxInfo));
 
-            switch (Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMarginOut))
+            switch (aRxInfo.mMessage.Find<LinkMarginTlv>(linkMarginOut))
             {
             case kErrorNone:
                 mParent.SetLinkQualityOut(LinkQualityForLinkMargin(linkMarginOut));
@@ -2426,7 +2433,7 @@ void Mle::HandleChildUpdateResponseOnChild(RxInfo &aRxInfo)
         OT_ASSERT(false);
     }
 
-    if (Tlv::Find<StatusTlv>(aRxInfo.mMessage, status) == kErrorNone)
+    if (aRxInfo.mMessage.Find<StatusTlv>(status) == kErrorNone)
     {
         IgnoreError(BecomeDetached());
         ExitNow();
@@ -2459,7 +2466,7 @@ void Mle::HandleChildUpdateResponseOnChild(RxInfo &aRxInfo)
         OT_FALL_THROUGH;
 
     case kRoleChild:
-        SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+        SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
         if (!HasMatchingRouterIdWith(sourceAddress))
         {
@@ -2469,7 +2476,7 @@ void Mle::HandleChildUpdateResponseOnChild(RxInfo &aRxInfo)
 
         SuccessOrExit(error = HandleLeaderData(aRxInfo));
 
-        switch (Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout))
+        switch (aRxInfo.mMessage.Find<TimeoutTlv>(timeout))
         {
         case kErrorNone:
             SuccessOrExit(mDetacher.HandleChildUpdateResponse(timeout));
@@ -2514,7 +2521,7 @@ void Mle::HandleChildUpdateResponseOnChild(RxInfo &aRxInfo)
         OT_ASSERT(false);
     }
 
-    switch (Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMarginOut))
+    switch (aRxInfo.mMessage.Find<LinkMarginTlv>(linkMarginOut))
     {
     case kErrorNone:
         mParent.SetLinkQualityOut(LinkQualityForLinkMargin(linkMarginOut));
@@ -4061,14 +4068,109 @@ exit:
 
 #endif // OPENTHREAD_FTD
 
+//---------------------------------------------------------------------------------------------------------------------
+// RxTlvIndex
+
+void Mle::RxTlvIndex::Clear(void)
+{
+    mMessage     = nullptr;
+    mOffset      = 0;
+    mLength      = 0;
+    mNumEntries  = 0;
+    mIsTruncated = false;
+}
+
+void Mle::RxTlvIndex::Build(const Message &aMessage)
+{
+    // Parses all TLVs in `aMessage` (from its current offset) in a
+    // single pass. Parsing stops at the first malformed TLV, which
+    // matches the behavior of `Tlv::Info::FindIn()`. If there are
+    // more TLVs than `kMaxEntries`, the index is marked as truncated
+    // and lookups for TLVs not in the index fall back to scanning
+    // the message.
+
+    OffsetRange offsetRange;
+
+    Clear();
+
+    mMessage = &aMessage;
+    mOffset  = aMessage.GetOffset();
+    mLength  = aMessage.GetLength();
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
+
+    while (!offsetRange.IsEmpty())
+    {
+        if (mNumEntries == kMaxEntries)
+        {
+            mIsTruncated = true;
+            break;
+        }
+
+        SuccessOrExit(mEntries[mNumEntries].ParseFrom(aMessage, offsetRange));
+        offsetRange.AdvanceOffset(mEntries[mNumEntries].GetSize());
+        mNumEntries++;
+    }
+
+exit:
+    return;
+}
+
+bool Mle::RxTlvIndex::IsBuiltFor(const Message &aMessage) const
+{
+    // The offset and length are also checked to detect if the message
+    // was changed after the index was built.
+
+    return (mMessage == &aMessage) && (mOffset == aMessage.GetOffset()) && (mLength == aMessage.GetLength());
+}
+
+Error Mle::RxTlvIndex::Find(const Message &aMessage, uint8_t aType, Tlv::Info &aInfo) const
+{
+    Error error = kErrorNone;
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        if (mEntries[index].GetType() == aType)
+        {
+            aInfo = mEntries[index];
+            ExitNow();
+        }
+    }
+
+    VerifyOrExit(mIsTruncated, error = kErrorNotFound);
+    error = aInfo.FindIn(aMessage, aType);
+
+exit:
+    return error;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // RxMessage
 
+Error Mle::RxMessage::FindTlv(uint8_t aType, Tlv::Info &aInfo) const
+{
+    const RxTlvIndex &tlvIndex = GetInstance().Get<Mle>().mRxTlvIndex;
+
+    return tlvIndex.IsBuiltFor(*this) ? tlvIndex.Find(*this, aType, aInfo) : aInfo.FindIn(*this, aType);
+}
+
+Error Mle::RxMessage::FindTlvValueOffsetRange(uint8_t aType, OffsetRange &aOffsetRange) const
+{
+    Error     error;
+    Tlv::Info info;
+
+    SuccessOrExit(error = FindTlv(aType, info));
+    aOffsetRange = info.GetValueOffsetRange();
+
+exit:
+    return error;
+}
+
 bool Mle::RxMessage::ContainsTlv(Tlv::Type aTlvType) const
 {
-    OffsetRange offsetRange;
+    Tlv::Info info;
 
-    return Tlv::FindTlvValueOffsetRange(*this, aTlvType, offsetRange) == kErrorNone;
+    return FindTlv(aTlvType, info) == kErrorNone;
 }
 
 Error Mle::RxMessage::ReadModeTlv(DeviceMode &aMode) const
@@ -4076,7 +4178,7 @@ Error Mle::RxMessage::ReadModeTlv(DeviceMode &aMode) const
     Error   error;
     uint8_t modeBitmask;
 
-    SuccessOrExit(error = Tlv::Find<ModeTlv>(*this, modeBitmask));
+    SuccessOrExit(error = Find<ModeTlv>(modeBitmask));
     aMode.Set(modeBitmask);
 
 exit:
@@ -4087,7 +4189,7 @@ Error Mle::RxMessage::ReadVersionTlv(uint16_t &aVersion) const
 {
     Error error;
 
-    SuccessOrExit(error = Tlv::Find<VersionTlv>(*this, aVersion));
+    SuccessOrExit(error = Find<VersionTlv>(aVersion));
     VerifyOrExit(aVersion >= kThreadVersion1p1, error = kErrorParse);
 
 exit:
@@ -4099,7 +4201,7 @@ Error Mle::RxMessage::ReadChallengeOrResponse(uint8_t aTlvType, RxChallenge &aRx
     Error       error;
     OffsetRange offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, aTlvType, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(aTlvType, offsetRange));
     error = aRxChallenge.ReadFrom(*this, offsetRange);
 
 exit:
@@ -4132,9 +4234,9 @@ Error Mle::RxMessage::ReadFrameCounterTlvs(uint32_t &aLinkFrameCounter, uint32_t
 {
     Error error;
 
-    SuccessOrExit(error = Tlv::Find<LinkFrameCounterTlv>(*this, aLinkFrameCounter));
+    SuccessOrExit(error = Find<LinkFrameCounterTlv>(aLinkFrameCounter));
 
-    switch (Tlv::Find<MleFrameCounterTlv>(*this, aMleFrameCounter))
+    switch (Find<MleFrameCounterTlv>(aMleFrameCounter))
     {
     case kErrorNone:
         break;
@@ -4155,7 +4257,7 @@ Error Mle::RxMessage::ReadLeaderDataTlv(LeaderData &aLeaderData) const
     Error              error;
     LeaderDataTlvValue tlvValue;
 
-    SuccessOrExit(error = Tlv::Find<LeaderDataTlv>(*this, tlvValue));
+    SuccessOrExit(error = Find<LeaderDataTlv>(tlvValue));
     tlvValue.Get(aLeaderData);
 
 exit:
@@ -4168,7 +4270,7 @@ Error Mle::RxMessage::ReadConnectivityTlv(Connectivity &aConnectivity) const
     ConnectivityTlvValue tlvValue;
     OffsetRange          offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, ConnectivityTlv::kType, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(ConnectivityTlv::kType, offsetRange));
     SuccessOrExit(error = tlvValue.ParseFrom(*this, offsetRange));
     tlvValue.GetConnectivity(aConnectivity);
 
@@ -4181,7 +4283,7 @@ Error Mle::RxMessage::ReadAndSetNetworkDataTlv(const LeaderData &aLeaderData) co
     Error       error;
     OffsetRange offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, Tlv::kNetworkData, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(Tlv::kNetworkData, offsetRange));
 
     error = Get<NetworkData::Leader>().SetNetworkData(aLeaderData.GetDataVersion(NetworkData::kFullSet),
                                                       aLeaderData.GetDataVersion(NetworkData::kStableSubset),
@@ -4208,7 +4310,7 @@ Error Mle::RxMessage::ReadAndSaveDataset(MeshCoP::Dataset::Type    aDatasetType,
     MeshCoP::Dataset dataset;
     OffsetRange      offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, tlvType, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(tlvType, offsetRange));
 
     SuccessOrExit(error = dataset.SetFrom(*this, offsetRange));
     SuccessOrExit(error = dataset.ValidateTlvs());
@@ -4233,7 +4335,7 @@ Error Mle::RxMessage::ReadTlvRequestTlv(TlvList &aTlvList) const
     Error       error;
     OffsetRange offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, Tlv::kTlvRequest, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(Tlv::kTlvRequest, offsetRange));
 
     offsetRange.ShrinkLength(aTlvList.GetMaxSize());
 
@@ -4250,7 +4352,7 @@ Error Mle::RxMessage::ReadCslClockAccuracyTlv(Mac::CslAccuracy &aCslAccuracy) co
     Error                    error;
     CslClockAccuracyTlvValue tlvValue;
 
-    SuccessOrExit(error = Tlv::Find<CslClockAccuracyTlv>(*this, tlvValue));
+    SuccessOrExit(error = Find<CslClockAccuracyTlv>(tlvValue));
     tlvValue.Get(aCslAccuracy);
 
 exit:
@@ -4265,7 +4367,7 @@ Error Mle::RxMessage::ReadRouteTlv(RouteTlv::Data &aRouteTlvData) const
     Error       error;
     OffsetRange offsetRange;
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(*this, RouteTlv::kType, offsetRange));
+    SuccessOrExit(error = FindTlvValueOffsetRange(RouteTlv::kType, offsetRange));
     error = aRouteTlvData.ParseFrom(*this, offsetRange);
 
 exit:
@@ -5285,7 +5387,7 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
     Mac::ExtAddress  extAddress;
     Mac::CslAccuracy cslAccuracy;
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeParentResponse, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -5304,7 +5406,7 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadLeaderDataTlv(leaderData));
 
-    SuccessOrExit(error = Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMarginOut));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<LinkMarginTlv>(linkMarginOut));
     twoWayLinkMargin = Min(Get<Mac::Mac>().ComputeLinkMargin(rss), linkMarginOut);
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadConnectivityTlv(connectivity));
@@ -5413,7 +5515,7 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
     {
         TimeParameterTlvValue tlvValue;
 
-        if (Tlv::Find<TimeParameterTlv>(aRxInfo.mMessage, tlvValue) == kErrorNone)
+        if (aRxInfo.mMessage.Find<TimeParameterTlv>(tlvValue) == kErrorNone)
         {
             Get<TimeSync>().SetTimeSyncPeriod(tlvValue.GetTimeSyncPeriod());
             Get<TimeSync>().SetXtalThreshold(tlvValue.GetXtalThreshold());
@@ -5463,7 +5565,7 @@ void Mle::Attacher::HandleChildIdResponse(RxInfo &aRxInfo)
     uint16_t           shortAddress;
     MeshCoP::Timestamp timestamp;
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeChildIdResponse, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -5471,14 +5573,14 @@ void Mle::Attacher::HandleChildIdResponse(RxInfo &aRxInfo)
 
     VerifyOrExit(mState == kStateChildIdRequest);
 
-    SuccessOrExit(error = Tlv::Find<Address16Tlv>(aRxInfo.mMessage, shortAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<Address16Tlv>(shortAddress));
     VerifyOrExit(RouterIdMatch(sourceAddress, shortAddress), error = kErrorRejected);
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadLeaderDataTlv(leaderData));
 
     VerifyOrExit(aRxInfo.mMessage.ContainsTlv(Tlv::kNetworkData));
 
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<ActiveTimestampTlv>(timestamp))
     {
     case kErrorNone:
         error = aRxInfo.mMessage.ReadAndSaveActiveDataset(timestamp);
@@ -5499,7 +5601,7 @@ void Mle::Attacher::HandleChildIdResponse(RxInfo &aRxInfo)
         Get<MeshCoP::PendingDatasetManager>().Clear();
     }
 
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<PendingTimestampTlv>(timestamp))
     {
     case kErrorNone:
         IgnoreError(aRxInfo.mMessage.ReadAndSavePendingDataset(timestamp));
@@ -5974,11 +6076,11 @@ void Mle::AnnounceHandler::HandleAnnounce(RxInfo &aRxInfo)
 
     Log(kMessageReceive, kTypeAnnounce, aRxInfo.mMessageInfo.GetPeerAddr());
 
-    SuccessOrExit(error = Tlv::Find<ChannelTlv>(aRxInfo.mMessage, channelTlvValue));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<ChannelTlv>(channelTlvValue));
     channel = static_cast<uint8_t>(channelTlvValue.GetChannel());
 
-    SuccessOrExit(error = Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp));
-    SuccessOrExit(error = Tlv::Find<PanIdTlv>(aRxInfo.mMessage, panId));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<ActiveTimestampTlv>(timestamp));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<PanIdTlv>(panId));
 
     aRxInfo.mClass = RxInfo::kPeerMessage;
 
@@ -1662,9 +1662,39 @@ private:
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    class RxTlvIndex
+    {
+        // Index of the TLVs in a received MLE message. It is built in a
+        // single pass when the message is received so that subsequent
+        // TLV lookups on the message do not rescan it from the start.
+        // Duplicate TLVs are kept in message order.
+
+    public:
+        RxTlvIndex(void) { Clear(); }
+
+        void  Clear(void);
+        void  Build(const Message &aMessage);
+        bool  IsBuiltFor(const Message &aMessage) const;
+        Error Find(const Message &aMessage, uint8_t aType, Tlv::Info &aInfo) const;
+
+    private:
+        static constexpr uint8_t kMaxEntries = OPENTHREAD_CONFIG_MLE_RX_TLV_INDEX_SIZE;
+
+        const Message *mMessage;
+        uint16_t       mOffset;
+        uint16_t       mLength;
+        uint8_t        mNumEntries;
+        bool           mIsTruncated;
+        Tlv::Info      mEntries[kMaxEntries];
+    };
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
     class RxMessage : public Message
     {
     public:
+        Error FindTlv(uint8_t aType, Tlv::Info &aInfo) const;
+        Error FindTlvValueOffsetRange(uint8_t aType, OffsetRange &aOffsetRange) const;
         bool  ContainsTlv(Tlv::Type aTlvType) const;
         Error ReadModeTlv(DeviceMode &aMode) const;
         Error ReadVersionTlv(uint16_t &aVersion) const;
@@ -1685,6 +1715,18 @@ private:
         Error ReadRouteTlv(RouteTlv::Data &aRouteTlvData) const;
 #endif
 
+        template <typename TlvType, typename ValueType> Error Find(ValueType &aValue) const
+        {
+            Error     error;
+            Tlv::Info info;
+
+            SuccessOrExit(error = FindTlv(TlvType::kType, info));
+            error = info.Read<TlvType>(*this, aValue);
+
+        exit:
+            return error;
+        }
+
     private:
         Error ReadChallengeOrResponse(uint8_t aTlvType, RxChallenge &aRxChallenge) const;
         Error ReadAndSaveDataset(MeshCoP::Dataset::Type aDatasetType, const MeshCoP::Timestamp &aTimestamp) const;
@@ -2651,6 +2693,7 @@ private:
     Detacher         mDetacher;
     RetxTracker      mRetxTracker;
     AnnounceHandler  mAnnounceHandler;
+    RxTlvIndex       mRxTlvIndex;
 #if OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE
     ParentSearch mParentSearch;
 #endif
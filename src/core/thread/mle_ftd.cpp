@@ -768,7 +768,7 @@ void Mle::HandleLinkRequest(RxInfo &aRxInfo)
 
     info.mLinkMargin = Get<Mac::Mac>().ComputeLinkMargin(aRxInfo.mMessage.GetAverageRss());
 
-    switch (Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, info.mRloc16))
+    switch (aRxInfo.mMessage.Find<SourceAddressTlv>(info.mRloc16))
     {
     case kErrorNone:
         if (IsRouterRloc16(info.mRloc16))
@@ -818,7 +818,7 @@ void Mle::HandleLinkRequest(RxInfo &aRxInfo)
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     if (neighbor != nullptr)
     {
-        neighbor->SetTimeSyncEnabled(Tlv::Find<TimeRequestTlv>(aRxInfo.mMessage, nullptr, 0) == kErrorNone);
+        neighbor->SetTimeSyncEnabled(aRxInfo.mMessage.ContainsTlv(Tlv::kTimeRequest));
     }
 #endif
 
@@ -958,7 +958,7 @@ void Mle::HandleLinkAcceptVariant(RxInfo &aRxInfo, MessageType aMessageType)
     bool            shouldUpdateRoutes = false;
     Mac::ExtAddress extAddress;
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, aMessageType, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -996,7 +996,7 @@ void Mle::HandleLinkAcceptVariant(RxInfo &aRxInfo, MessageType aMessageType)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadFrameCounterTlvs(linkFrameCounter, mleFrameCounter));
 
-    switch (Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMargin))
+    switch (aRxInfo.mMessage.Find<LinkMarginTlv>(linkMargin))
     {
     case kErrorNone:
         break;
@@ -1014,7 +1014,7 @@ void Mle::HandleLinkAcceptVariant(RxInfo &aRxInfo, MessageType aMessageType)
     switch (mRole)
     {
     case kRoleDetached:
-        SuccessOrExit(error = Tlv::Find<Address16Tlv>(aRxInfo.mMessage, address16));
+        SuccessOrExit(error = aRxInfo.mMessage.Find<Address16Tlv>(address16));
         VerifyOrExit(GetRloc16() == address16, error = kErrorDrop);
 
         SuccessOrExit(error = aRxInfo.mMessage.ReadLeaderDataTlv(leaderData));
@@ -1437,7 +1437,11 @@ Error Mle::HandleAdvertisementOnFtd(RxInfo &aRxInfo, uint16_t aSourceAddress, co
 
     router->SetLastHeard(TimerMilli::GetNow());
 
-    mRouterTable.UpdateRoutes(routeTlvData, routerId);
+    // Advertisements from multiple neighbors often arrive in bursts
+    // (e.g., after trickle timer resets), so the route update is
+    // scheduled and coalesced with others.
+
+    mRouterTable.ScheduleRouteUpdate(routeTlvData, routerId);
 
 exit:
     if (aRxInfo.mNeighbor && aRxInfo.mNeighbor->GetRloc16() != aSourceAddress)
@@ -1536,7 +1540,7 @@ void Mle::HandleParentRequest(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadVersionTlv(version));
 
-    SuccessOrExit(error = Tlv::Find<ScanMaskTlv>(aRxInfo.mMessage, scanMask));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<ScanMaskTlv>(scanMask));
 
     switch (mRole)
     {
@@ -1566,7 +1570,7 @@ void Mle::HandleParentRequest(RxInfo &aRxInfo)
         InitNeighbor(*child, aRxInfo);
         child->SetState(Neighbor::kStateParentRequest);
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-        child->SetTimeSyncEnabled(Tlv::Find<TimeRequestTlv>(aRxInfo.mMessage, nullptr, 0) == kErrorNone);
+        child->SetTimeSyncEnabled(aRxInfo.mMessage.ContainsTlv(Tlv::kTimeRequest));
 #endif
         if (aRxInfo.mMessage.ReadModeTlv(mode) == kErrorNone)
         {
@@ -1716,7 +1720,7 @@ void Mle::HandleTimeTick(void)
         {
             LogInfo("Child 0x%04x CSL synchronization expired", child.GetRloc16());
             child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
+            Get<CslTxScheduler>().Update(child);
         }
 #endif
 
@@ -1911,7 +1915,7 @@ Error Mle::ProcessAddressRegistrationTlv(RxInfo &aRxInfo, Child &aChild)
 
     OT_UNUSED_VARIABLE(storedCount);
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(aRxInfo.mMessage, Tlv::kAddressRegistration, offsetRange));
+    SuccessOrExit(error = aRxInfo.mMessage.FindTlvValueOffsetRange(Tlv::kAddressRegistration, offsetRange));
 
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     aChild.GetAllMlrRegisteredAddresses(oldMlrRegisteredAddresses);
@@ -2065,11 +2069,11 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadModeTlv(mode));
 
-    SuccessOrExit(error = Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<TimeoutTlv>(timeout));
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadTlvRequestTlv(tlvList));
 
-    switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+    switch (aRxInfo.mMessage.Find<SupervisionIntervalTlv>(supervisionInterval))
     {
     case kErrorNone:
         tlvList.Add(Tlv::kSupervisionInterval);
@@ -2081,7 +2085,7 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<ActiveTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::ActiveDatasetManager>().GetTimestamp())
@@ -2099,7 +2103,7 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<PendingTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::PendingDatasetManager>().GetTimestamp())
@@ -2292,7 +2296,7 @@ void Mle::HandleChildUpdateRequestOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout))
+    switch (aRxInfo.mMessage.Find<TimeoutTlv>(timeout))
     {
     case kErrorNone:
         if (child->GetTimeout() != timeout)
@@ -2311,7 +2315,7 @@ void Mle::HandleChildUpdateRequestOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+    switch (aRxInfo.mMessage.Find<SupervisionIntervalTlv>(supervisionInterval))
     {
     case kErrorNone:
         info.mTlvList.Add(Tlv::kSupervisionInterval);
@@ -2345,7 +2349,7 @@ void Mle::HandleChildUpdateRequestOnParent(RxInfo &aRxInfo)
         ChannelTlvValue cslChannelTlvValue;
         uint32_t        cslTimeout;
 
-        switch (Tlv::Find<CslTimeoutTlv>(aRxInfo.mMessage, cslTimeout))
+        switch (aRxInfo.mMessage.Find<CslTimeoutTlv>(cslTimeout))
         {
         case kErrorNone:
             child->SetCslTimeout(cslTimeout);
@@ -2358,7 +2362,7 @@ void Mle::HandleChildUpdateRequestOnParent(RxInfo &aRxInfo)
             ExitNow(error = kErrorNone);
         }
 
-        if (Tlv::Find<CslChannelTlv>(aRxInfo.mMessage, cslChannelTlvValue) == kErrorNone)
+        if (aRxInfo.mMessage.Find<CslChannelTlv>(cslChannelTlvValue) == kErrorNone)
         {
             // Special value of zero is used to indicate that
             // CSL channel is not specified.
@@ -2452,7 +2456,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
 
     Log(kMessageReceive, kTypeChildUpdateResponseOfChild, aRxInfo.mMessageInfo.GetPeerAddr(), child->GetRloc16());
 
-    switch (Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress))
+    switch (aRxInfo.mMessage.Find<SourceAddressTlv>(sourceAddress))
     {
     case kErrorNone:
         if (child->GetRloc16() != sourceAddress)
@@ -2470,7 +2474,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<StatusTlv>(aRxInfo.mMessage, status))
+    switch (aRxInfo.mMessage.Find<StatusTlv>(status))
     {
     case kErrorNone:
         VerifyOrExit(status != kStatusError, RemoveNeighbor(*child));
@@ -2481,7 +2485,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<LinkFrameCounterTlv>(aRxInfo.mMessage, linkFrameCounter))
+    switch (aRxInfo.mMessage.Find<LinkFrameCounterTlv>(linkFrameCounter))
     {
     case kErrorNone:
         child->GetLinkFrameCounters().SetAll(linkFrameCounter);
@@ -2493,7 +2497,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<MleFrameCounterTlv>(aRxInfo.mMessage, mleFrameCounter))
+    switch (aRxInfo.mMessage.Find<MleFrameCounterTlv>(mleFrameCounter))
     {
     case kErrorNone:
         child->SetMleFrameCounter(mleFrameCounter);
@@ -2504,7 +2508,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorNone);
     }
 
-    switch (Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout))
+    switch (aRxInfo.mMessage.Find<TimeoutTlv>(timeout))
     {
     case kErrorNone:
         child->SetTimeout(timeout);
@@ -2518,7 +2522,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
     {
         uint16_t supervisionInterval;
 
-        switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+        switch (aRxInfo.mMessage.Find<SupervisionIntervalTlv>(supervisionInterval))
         {
         case kErrorNone:
             child->SetSupervisionInterval(supervisionInterval);
@@ -2573,7 +2577,7 @@ void Mle::HandleDataRequest(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadTlvRequestTlv(tlvList));
 
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<ActiveTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::ActiveDatasetManager>().GetTimestamp())
@@ -2591,7 +2595,7 @@ void Mle::HandleDataRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (aRxInfo.mMessage.Find<PendingTimestampTlv>(timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::PendingDatasetManager>().GetTimestamp())
@@ -2702,7 +2706,7 @@ void Mle::HandleDiscoveryRequest(RxInfo &aRxInfo)
 
     VerifyOrExit(IsRouterRoleAllowed(), error = kErrorInvalidState);
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(aRxInfo.mMessage, Tlv::kDiscovery, offsetRange));
+    SuccessOrExit(error = aRxInfo.mMessage.FindTlvValueOffsetRange(Tlv::kDiscovery, offsetRange));
 
     for (; !offsetRange.IsEmpty(); offsetRange.AdvanceOffset(tlvInfo.GetSize()))
     {
@@ -299,7 +299,7 @@ void Mle::P2p::HandleP2pLinkAcceptVariant(RxInfo &aRxInfo, MessageType aMessageT
     SuccessOrExit(error = aRxInfo.mMessage.ReadResponseTlv(response));
     VerifyOrExit(response == peer->GetChallenge(), error = kErrorSecurity);
     SuccessOrExit(error = aRxInfo.mMessage.ReadFrameCounterTlvs(linkFrameCounter, mleFrameCounter));
-    SuccessOrExit(error = Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMargin));
+    SuccessOrExit(error = aRxInfo.mMessage.Find<LinkMarginTlv>(linkMargin));
 
     Get<Mle>().InitNeighbor(*peer, aRxInfo);
 
@@ -35,6 +35,7 @@
 
 #include "common/clearable.hpp"
 #include "common/code_utils.hpp"
+#include "common/frame_data.hpp"
 #include "common/numeric_limits.hpp"
 #include "radio/radio.hpp"
 
@@ -46,14 +47,26 @@ namespace Mle {
 
 Error RouteTlv::Data::ParseFrom(const Message &aMessage, const OffsetRange &aOffsetRange)
 {
+    // The route data is parsed from a `FrameData` view of the TLV
+    // value. When the value is contiguous in the message (common
+    // case) the bytes are used in place, otherwise they are copied
+    // once into `buffer`. This avoids per-entry message reads.
+
+    static constexpr uint16_t kMaxParseLength = sizeof(RouterIdMask) + kMaxRouters * sizeof(EntryType);
+
     Error        error;
     RouterIdMask routerIdMask;
     OffsetRange  offsetRange = aOffsetRange;
+    uint8_t      buffer[kMaxParseLength];
+    FrameData    frameData;
 #if OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
     bool isEven = true;
 #endif
 
-    SuccessOrExit(error = aMessage.ReadAndAdvance(offsetRange, routerIdMask));
+    offsetRange.ShrinkLength(kMaxParseLength);
+    SuccessOrExit(error = aMessage.GetView(offsetRange, buffer, frameData));
+
+    SuccessOrExit(error = frameData.Read(routerIdMask));
 
     mIdSequence = routerIdMask.GetSequence();
 
@@ -78,23 +91,23 @@ Error RouteTlv::Data::ParseFrom(const Message &aMessage, const OffsetRange &aOff
         entry->mRouterId = routerId;
 
 #if !OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
-        SuccessOrExit(error = aMessage.ReadAndAdvance<uint8_t>(offsetRange, entry->mRouteData));
+        SuccessOrExit(error = frameData.ReadUint8(entry->mRouteData));
 #else
         {
             EntryType value;
 
-            SuccessOrExit(error = aMessage.Read<EntryType>(offsetRange, value));
-            value = BigEndian::HostSwap16(value);
+            VerifyOrExit(frameData.CanRead(sizeof(EntryType)), error = kErrorParse);
+            value = BigEndian::ReadUint16(frameData.GetBytes());
 
             if (isEven)
             {
                 entry->mRouteData = ReadBits<uint16_t, kEvenEntryMask>(value);
-                offsetRange.AdvanceOffset(sizeof(uint8_t));
+                frameData.SkipOver(sizeof(uint8_t));
             }
             else
             {
                 entry->mRouteData = ReadBits<uint16_t, kOddEntryMask>(value);
-                offsetRange.AdvanceOffset(sizeof(uint16_t));
+                frameData.SkipOver(sizeof(uint16_t));
             }
 
             isEven = !isEven;
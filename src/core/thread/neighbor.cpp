@@ -39,14 +39,53 @@ namespace ot {
 
 void Neighbor::SetState(State aState)
 {
+    bool wasInvalid;
+
     VerifyOrExit(mState != aState);
-    mState = static_cast<uint8_t>(aState);
+
+    wasInvalid = IsStateInvalid();
+    mState     = static_cast<uint8_t>(aState);
 
     if (mState == kStateValid)
     {
         mConnectionStart = Get<UptimeTracker>().GetUptimeInSeconds();
     }
 
+#if OPENTHREAD_FTD
+    if (wasInvalid || IsStateInvalid())
+    {
+        Get<ChildTable>().UpdateIndexes(*this);
+    }
+#else
+    OT_UNUSED_VARIABLE(wasInvalid);
+#endif
+
+exit:
+    return;
+}
+
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    VerifyOrExit(mMacAddr != aAddress);
+    mMacAddr = aAddress;
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().UpdateIndexes(*this);
+#endif
+
+exit:
+    return;
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    VerifyOrExit(mRloc16 != aRloc16);
+    mRloc16 = aRloc16;
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().UpdateIndexes(*this);
+#endif
+
 exit:
     return;
 }
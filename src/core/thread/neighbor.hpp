@@ -174,6 +174,10 @@ public:
         bool Matches(const Neighbor &aNeighbor) const;
 
     private:
+#if OPENTHREAD_FTD
+        friend class ChildTable;
+#endif
+
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
             , mShortAddress(aShortAddress)
@@ -342,19 +346,15 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * Returns the Extended Address.
-     *
-     * @returns A reference to the Extended Address.
-     */
-    Mac::ExtAddress &GetExtAddress(void) { return mMacAddr; }
-
     /**
      * Sets the Extended Address.
      *
+     * The Extended Address can only be changed through this method so that the child table lookup indexes remain
+     * up to date.
+     *
      * @param[in]  aAddress  The Extended Address value to set.
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -454,7 +454,7 @@ public:
      *
      * @param[in]  aRloc16  The RLOC16 value.
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -243,14 +243,17 @@ template <> void Leader::HandleTmf<kUriServerData>(Coap::Msg &aMsg)
 
     if (Tlv::FindTlvValueOffsetRange(aMsg.mMessage, ThreadNetworkDataTlv::kType, offsetRange) == kErrorNone)
     {
-        uint8_t bytes[kMaxSize];
+        uint8_t   bytes[kMaxSize];
+        FrameData frameData;
 
-        VerifyOrExit(offsetRange.GetLength() <= kMaxSize);
+        // Use the TLV value in place when it is contiguous in the
+        // message, otherwise it is copied into `bytes`.
 
-        aMsg.mMessage.ReadBytes(offsetRange, bytes);
+        VerifyOrExit(offsetRange.GetLength() <= kMaxSize);
+        SuccessOrExit(aMsg.mMessage.GetView(offsetRange, bytes, frameData));
 
         {
-            NetworkData networkData(GetInstance(), bytes, static_cast<uint8_t>(offsetRange.GetLength()));
+            NetworkData networkData(GetInstance(), frameData.GetBytes(), static_cast<uint8_t>(frameData.GetLength()));
 
             RegisterNetworkData(aMsg.mMessageInfo.GetPeerAddr().GetIid().GetLocator(), networkData);
         }
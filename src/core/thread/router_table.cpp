@@ -40,6 +40,7 @@ RouterTable::RouterTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRouters(aInstance)
     , mChangedTask(aInstance)
+    , mRouteUpdateTask(aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::Generate<uint8_t>())
     , mEvents(0)
@@ -48,6 +49,7 @@ RouterTable::RouterTable(Instance &aInstance)
     , mMaxRouterId(Mle::kMaxRouterId)
 #endif
 {
+    mRouteUpdateCounters.Clear();
     Clear();
 }
 
@@ -58,6 +60,7 @@ void RouterTable::Clear(void)
     ClearNeighbors();
     mRouterIdMap.Clear();
     mRouters.Clear();
+    mPendingRouteUpdates.Clear();
     SignalTableChanged(events);
 }
 
@@ -114,6 +117,7 @@ void RouterTable::RemoveRouter(Router &aRouter)
         Get<NeighborTable>().Signal(NeighborTable::kRouterRemoved, aRouter);
     }
 
+    mPendingRouteUpdates.RemoveMatching(aRouter.GetRouterId());
     mRouterIdMap.Release(aRouter.GetRouterId());
     mRouters.Remove(aRouter);
 
@@ -585,28 +589,108 @@ exit:
 
 void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId)
 {
-    Router                           *neighbor;
-    Mle::RouterIdMask                 finitePathCostIds;
-    uint8_t                           linkCostToNeighbor;
-    const Mle::RouteTlv::Data::Entry *matchingEntry;
+    Mle::RouterIdMask finitePathCostIds;
 
-    neighbor = FindRouterById(aNeighborId);
-    VerifyOrExit(neighbor != nullptr);
+    // A pending route update from the same neighbor is older than
+    // `aRouteTlvData`, so it is discarded.
+
+    mPendingRouteUpdates.RemoveMatching(aNeighborId);
+
+    DetermineFinitePathCostIds(finitePathCostIds);
+    ApplyRouteTlvData(aRouteTlvData, aNeighborId);
+    ResetAdvertiseIntervalOnPathCostChange(finitePathCostIds);
+}
+
+void RouterTable::ScheduleRouteUpdate(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId)
+{
+    PendingRouteUpdate *update = mPendingRouteUpdates.FindMatching(aNeighborId);
+
+    mRouteUpdateCounters.mScheduled++;
+
+    if (update != nullptr)
+    {
+        mRouteUpdateCounters.mReplaced++;
+    }
+    else
+    {
+        if (mPendingRouteUpdates.IsFull())
+        {
+            ProcessPendingRouteUpdates();
+        }
 
-    // Before updating the routes, we track which routers have finite
-    // path cost. After the update we check again to see if any path
-    // cost changed from finite to infinite or vice versa to decide
-    // whether to reset the  MLE Advertisement interval.
+        update              = mPendingRouteUpdates.PushBack();
+        update->mNeighborId = aNeighborId;
+    }
+
+    update->mRouteTlvData = aRouteTlvData;
+    mRouteUpdateTask.Post();
+}
+
+void RouterTable::ProcessPendingRouteUpdates(void)
+{
+    // Processes all pending route updates together. The path costs
+    // are checked once before and once after applying all updates
+    // to decide whether to reset the MLE Advertisement interval.
+
+    Mle::RouterIdMask finitePathCostIds;
+
+    VerifyOrExit(!mPendingRouteUpdates.IsEmpty());
+    VerifyOrExit(Get<Mle::Mle>().IsRouterOrLeader());
+
+    mRouteUpdateCounters.mRecomputations++;
+
+    DetermineFinitePathCostIds(finitePathCostIds);
 
-    finitePathCostIds.Clear();
+    for (const PendingRouteUpdate &update : mPendingRouteUpdates)
+    {
+        ApplyRouteTlvData(update.mRouteTlvData, update.mNeighborId);
+    }
+
+    ResetAdvertiseIntervalOnPathCostChange(finitePathCostIds);
+
+exit:
+    mPendingRouteUpdates.Clear();
+}
+
+void RouterTable::DetermineFinitePathCostIds(Mle::RouterIdMask &aRouterIdMask) const
+{
+    aRouterIdMask.Clear();
 
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
     {
         if (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost)
         {
-            finitePathCostIds.Add(routerId);
+            aRouterIdMask.Add(routerId);
+        }
+    }
+}
+
+void RouterTable::ResetAdvertiseIntervalOnPathCostChange(const Mle::RouterIdMask &aFinitePathCostIds)
+{
+    // Checks whether any path cost changed from finite to infinite
+    // or vice versa since `aFinitePathCostIds` was determined.
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        bool oldCostFinite = aFinitePathCostIds.IsAllocated(routerId);
+        bool newCostFinite = (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost);
+
+        if (newCostFinite != oldCostFinite)
+        {
+            Get<Mle::Mle>().ResetAdvertiseInterval();
+            break;
         }
     }
+}
+
+void RouterTable::ApplyRouteTlvData(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId)
+{
+    Router                           *neighbor;
+    uint8_t                           linkCostToNeighbor;
+    const Mle::RouteTlv::Data::Entry *matchingEntry;
+
+    neighbor = FindRouterById(aNeighborId);
+    VerifyOrExit(neighbor != nullptr);
 
     // Find the entry corresponding to our Router ID in the received
     // `aRouteTlvData` to get the `LinkQualityIn` from the perspective
@@ -696,18 +780,6 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t
         }
     }
 
-    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
-    {
-        bool oldCostFinite = finitePathCostIds.IsAllocated(routerId);
-        bool newCostFinite = (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost);
-
-        if (newCostFinite != oldCostFinite)
-        {
-            Get<Mle::Mle>().ResetAdvertiseInterval();
-            break;
-        }
-    }
-
 exit:
     return;
 }
@@ -33,7 +33,10 @@
 
 #if OPENTHREAD_FTD
 
+#include <openthread/thread_ftd.h>
+
 #include "common/array.hpp"
+#include "common/clearable.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
 #include "common/iterator_utils.hpp"
@@ -52,6 +55,7 @@ namespace ot {
 class RouterTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class UnitTester;
 
 public:
     /**
@@ -74,6 +78,17 @@ public:
      */
     typedef uint16_t Events;
 
+    /**
+     * Represents the counters for route updates from received MLE Advertisements.
+     *
+     * Route updates scheduled using `ScheduleRouteUpdate()` are coalesced and processed together in a single route
+     * recomputation. The number of merged updates (which did not require their own recomputation) is given by
+     * `mScheduled - mRecomputations`.
+     */
+    struct RouteUpdateCounters : public otRouteUpdateCounters, public Clearable<RouteUpdateCounters>
+    {
+    };
+
     /**
      * Constructor.
      *
@@ -357,6 +372,30 @@ public:
      */
     void UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId);
 
+    /**
+     * Schedules an update of the routes based on a received `RouteTlv::Data` from a neighboring router.
+     *
+     * Unlike `UpdateRoutes()`, the routes are not updated immediately. Route updates scheduled before the next tasklet
+     * run are processed together. If a newer `RouteTlv::Data` is scheduled from the same neighbor, it replaces the
+     * pending one.
+     *
+     * @param[in]  aRouteTlvData    The received `RouteTlv::Data`
+     * @param[in]  aNeighborId      The router ID of neighboring router from which @p aRouteTlvData is received.
+     */
+    void ScheduleRouteUpdate(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId);
+
+    /**
+     * Gets the route update counters.
+     *
+     * @returns The route update counters.
+     */
+    const RouteUpdateCounters &GetRouteUpdateCounters(void) const { return mRouteUpdateCounters; }
+
+    /**
+     * Resets the route update counters.
+     */
+    void ResetRouteUpdateCounters(void) { mRouteUpdateCounters.Clear(); }
+
     /**
      * Updates the routes on an FTD child based on a received `RouteTlv::Data` from the parent.
      *
@@ -453,6 +492,11 @@ private:
     bool IsSelfRouterId(uint8_t aRouterId) const;
     void SignalTableChanged(Events aEvents);
     void HandleTableChanged(void);
+    void DetermineFinitePathCostIds(Mle::RouterIdMask &aRouterIdMask) const;
+    void ApplyRouteTlvData(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId);
+    void ResetAdvertiseIntervalOnPathCostChange(const Mle::RouterIdMask &aFinitePathCostIds);
+    void ProcessPendingRouteUpdates(void);
+    void HandleRouteUpdateTask(void) { ProcessPendingRouteUpdates(); }
     void LogEvents(void) const;
     void LogRouteTable(void) const;
 
@@ -489,14 +533,30 @@ private:
         uint8_t mIndexes[Mle::kMaxRouterId + 1];
     };
 
-    using ChangedTask = TaskletIn<RouterTable, &RouterTable::HandleTableChanged>;
+    struct PendingRouteUpdate
+    {
+        bool Matches(uint8_t aNeighborId) const { return mNeighborId == aNeighborId; }
+
+        uint8_t             mNeighborId;
+        Mle::RouteTlv::Data mRouteTlvData;
+    };
+
+    static constexpr uint8_t kMaxPendingRouteUpdates = OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE;
+
+    static_assert(kMaxPendingRouteUpdates > 0, "OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE must be non-zero");
+
+    using ChangedTask     = TaskletIn<RouterTable, &RouterTable::HandleTableChanged>;
+    using RouteUpdateTask = TaskletIn<RouterTable, &RouterTable::HandleRouteUpdateTask>;
 
-    Array<Router, Mle::kMaxRouters> mRouters;
-    ChangedTask                     mChangedTask;
-    RouterIdMap                     mRouterIdMap;
-    TimeMilli                       mRouterIdSequenceLastUpdated;
-    uint8_t                         mRouterIdSequence;
-    Events                          mEvents;
+    Array<Router, Mle::kMaxRouters>                    mRouters;
+    ChangedTask                                        mChangedTask;
+    RouteUpdateTask                                    mRouteUpdateTask;
+    Array<PendingRouteUpdate, kMaxPendingRouteUpdates> mPendingRouteUpdates;
+    RouteUpdateCounters                                mRouteUpdateCounters;
+    RouterIdMap                                        mRouterIdMap;
+    TimeMilli                                          mRouterIdSequenceLastUpdated;
+    uint8_t                                            mRouterIdSequence;
+    Events                                             mEvents;
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMinRouterId;
     uint8_t mMaxRouterId;
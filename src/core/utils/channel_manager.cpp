@@ -246,8 +246,8 @@ Error ChannelManager::FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccupan
     favoredAndSupported = mFavoredChannelMask;
     favoredAndSupported.Intersect(mSupportedChannelMask);
 
-    favoredBest   = Get<ChannelMonitor>().FindBestChannels(favoredAndSupported, favoredOccupancy);
-    supportedBest = Get<ChannelMonitor>().FindBestChannels(mSupportedChannelMask, supportedOccupancy);
+    favoredBest   = FindBestChannels(favoredAndSupported, favoredOccupancy);
+    supportedBest = FindBestChannels(mSupportedChannelMask, supportedOccupancy);
 
     LogInfo("Best favored %s, occupancy 0x%04x", favoredBest.ToString().AsCString(), favoredOccupancy);
     LogInfo("Best overall %s, occupancy 0x%04x", supportedBest.ToString().AsCString(), supportedOccupancy);
@@ -277,6 +277,24 @@ exit:
     return error;
 }
 
+Mac::ChannelMask ChannelManager::FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aCost) const
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS
+    return Get<ChannelMonitor>().FindLeastCostChannels(aMask, aCost);
+#else
+    return Get<ChannelMonitor>().FindBestChannels(aMask, aCost);
+#endif
+}
+
+uint16_t ChannelManager::GetChannelCost(uint8_t aChannel) const
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS
+    return Get<ChannelMonitor>().GetChannelRetxCost(aChannel);
+#else
+    return Get<ChannelMonitor>().GetChannelOccupancy(aChannel);
+#endif
+}
+
 bool ChannelManager::ShouldAttemptChannelChange(void)
 {
     uint16_t ccaFailureRate = Get<Mac::Mac>().GetCcaFailureRate();
@@ -360,7 +378,7 @@ Error ChannelManager::RequestChannelSelect(bool aSkipQualityCheck)
         curChannel = Get<Mac::Mac>().GetPanChannel();
     }
 
-    curOccupancy = Get<ChannelMonitor>().GetChannelOccupancy(curChannel);
+    curOccupancy = GetChannelCost(curChannel);
 
     if (newChannel == curChannel)
     {
@@ -42,6 +42,10 @@
 #error "CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE requires OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE";
 #endif
 
+#if (OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS && !OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE)
+#error "CHANNEL_MANAGER_USE_CHANNEL_STATS requires OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE";
+#endif
+
 #if (OPENTHREAD_FTD || OPENTHREAD_CONFIG_CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE)
 
 #include <openthread/channel_manager.h>
@@ -333,8 +337,10 @@ private:
     void  RequestChannelChange(uint8_t aChannel);
 
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
-    Error FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccupancy);
-    bool  ShouldAttemptChannelChange(void);
+    Error            FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccupancy);
+    Mac::ChannelMask FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aCost) const;
+    uint16_t         GetChannelCost(uint8_t aChannel) const;
+    bool             ShouldAttemptChannelChange(void);
 #endif
 
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE
@@ -64,6 +64,9 @@ ChannelMonitor::ChannelMonitor(Instance &aInstance)
     , mTimer(aInstance)
 {
     ClearAllBytes(mChannelOccupancy);
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    ClearStats();
+#endif
 }
 
 Error ChannelMonitor::Start(void)
@@ -96,6 +99,9 @@ void ChannelMonitor::Clear(void)
     mChannelMaskIndex = 0;
     mSampleCount      = 0;
     ClearAllBytes(mChannelOccupancy);
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    ClearStats();
+#endif
 
     LogDebg("Clearing data");
 }
@@ -132,6 +138,9 @@ void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult)
         {
             mChannelMaskIndex = 0;
             mSampleCount++;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+            HandleStatsSweepDone();
+#endif
             LogResults();
         }
         else
@@ -178,6 +187,10 @@ void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult)
         newAverage = (newAverage * weight + newValue) / (weight + 1);
 
         mChannelOccupancy[channelIndex] = static_cast<uint16_t>(newAverage);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+        UpdateStats(channelIndex, aResult->mMaxRssi, (newValue != 0));
+#endif
     }
 }
 
@@ -227,6 +240,227 @@ Mac::ChannelMask ChannelMonitor::FindBestChannels(const Mac::ChannelMask &aMask,
     return bestMask;
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+
+void ChannelMonitor::ClearStats(void)
+{
+    ClearAllBytes(mStats);
+    ClearAllBytes(mBucketSampleCounts);
+    mCurBucketIndex     = 0;
+    mNumValidBuckets    = 1;
+    mCurBucketStartTime = TimerMilli::GetNow();
+}
+
+void ChannelMonitor::UpdateStats(uint8_t aChannelIndex, int8_t aRssi, bool aIsBusy)
+{
+    // Statistics are updated incrementally per RSSI sample in fixed
+    // memory. The RSSI histogram ages by halving all its bins when
+    // one saturates. The busy count of the current time bucket stops
+    // (along with its sample count) once the bucket is full.
+
+    StatsEntry &entry = mStats[aChannelIndex];
+
+    if (aRssi != Radio::kInvalidRssi)
+    {
+        uint8_t bin = 0;
+
+        if (aRssi >= kRssiBinMin)
+        {
+            bin = Min<uint8_t>(1 + static_cast<uint8_t>((aRssi - kRssiBinMin) / kRssiBinWidth), kNumRssiBins - 1);
+        }
+
+        if (entry.mRssiBins[bin] == kMaxStatsCount)
+        {
+            for (uint16_t &count : entry.mRssiBins)
+            {
+                count /= 2;
+            }
+        }
+
+        entry.mRssiBins[bin]++;
+    }
+
+    if (aIsBusy && (mBucketSampleCounts[mCurBucketIndex] < kMaxStatsCount))
+    {
+        entry.mBusyCounts[mCurBucketIndex]++;
+    }
+}
+
+void ChannelMonitor::HandleStatsSweepDone(void)
+{
+    if (mBucketSampleCounts[mCurBucketIndex] < kMaxStatsCount)
+    {
+        mBucketSampleCounts[mCurBucketIndex]++;
+    }
+
+    VerifyOrExit(TimerMilli::GetNow() - mCurBucketStartTime >= kStatsBucketInterval);
+
+    // Move to the next time bucket, reusing (and clearing) the oldest
+    // one once the ring is full. The start time advances by a whole
+    // interval so that the bucket boundaries do not drift.
+
+    mCurBucketIndex  = (mCurBucketIndex + 1) % kNumTimeBuckets;
+    mNumValidBuckets = Min<uint8_t>(mNumValidBuckets + 1, kNumTimeBuckets);
+    mCurBucketStartTime += kStatsBucketInterval;
+
+    mBucketSampleCounts[mCurBucketIndex] = 0;
+
+    for (StatsEntry &entry : mStats)
+    {
+        entry.mBusyCounts[mCurBucketIndex] = 0;
+    }
+
+exit:
+    return;
+}
+
+uint8_t ChannelMonitor::GetBucketIndex(uint8_t aAge) const
+{
+    return static_cast<uint8_t>((mCurBucketIndex + kNumTimeBuckets - aAge) % kNumTimeBuckets);
+}
+
+uint16_t ChannelMonitor::GetBusyRatio(uint8_t aChannelIndex, uint8_t aBucketIndex) const
+{
+    uint32_t samples = mBucketSampleCounts[aBucketIndex];
+    uint32_t busy    = mStats[aChannelIndex].mBusyCounts[aBucketIndex];
+
+    // The busy count of the current bucket can be ahead of the sample
+    // count while a sweep over all channels is still in progress.
+
+    if (samples == 0)
+    {
+        samples = busy;
+    }
+
+    return (samples == 0) ? 0 : static_cast<uint16_t>(Min(busy, samples) * kMaxOccupancy / samples);
+}
+
+uint16_t ChannelMonitor::GetBusyRatioPercentile(uint8_t aChannelIndex, uint8_t aPercentile) const
+{
+    uint16_t ratios[kNumTimeBuckets];
+
+    // Insertion sort of the (at most `kNumTimeBuckets`) busy ratios,
+    // then pick the nearest rank.
+
+    for (uint8_t age = 0; age < mNumValidBuckets; age++)
+    {
+        uint16_t ratio = GetBusyRatio(aChannelIndex, GetBucketIndex(age));
+        uint8_t  index = age;
+
+        for (; (index > 0) && (ratios[index - 1] > ratio); index--)
+        {
+            ratios[index] = ratios[index - 1];
+        }
+
+        ratios[index] = ratio;
+    }
+
+    return ratios[(mNumValidBuckets * aPercentile + 99) / 100 - 1];
+}
+
+int8_t ChannelMonitor::GetRssiPercentile(const StatsEntry &aEntry, uint8_t aPercentile)
+{
+    int8_t   rssi  = Radio::kInvalidRssi;
+    uint32_t total = 0;
+    uint32_t rank;
+    uint32_t sum = 0;
+
+    for (uint16_t count : aEntry.mRssiBins)
+    {
+        total += count;
+    }
+
+    VerifyOrExit(total != 0);
+
+    rank = Max<uint32_t>((total * aPercentile + 99) / 100, 1);
+
+    for (uint8_t bin = 0; bin < kNumRssiBins; bin++)
+    {
+        sum += aEntry.mRssiBins[bin];
+
+        if (sum >= rank)
+        {
+            rssi = static_cast<int8_t>(kRssiBinMin + bin * kRssiBinWidth);
+            break;
+        }
+    }
+
+exit:
+    return rssi;
+}
+
+Error ChannelMonitor::GetChannelStats(uint8_t aChannel, ChannelStats &aStats) const
+{
+    Error   error = kErrorNone;
+    uint8_t channelIndex;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax), error = kErrorInvalidArgs);
+    channelIndex = aChannel - Radio::kChannelMin;
+
+    ClearAllBytes(aStats);
+
+    memcpy(aStats.mRssiHistogram, mStats[channelIndex].mRssiBins, sizeof(aStats.mRssiHistogram));
+
+    for (uint8_t age = 0; age < mNumValidBuckets; age++)
+    {
+        aStats.mBusyRatios[age] = GetBusyRatio(channelIndex, GetBucketIndex(age));
+    }
+
+    aStats.mNumTimeBuckets  = mNumValidBuckets;
+    aStats.mRssiMedian      = GetRssiPercentile(mStats[channelIndex], kMedianPercentile);
+    aStats.mRssiP90         = GetRssiPercentile(mStats[channelIndex], kP90Percentile);
+    aStats.mBusyRatioMedian = GetBusyRatioPercentile(channelIndex, kMedianPercentile);
+    aStats.mBusyRatioP90    = GetBusyRatioPercentile(channelIndex, kP90Percentile);
+
+exit:
+    return error;
+}
+
+uint16_t ChannelMonitor::GetChannelRetxCost(uint8_t aChannel) const
+{
+    uint16_t cost = 0;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax));
+    cost = Max(mChannelOccupancy[aChannel - Radio::kChannelMin],
+               GetBusyRatioPercentile(aChannel - Radio::kChannelMin, kP90Percentile));
+
+exit:
+    return cost;
+}
+
+Mac::ChannelMask ChannelMonitor::FindLeastCostChannels(const Mac::ChannelMask &aMask, uint16_t &aCost) const
+{
+    uint8_t          channel;
+    Mac::ChannelMask bestMask;
+    uint16_t         minCost = 0xffff;
+
+    bestMask.Clear();
+
+    channel = Mac::ChannelMask::kChannelIteratorFirst;
+
+    while (aMask.GetNextChannel(channel) == kErrorNone)
+    {
+        uint16_t cost = GetChannelRetxCost(channel);
+
+        if (bestMask.IsEmpty() || (cost <= minCost))
+        {
+            if (cost < minCost)
+            {
+                bestMask.Clear();
+            }
+
+            bestMask.AddChannel(channel);
+            minCost = cost;
+        }
+    }
+
+    aCost = minCost;
+
+    return bestMask;
+}
+
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
@@ -38,6 +38,7 @@
 
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 
+#include <openthread/channel_monitor.h>
 #include <openthread/platform/radio.h>
 
 #include "common/locator.hpp"
@@ -170,6 +171,48 @@ public:
      */
     Mac::ChannelMask FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aOccupancy) const;
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    /**
+     * Represents the detailed statistics of a channel.
+     */
+    typedef otChannelMonitorChannelStats ChannelStats;
+
+    /**
+     * Gets the detailed statistics (RSSI histogram and busy ratio per time bucket) for a given channel.
+     *
+     * @param[in]  aChannel   The channel for which to get the statistics.
+     * @param[out] aStats     A reference to a `ChannelStats` to output the statistics.
+     *
+     * @retval kErrorNone         Successfully retrieved the statistics.
+     * @retval kErrorInvalidArgs  @p aChannel is not a valid channel.
+     */
+    Error GetChannelStats(uint8_t aChannel, ChannelStats &aStats) const;
+
+    /**
+     * Returns the estimated retransmission cost of a given channel.
+     *
+     * The cost is the larger of the channel occupancy (@sa GetChannelOccupancy()) and the 90th percentile of the busy
+     * ratio over the time buckets. It uses the same scale as the occupancy (`0xffff` being the worst).
+     *
+     * @param[in]  aChannel     The channel for which to get the cost.
+     *
+     * @returns The estimated retransmission cost of @p aChannel.
+     */
+    uint16_t GetChannelRetxCost(uint8_t aChannel) const;
+
+    /**
+     * Finds the best channel(s) (with least retransmission cost) in a given channel mask.
+     *
+     * Similar to `FindBestChannels()` but compares channels based on `GetChannelRetxCost()`.
+     *
+     * @param[in]  aMask         A channel mask (the search is limited to channels in @p aMask).
+     * @param[out] aCost         A reference to `uint16` to return the cost associated with best channel(s).
+     *
+     * @returns    A channel mask containing the best channels.
+     */
+    Mac::ChannelMask FindLeastCostChannels(const Mac::ChannelMask &aMask, uint16_t &aCost) const;
+#endif
+
 private:
 #if (OPENTHREAD_CONFIG_RADIO_2P4GHZ_OQPSK_SUPPORT && OPENTHREAD_CONFIG_RADIO_915MHZ_OQPSK_SUPPORT)
     static constexpr uint8_t kNumChannelMasks = 8;
@@ -186,6 +229,32 @@ private:
     void        HandleEnergyScanResult(Mac::EnergyScanResult *aResult);
     void        LogResults(void);
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    static constexpr uint8_t  kNumRssiBins         = OT_CHANNEL_MONITOR_NUM_RSSI_BINS;
+    static constexpr int8_t   kRssiBinMin          = OT_CHANNEL_MONITOR_RSSI_BIN_MIN;
+    static constexpr uint8_t  kRssiBinWidth        = OT_CHANNEL_MONITOR_RSSI_BIN_WIDTH;
+    static constexpr uint8_t  kNumTimeBuckets      = OT_CHANNEL_MONITOR_NUM_TIME_BUCKETS;
+    static constexpr uint32_t kStatsBucketInterval = OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_BUCKET_INTERVAL;
+    static constexpr uint16_t kMaxStatsCount       = 0xffff;
+    static constexpr uint8_t  kMedianPercentile    = 50;
+    static constexpr uint8_t  kP90Percentile       = 90;
+
+    struct StatsEntry
+    {
+        uint16_t mRssiBins[kNumRssiBins];
+        uint16_t mBusyCounts[kNumTimeBuckets]; // Number of "bad" RSSI samples per time bucket.
+    };
+
+    void     ClearStats(void);
+    void     UpdateStats(uint8_t aChannelIndex, int8_t aRssi, bool aIsBusy);
+    void     HandleStatsSweepDone(void);
+    uint8_t  GetBucketIndex(uint8_t aAge) const;
+    uint16_t GetBusyRatio(uint8_t aChannelIndex, uint8_t aBucketIndex) const;
+    uint16_t GetBusyRatioPercentile(uint8_t aChannelIndex, uint8_t aPercentile) const;
+
+    static int8_t GetRssiPercentile(const StatsEntry &aEntry, uint8_t aPercentile);
+#endif
+
     using ScanTimer = TimerMilliIn<ChannelMonitor, &ChannelMonitor::HandleTimer>;
 
     static const uint32_t mScanChannelMasks[kNumChannelMasks];
@@ -194,6 +263,13 @@ private:
     uint32_t  mSampleCount : 29;
     uint16_t  mChannelOccupancy[kNumChannels];
     ScanTimer mTimer;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    StatsEntry mStats[kNumChannels];
+    uint16_t   mBucketSampleCounts[kNumTimeBuckets]; // Number of sweeps (samples per channel) per time bucket.
+    uint8_t    mCurBucketIndex;
+    uint8_t    mNumValidBuckets;
+    TimeMilli  mCurBucketStartTime;
+#endif
 };
 
 /**
@@ -46,6 +46,16 @@ namespace HistoryTracker {
 Local::Local(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+    , mFlowBucketStart(TimerMilli::GetNow())
+    , mNumFlowsInBucket(0)
+#endif
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    , mSaveTasklet(aInstance)
+    , mUnsavedList(OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO)
+    , mNumUnsavedEntries(0)
+    , mSaveSequence(0)
+#endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_NET_DATA
     , mPreviousNetworkData(aInstance, mNetworkDataTlvBuffer, 0, sizeof(mNetworkDataTlvBuffer))
 #endif
@@ -63,6 +73,7 @@ void Local::RecordNetworkInfo(void)
     Mle::DeviceMode mode;
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO);
 
     entry->mRole        = MapEnum(Get<Mle::Mle>().GetRole());
     entry->mRloc16      = Get<Mle::Mle>().GetRloc16();
@@ -106,6 +117,10 @@ void Local::RecordMessage(const Message      &aMessage,
     }
 #endif
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+    RecordFlow(aMessage, headers, aMacAddress, aType, aIsTxSuccess);
+#endif
+
     switch (aType)
     {
     case kRxMessage:
@@ -118,9 +133,10 @@ void Local::RecordMessage(const Message      &aMessage,
     }
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry((aType == kRxMessage) ? OT_PLAT_HISTORY_TRACKER_LIST_RX : OT_PLAT_HISTORY_TRACKER_LIST_TX);
 
     entry->mPayloadLength        = headers.GetIp6Header().GetPayloadLength();
-    entry->mNeighborRloc16       = aMacAddress.IsShort() ? aMacAddress.GetShort() : kInvalidRloc16;
+    entry->mNeighborRloc16       = DetermineNeighborRloc16(aMacAddress);
     entry->mSource.mAddress      = headers.GetSourceAddress();
     entry->mSource.mPort         = headers.GetSourcePort();
     entry->mDestination.mAddress = headers.GetDestinationAddress();
@@ -133,16 +149,6 @@ void Local::RecordMessage(const Message      &aMessage,
     entry->mTxSuccess            = (aType == kTxMessage) ? aIsTxSuccess : true;
     entry->mPriority             = aMessage.GetPriority();
 
-    if (aMacAddress.IsExtended())
-    {
-        Neighbor *neighbor = Get<NeighborTable>().FindNeighbor(aMacAddress, Neighbor::kInStateAnyExceptInvalid);
-
-        if (neighbor != nullptr)
-        {
-            entry->mNeighborRloc16 = neighbor->GetRloc16();
-        }
-    }
-
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     if (aMessage.IsRadioTypeSet())
     {
@@ -181,11 +187,113 @@ exit:
     return;
 }
 
+uint16_t Local::DetermineNeighborRloc16(const Mac::Address &aMacAddress) const
+{
+    uint16_t rloc16 = kInvalidRloc16;
+
+    if (aMacAddress.IsShort())
+    {
+        rloc16 = aMacAddress.GetShort();
+    }
+    else if (aMacAddress.IsExtended())
+    {
+        const Neighbor *neighbor =
+            Get<NeighborTable>().FindNeighbor(aMacAddress, Neighbor::kInStateAnyExceptInvalid);
+
+        if (neighbor != nullptr)
+        {
+            rloc16 = neighbor->GetRloc16();
+        }
+    }
+
+    return rloc16;
+}
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+
+void Local::RecordFlow(const Message      &aMessage,
+                       const Ip6::Headers &aHeaders,
+                       const Mac::Address &aMacAddress,
+                       MessageType         aType,
+                       bool                aIsTxSuccess)
+{
+    // Messages are aggregated per flow (source/destination socket
+    // address, protocol, neighbor and direction) within a time
+    // bucket. The flows of the current bucket are always the newest
+    // `mNumFlowsInBucket` entries in `mFlowHistory`, so only those
+    // are searched for a match.
+
+    TimeMilli now            = TimerMilli::GetNow();
+    bool      isTx           = (aType == kTxMessage);
+    uint16_t  neighborRloc16 = DetermineNeighborRloc16(aMacAddress);
+    FlowInfo *entry          = nullptr;
+
+    if (now - mFlowBucketStart >= kFlowBucketInterval)
+    {
+        mFlowBucketStart  = now;
+        mNumFlowsInBucket = 0;
+    }
+
+    for (uint16_t entryNumber = 0; entryNumber < mNumFlowsInBucket; entryNumber++)
+    {
+        FlowInfo *flow = mFlowHistory.GetEntry(entryNumber);
+
+        if (FlowMatches(*flow, aHeaders, neighborRloc16, isTx))
+        {
+            entry = flow;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        entry = mFlowHistory.AddNewEntry();
+        VerifyOrExit(entry != nullptr);
+
+        ClearAllBytes(*entry);
+        entry->mSource.mAddress      = aHeaders.GetSourceAddress();
+        entry->mSource.mPort         = aHeaders.GetSourcePort();
+        entry->mDestination.mAddress = aHeaders.GetDestinationAddress();
+        entry->mDestination.mPort    = aHeaders.GetDestinationPort();
+        entry->mNeighborRloc16       = neighborRloc16;
+        entry->mIpProto              = aHeaders.GetIpProto();
+        entry->mIsTx                 = isTx;
+
+        if (mNumFlowsInBucket < kFlowListSize)
+        {
+            mNumFlowsInBucket++;
+        }
+    }
+
+    entry->mMessageCount++;
+    entry->mByteCount += aMessage.GetLength();
+
+    if (isTx && !aIsTxSuccess)
+    {
+        entry->mTxFailureCount++;
+    }
+
+exit:
+    return;
+}
+
+bool Local::FlowMatches(const FlowInfo &aFlow, const Ip6::Headers &aHeaders, uint16_t aNeighborRloc16, bool aIsTx)
+{
+    return (aFlow.mIsTx == aIsTx) && (aFlow.mNeighborRloc16 == aNeighborRloc16) &&
+           (aFlow.mIpProto == aHeaders.GetIpProto()) && (aFlow.mSource.mPort == aHeaders.GetSourcePort()) &&
+           (aFlow.mDestination.mPort == aHeaders.GetDestinationPort()) &&
+           (AsCoreType(&aFlow.mSource.mAddress) == aHeaders.GetSourceAddress()) &&
+           (AsCoreType(&aFlow.mDestination.mAddress) == aHeaders.GetDestinationAddress());
+}
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+
 void Local::RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo)
 {
     NeighborInfo *entry = mNeighborHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_NEIGHBOR);
 
     switch (aEvent)
     {
@@ -247,6 +355,7 @@ void Local::RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif
     UnicastAddressInfo *entry = mUnicastAddressHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_UNICAST_ADDRESS);
 
     entry->mAddress       = aUnicastAddress.GetAddress();
     entry->mPrefixLength  = aUnicastAddress.GetPrefixLength();
@@ -266,6 +375,7 @@ void Local::RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif
     MulticastAddressInfo *entry = mMulticastAddressHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_MULTICAST_ADDRESS);
 
     entry->mAddress       = aMulticastAddress.GetAddress();
     entry->mAddressOrigin = aMulticastAddress.GetOrigin();
@@ -318,6 +428,7 @@ void Local::RecordRouterTableChange(void)
             }
 
             mRouterHistory.AddNewEntry(entry);
+            SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_ROUTER);
 
             oldEntry.mIsAllocated = true;
             oldEntry.mNextHop     = entry.mNextHop;
@@ -335,6 +446,7 @@ void Local::RecordRouterTableChange(void)
                 entry.mPathCost    = 0;
 
                 mRouterHistory.AddNewEntry(entry);
+                SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_ROUTER);
 
                 oldEntry.mIsAllocated = false;
             }
@@ -458,6 +570,7 @@ void Local::RecordOnMeshPrefixEvent(NetDataEvent aEvent, const NetworkData::OnMe
     OnMeshPrefixInfo *entry = mOnMeshPrefixHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_ON_MESH_PREFIX);
     entry->mPrefix = aPrefix;
     entry->mEvent  = aEvent;
 
@@ -470,6 +583,7 @@ void Local::RecordExternalRouteEvent(NetDataEvent aEvent, const NetworkData::Ext
     ExternalRouteInfo *entry = mExternalRouteHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_EXTERNAL_ROUTE);
     entry->mRoute = aRoute;
     entry->mEvent = aEvent;
 
@@ -484,6 +598,7 @@ void Local::RecordDnsSrpAddrEvent(NetDataEvent
     DnsSrpAddrInfo *entry = mDnsSrpAddrHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_DNS_SRP_ADDR);
 
     entry->mAddress        = aUnicastInfo.mSockAddr.mAddress;
     entry->mRloc16         = aUnicastInfo.mRloc16;
@@ -511,6 +626,7 @@ void Local::RecordDnsSrpAddrEvent(NetDataEvent aEvent, const NetworkData::Servic
     DnsSrpAddrInfo *entry = mDnsSrpAddrHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_DNS_SRP_ADDR);
 
     entry->mAddress        = aAnycastInfo.mAnycastAddress;
     entry->mRloc16         = aAnycastInfo.mRloc16;
@@ -571,6 +687,7 @@ void Local::RecordEpskcEvent(EpskcEvent aEvent)
     EpskcEvent *entry = mEpskcEventHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_EPSKC_EVENT);
     *entry = aEvent;
 
 exit:
@@ -585,6 +702,7 @@ void Local::RecordFavoredOmrPrefix(const Ip6::Prefix &aPrefix, BorderRouter::Rou
     FavoredOmrPrefix *entry = mFavoredOmrPrefixHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_OMR_PREFIX);
 
     entry->mOmrPrefix  = aPrefix;
     entry->mPreference = NetworkData::RoutePreferenceToValue(aPreference);
@@ -599,6 +717,7 @@ void Local::RecordFavoredOnLinkPrefix(const Ip6::Prefix &aPrefix, bool aIsLocal)
     FavoredOnLinkPrefix *entry = mFavoredOnLinkPrefixHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_ON_LINK);
 
     entry->mOnLinkPrefix = aPrefix;
     entry->mIsLocal      = aIsLocal;
@@ -607,7 +726,17 @@ exit:
     return;
 }
 
-AilRouter *Local::RecordAilRouterEvent(void) { return mAilRoutersHistory.AddNewEntry(); }
+AilRouter *Local::RecordAilRouterEvent(void)
+{
+    AilRouter *entry = mAilRoutersHistory.AddNewEntry();
+
+    if (entry != nullptr)
+    {
+        SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_AIL_ROUTER);
+    }
+
+    return entry;
+}
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
 void Local::RecordDhcp6Pd(BorderRouter::RoutingManager::Dhcp6PdState aState, const Ip6::Prefix &aPrefix)
@@ -615,6 +744,7 @@ void Local::RecordDhcp6Pd(BorderRouter::RoutingManager::Dhcp6PdState aState, con
     Dhcp6PdInfo *entry = mDhcp6PdHistory.AddNewEntry();
 
     VerifyOrExit(entry != nullptr);
+    SignalNewEntry(OT_PLAT_HISTORY_TRACKER_LIST_DHCP6_PD);
 
     entry->mState  = MapEnum(aState);
     entry->mPrefix = aPrefix;
@@ -649,6 +779,7 @@ void Local::HandleTimer(void)
     mMulticastAddressHistory.UpdateAgedEntries();
     mRxHistory.UpdateAgedEntries();
     mTxHistory.UpdateAgedEntries();
+    mFlowHistory.UpdateAgedEntries();
     mNeighborHistory.UpdateAgedEntries();
     mOnMeshPrefixHistory.UpdateAgedEntries();
     mExternalRouteHistory.UpdateAgedEntries();
@@ -667,6 +798,96 @@ void Local::HandleTimer(void)
     mTimer.Start(kAgeCheckPeriod);
 }
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+
+void Local::SignalNewEntry(otPlatHistoryTrackerList aList)
+{
+    // The new entry is populated by the caller after it is added, so
+    // it is passed to the platform later from a tasklet. Entries
+    // recorded earlier are already populated. If they belong to a
+    // different list, they are passed right away so that the
+    // platform always receives entries in the order they were
+    // recorded.
+
+    if ((mNumUnsavedEntries > 0) && (mUnsavedList != aList))
+    {
+        SaveUnsavedEntries();
+    }
+
+    mUnsavedList = aList;
+    mNumUnsavedEntries++;
+    mSaveTasklet.Post();
+}
+
+void Local::SaveUnsavedEntries(void)
+{
+    switch (mUnsavedList)
+    {
+    case OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO:
+        SaveNewestEntries(mNetInfoHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_UNICAST_ADDRESS:
+        SaveNewestEntries(mUnicastAddressHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_MULTICAST_ADDRESS:
+        SaveNewestEntries(mMulticastAddressHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_RX:
+        SaveNewestEntries(mRxHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_TX:
+        SaveNewestEntries(mTxHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_NEIGHBOR:
+        SaveNewestEntries(mNeighborHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_ROUTER:
+        SaveNewestEntries(mRouterHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_ON_MESH_PREFIX:
+        SaveNewestEntries(mOnMeshPrefixHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_EXTERNAL_ROUTE:
+        SaveNewestEntries(mExternalRouteHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_DNS_SRP_ADDR:
+        SaveNewestEntries(mDnsSrpAddrHistory);
+        break;
+#if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE && OPENTHREAD_CONFIG_BORDER_AGENT_EPHEMERAL_KEY_ENABLE
+    case OT_PLAT_HISTORY_TRACKER_LIST_EPSKC_EVENT:
+        SaveNewestEntries(mEpskcEventHistory);
+        break;
+#endif
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    case OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_OMR_PREFIX:
+        SaveNewestEntries(mFavoredOmrPrefixHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_FAVORED_ON_LINK:
+        SaveNewestEntries(mFavoredOnLinkPrefixHistory);
+        break;
+    case OT_PLAT_HISTORY_TRACKER_LIST_AIL_ROUTER:
+        SaveNewestEntries(mAilRoutersHistory);
+        break;
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
+    case OT_PLAT_HISTORY_TRACKER_LIST_DHCP6_PD:
+        SaveNewestEntries(mDhcp6PdHistory);
+        break;
+#endif
+#endif
+    default:
+        break;
+    }
+
+    // Entries which were overwritten in the in-RAM list before they
+    // could be passed are skipped, but still consume a sequence
+    // number so that the platform can detect the gap.
+
+    mSaveSequence += mNumUnsavedEntries;
+    mNumUnsavedEntries = 0;
+}
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+
 void Local::EntryAgeToString(uint32_t aEntryAge, char *aBuffer, uint16_t aSize)
 {
     StringWriter writer(aBuffer, aSize);
@@ -39,6 +39,7 @@
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 
 #include <openthread/history_tracker.h>
+#include <openthread/platform/history_tracker.h>
 #include <openthread/platform/radio.h>
 
 #include "border_router/routing_manager.hpp"
@@ -48,6 +49,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "meshcop/border_agent.hpp"
 #include "net/netif.hpp"
@@ -110,6 +112,7 @@ typedef otHistoryTrackerNetworkInfo          NetworkInfo;          ///< Thread n
 typedef otHistoryTrackerUnicastAddressInfo   UnicastAddressInfo;   ///< Unicast IPv6 address info.
 typedef otHistoryTrackerMulticastAddressInfo MulticastAddressInfo; ///< Multicast IPv6 address info.
 typedef otHistoryTrackerMessageInfo          MessageInfo;          ///< RX/TX IPv6 message info.
+typedef otHistoryTrackerFlowInfo             FlowInfo;             ///< Aggregated RX/TX IPv6 flow info.
 typedef otHistoryTrackerNeighborInfo         NeighborInfo;         ///< Neighbor info.
 typedef otHistoryTrackerRouterInfo           RouterInfo;           ///< Router info.
 typedef otHistoryTrackerOnMeshPrefixInfo     OnMeshPrefixInfo;     ///< Network Data on mesh prefix info.
@@ -257,6 +260,22 @@ public:
         return mTxHistory.Iterate(aIterator, aEntryAge);
     }
 
+    /**
+     * Iterates over the entries in the aggregated RX/TX flow history list.
+     *
+     * @param[in,out] aIterator  An iterator. MUST be initialized.
+     * @param[out]    aEntryAge  A reference to a variable to output the entry's age.
+     *                           Age is provided as the duration (in milliseconds) from the first message of the flow
+     *                           in its time bucket to @p aIterator initialization time. It is set to `kMaxAge` for
+     *                           entries older than max age.
+     *
+     * @returns A pointer to `FlowInfo` entry or `nullptr` if no more entries in the list.
+     */
+    const FlowInfo *IterateFlowHistory(Iterator &aIterator, uint32_t &aEntryAge) const
+    {
+        return mFlowHistory.Iterate(aIterator, aEntryAge);
+    }
+
     const NeighborInfo *IterateNeighborHistory(Iterator &aIterator, uint32_t &aEntryAge) const
     {
         return mNeighborHistory.Iterate(aIterator, aEntryAge);
@@ -337,11 +356,14 @@ private:
 
     static constexpr uint32_t kAgeCheckPeriod = 16 * Time::kOneHourInMsec;
 
+    static constexpr uint32_t kFlowBucketInterval = OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_BUCKET_INTERVAL;
+
     static constexpr uint16_t kNetInfoListSize       = OPENTHREAD_CONFIG_HISTORY_TRACKER_NET_INFO_LIST_SIZE;
     static constexpr uint16_t kUnicastAddrListSize   = OPENTHREAD_CONFIG_HISTORY_TRACKER_UNICAST_ADDRESS_LIST_SIZE;
     static constexpr uint16_t kMulticastAddrListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_MULTICAST_ADDRESS_LIST_SIZE;
     static constexpr uint16_t kRxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_RX_LIST_SIZE;
     static constexpr uint16_t kTxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE;
+    static constexpr uint16_t kFlowListSize          = OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE;
     static constexpr uint16_t kNeighborListSize      = OPENTHREAD_CONFIG_HISTORY_TRACKER_NEIGHBOR_LIST_SIZE;
     static constexpr uint16_t kRouterListSize        = OPENTHREAD_CONFIG_HISTORY_TRACKER_ROUTER_LIST_SIZE;
     static constexpr uint16_t kOnMeshPrefixListSize  = OPENTHREAD_CONFIG_HISTORY_TRACKER_ON_MESH_PREFIX_LIST_SIZE;
@@ -466,6 +488,10 @@ private:
 
         void UpdateAgedEntries(void) { List::UpdateAgedEntries(kMaxSize, mTimestamps); }
 
+        // Returns the entry with given entry number (zero being the
+        // newest entry). `aEntryNumber` MUST be smaller than size.
+        Entry *GetEntry(uint16_t aEntryNumber) { return &mEntries[MapEntryNumberToListIndex(aEntryNumber, kMaxSize)]; }
+
         const Entry *Iterate(Iterator &aIterator, uint32_t &aEntryAge) const
         {
             uint16_t index;
@@ -474,6 +500,33 @@ private:
                                                                                                      : nullptr;
         }
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+        // Passes the `aNumEntries` newest entries (oldest first) to
+        // the platform. `aSequence` is the sequence number of the
+        // oldest one. Entries no longer in the list are skipped.
+        void SaveNewestEntries(Instance                &aInstance,
+                               otPlatHistoryTrackerList aList,
+                               uint32_t                 aNumEntries,
+                               uint32_t                 aSequence) const
+        {
+            TimeMilli now = TimerMilli::GetNow();
+
+            if (aNumEntries > GetSize())
+            {
+                aSequence += aNumEntries - GetSize();
+                aNumEntries = GetSize();
+            }
+
+            while (aNumEntries > 0)
+            {
+                uint16_t index = MapEntryNumberToListIndex(static_cast<uint16_t>(--aNumEntries), kMaxSize);
+
+                otPlatHistoryTrackerSaveEntry(&aInstance, aList, aSequence++, mTimestamps[index].GetDurationTill(now),
+                                              &mEntries[index], sizeof(Entry));
+            }
+        }
+#endif
+
     private:
         Timestamp mTimestamps[kMaxSize];
         Entry     mEntries[kMaxSize];
@@ -490,6 +543,9 @@ private:
         const Entry *Iterate(Iterator &, uint32_t &) const { return nullptr; }
         void         UpdateAgedEntries(void) {}
         void         RemoveAgedEntries(void) {}
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+        void SaveNewestEntries(Instance &, otPlatHistoryTrackerList, uint32_t, uint32_t) const {}
+#endif
     };
 
     enum MessageType : uint8_t
@@ -513,11 +569,33 @@ private:
                        const Mac::Address &aMacAddress,
                        MessageType         aType,
                        bool                aIsTxSuccess = true);
+
+    uint16_t DetermineNeighborRloc16(const Mac::Address &aMacAddress) const;
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+    void RecordFlow(const Message      &aMessage,
+                    const Ip6::Headers &aHeaders,
+                    const Mac::Address &aMacAddress,
+                    MessageType         aType,
+                    bool                aIsTxSuccess);
+    static bool FlowMatches(const FlowInfo &aFlow, const Ip6::Headers &aHeaders, uint16_t aNeighborRloc16, bool aIsTx);
+#endif
     void RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo);
     void RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif::UnicastAddress &aUnicastAddress);
     void RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif::MulticastAddress &aMulticastAddress);
     void HandleNotifierEvents(Events aEvents);
     void HandleTimer(void);
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    void SignalNewEntry(otPlatHistoryTrackerList aList);
+    void SaveUnsavedEntries(void);
+
+    template <typename EntryListType> void SaveNewestEntries(const EntryListType &aEntryList)
+    {
+        aEntryList.SaveNewestEntries(GetInstance(), mUnsavedList, mNumUnsavedEntries, mSaveSequence);
+    }
+#else
+    void SignalNewEntry(otPlatHistoryTrackerList) {}
+#endif
 #if OPENTHREAD_FTD
     void RecordRouterTableChange(void);
 #endif
@@ -548,12 +626,16 @@ private:
 #endif
 
     using TrackerTimer = TimerMilliIn<Local, &Local::HandleTimer>;
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    using SaveTasklet = TaskletIn<Local, &Local::SaveUnsavedEntries>;
+#endif
 
     EntryList<NetworkInfo, kNetInfoListSize>                mNetInfoHistory;
     EntryList<UnicastAddressInfo, kUnicastAddrListSize>     mUnicastAddressHistory;
     EntryList<MulticastAddressInfo, kMulticastAddrListSize> mMulticastAddressHistory;
     EntryList<MessageInfo, kRxListSize>                     mRxHistory;
     EntryList<MessageInfo, kTxListSize>                     mTxHistory;
+    EntryList<FlowInfo, kFlowListSize>                      mFlowHistory;
     EntryList<NeighborInfo, kNeighborListSize>              mNeighborHistory;
     EntryList<RouterInfo, kRouterListSize>                  mRouterHistory;
     EntryList<OnMeshPrefixInfo, kOnMeshPrefixListSize>      mOnMeshPrefixHistory;
@@ -572,6 +654,16 @@ private:
 #endif
 
     TrackerTimer mTimer;
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE > 0
+    TimeMilli mFlowBucketStart;
+    uint16_t  mNumFlowsInBucket;
+#endif
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    SaveTasklet              mSaveTasklet;
+    otPlatHistoryTrackerList mUnsavedList;
+    uint32_t                 mNumUnsavedEntries;
+    uint32_t                 mSaveSequence;
+#endif
 
 #if OPENTHREAD_FTD && (OPENTHREAD_CONFIG_HISTORY_TRACKER_ROUTER_LIST_SIZE > 0)
     struct RouterEntry
@@ -596,6 +688,7 @@ private:
 DefineCoreType(otHistoryTrackerIterator, HistoryTracker::Iterator);
 DefineCoreType(otHistoryTrackerNetworkInfo, HistoryTracker::NetworkInfo);
 DefineCoreType(otHistoryTrackerMessageInfo, HistoryTracker::MessageInfo);
+DefineCoreType(otHistoryTrackerFlowInfo, HistoryTracker::FlowInfo);
 DefineCoreType(otHistoryTrackerNeighborInfo, HistoryTracker::NeighborInfo);
 DefineCoreType(otHistoryTrackerRouterInfo, HistoryTracker::RouterInfo);
 DefineCoreType(otHistoryTrackerOnMeshPrefixInfo, HistoryTracker::OnMeshPrefixInfo);
@@ -49,7 +49,13 @@ RegisterLogModule("LinkMetricsMgr");
 LinkMetricsManager::LinkMetricsManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
+    , mBatchTimer(aInstance)
     , mEnabled(OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ON_BY_DEFAULT)
+    , mBatchSize(OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_DEFAULT_BATCH_SIZE)
+    , mMgmtRequests(0)
+    , mMgmtResponses(0)
+    , mEnhAckReports(0)
+    , mStartTime(0)
 {
 }
 
@@ -88,6 +94,19 @@ exit:
     return error;
 }
 
+void LinkMetricsManager::GetOverhead(Overhead &aOverhead) const
+{
+    uint32_t duration = TimerMilli::GetNow() - mStartTime;
+
+    aOverhead.mMgmtRequests  = mMgmtRequests;
+    aOverhead.mMgmtResponses = mMgmtResponses;
+    aOverhead.mEnhAckReports = mEnhAckReports;
+    aOverhead.mDuration      = duration;
+
+    aOverhead.mFramesPerMinute = static_cast<uint32_t>(static_cast<uint64_t>(mMgmtRequests + mMgmtResponses) *
+                                                       kOneMinuteMilliSec / Max<uint32_t>(duration, 1));
+}
+
 void LinkMetricsManager::Start(void)
 {
     LinkMetrics::Initiator &initiator = Get<LinkMetrics::Initiator>();
@@ -97,6 +116,11 @@ void LinkMetricsManager::Start(void)
     initiator.SetMgmtResponseCallback(HandleMgmtResponse, this);
     initiator.SetEnhAckProbingCallback(HandleEnhAckIe, this);
 
+    mMgmtRequests  = 0;
+    mMgmtResponses = 0;
+    mEnhAckReports = 0;
+    mStartTime     = TimerMilli::GetNow();
+
     mTimer.Start(kTimeBeforeStartMilliSec);
 exit:
     return;
@@ -107,6 +131,7 @@ void LinkMetricsManager::Stop(void)
     LinkMetrics::Initiator &initiator = Get<LinkMetrics::Initiator>();
 
     mTimer.Stop();
+    mBatchTimer.Stop();
 
     initiator.SetMgmtResponseCallback(nullptr, nullptr);
     initiator.SetEnhAckProbingCallback(nullptr, nullptr);
@@ -203,6 +228,64 @@ void LinkMetricsManager::HandleTimer(void)
     }
 }
 
+void LinkMetricsManager::HandleBatchTimer(void)
+{
+    // Send the queued configuration requests, at most `mBatchSize` per
+    // slot. Subjects are served in list order and a subject stays queued
+    // until it is served, so every queued subject is eventually served.
+    // If batching was disabled while subjects were queued, they are all
+    // served in this slot.
+
+    uint8_t budget     = mBatchSize;
+    bool    hasPending = false;
+
+    VerifyOrExit(Get<Mle::Mle>().IsAttached());
+
+    for (Subject &subject : mSubjectList)
+    {
+        Error error;
+
+        if (!subject.mConfigurePending)
+        {
+            continue;
+        }
+
+        if (IsBatching() && (budget == 0))
+        {
+            hasPending = true;
+            break;
+        }
+
+        error = subject.ConfigureEap(GetInstance());
+
+        // A request that could not be sent stays queued and is retried
+        // in the next slot. A subject whose neighbor is gone is removed
+        // on the next update instead.
+
+        if (error == kErrorNone)
+        {
+            subject.mConfigurePending = false;
+            budget--;
+        }
+        else if (error == kErrorUnknownNeighbor)
+        {
+            subject.mConfigurePending = false;
+        }
+        else
+        {
+            hasPending = true;
+        }
+    }
+
+    if (hasPending)
+    {
+        mBatchTimer.Start(kBatchSlotInterval);
+    }
+
+exit:
+    return;
+}
+
 void LinkMetricsManager::HandleMgmtResponse(const otIp6Address *aAddress, otLinkMetricsStatus aStatus, void *aContext)
 {
     static_cast<LinkMetricsManager *>(aContext)->HandleMgmtResponse(aAddress, aStatus);
@@ -221,6 +304,8 @@ void LinkMetricsManager::HandleMgmtResponse(const otIp6Address *aAddress, otLink
     subject = mSubjectList.FindMatching(extAddress);
     VerifyOrExit(subject != nullptr);
 
+    mMgmtResponses++;
+
     switch (MapEnum(aStatus))
     {
     case LinkMetrics::Status::kStatusSuccess:
@@ -256,6 +341,7 @@ void LinkMetricsManager::HandleEnhAckIe(otShortAddress             aShortAddress
 
     VerifyOrExit(subject->mState == SubjectState::kActive || subject->mState == SubjectState::kRenewing);
     subject->mLastUpdateTime = TimerMilli::GetNow();
+    mEnhAckReports++;
 
     VerifyOrExit(aMetricsValues->mMetrics.mRssi && aMetricsValues->mMetrics.mLinkMargin, error = kErrorInvalidArgs);
 
@@ -299,6 +385,7 @@ exit:
     {
         mState = (mState == SubjectState::kActive) ? SubjectState::kRenewing : SubjectState::kConfiguring;
         mAttempts++;
+        aInstance.Get<LinkMetricsManager>().mMgmtRequests++;
     }
     return error;
 }
@@ -314,6 +401,11 @@ Error LinkMetricsManager::Subject::UnregisterEap(Instance &aInstance)
     destination.InitAsLinkLocalAddress(neighbor->GetExtAddress());
 
     error = aInstance.Get<LinkMetrics::Initiator>().SendMgmtRequestEnhAckProbing(destination, enhAckFlags, nullptr);
+
+    if (error == kErrorNone)
+    {
+        aInstance.Get<LinkMetricsManager>().mMgmtRequests++;
+    }
 exit:
     return error;
 }
@@ -354,7 +446,26 @@ Error LinkMetricsManager::Subject::UpdateState(Instance &aInstance)
 
     if (shouldConfigure)
     {
-        error = ConfigureEap(aInstance);
+        LinkMetricsManager &manager = aInstance.Get<LinkMetricsManager>();
+
+        if (manager.IsBatching())
+        {
+            // Queue the subject to be configured in a batch slot. Check
+            // the neighbor now so that a stale subject is still removed.
+
+            VerifyOrExit(aInstance.Get<NeighborTable>().FindNeighbor(mExtAddress) != nullptr,
+                         error = kErrorUnknownNeighbor);
+            mConfigurePending = true;
+
+            if (!manager.mBatchTimer.IsRunning())
+            {
+                manager.mBatchTimer.Start(0);
+            }
+        }
+        else
+        {
+            error = ConfigureEap(aInstance);
+        }
     }
 
 exit:
@@ -94,10 +94,17 @@ namespace Utils {
  *   exist when trying to configure EAP. It will remove the stale
  *   subject then.
  *
+ * - Batching
+ *   When a batch size is set, subjects that need (re)configuration
+ *   are queued and at most batch-size requests are sent per batch
+ *   slot, so that a router with many neighbors does not send a burst
+ *   of MLE Link Metrics Management Requests.
+ *
  * - Show data
  *   An OT API is provided to get the link metrics data of any
  *   subject (neighbor) by its extended address. In production, this
- *   data may be fetched by some other means like RPC.
+ *   data may be fetched by some other means like RPC. The collection
+ *   overhead (extra MLE frames per minute) is reported as well.
  */
 
 class LinkMetricsManager : public InstanceLocator, private NonCopyable
@@ -124,12 +131,13 @@ class LinkMetricsManager : public InstanceLocator, private NonCopyable
 
     struct Subject : LinkedListEntry<Subject>, Clearable<Subject>
     {
-        Mac::ExtAddress mExtAddress;     ///< Use the extended address to identify the neighbor.
-        SubjectState    mState;          ///< Current State of the Subject
-        uint8_t         mAttempts;       ///< The count of attempt that has been made to
-                                         ///< configure EAP
-        TimeMilli       mLastUpdateTime; ///< The time `mData` was updated last time
+        Mac::ExtAddress mExtAddress;       ///< Use the extended address to identify the neighbor.
+        SubjectState    mState;            ///< Current State of the Subject
+        uint8_t         mAttempts;         ///< The count of attempt that has been made to
+                                           ///< configure EAP
+        TimeMilli       mLastUpdateTime;   ///< The time `mData` was updated last time
         LinkMetricsData mData;
+        bool            mConfigurePending; ///< Queued for configuration in a batch slot
 
         Subject *mNext;
 
@@ -176,10 +184,40 @@ public:
      */
     Error GetLinkMetricsValueByExtAddr(const Mac::ExtAddress &aExtAddress, LinkMetrics::MetricsValues &aMetricsValues);
 
+    /**
+     * Represents the collection overhead information.
+     */
+    typedef otLinkMetricsManagerOverhead Overhead;
+
+    /**
+     * Gets the collection overhead since the manager started.
+     *
+     * @param[out] aOverhead  A reference to an `Overhead` to output the information.
+     */
+    void GetOverhead(Overhead &aOverhead) const;
+
+    /**
+     * Sets the maximum number of Link Metrics Management Requests sent per batch slot.
+     *
+     * If batching is disabled while subjects are still queued, all of them are configured in the next batch slot.
+     *
+     * @param[in]  aBatchSize  The batch size, or zero to disable batching.
+     */
+    void SetBatchSize(uint8_t aBatchSize) { mBatchSize = aBatchSize; }
+
+    /**
+     * Gets the maximum number of Link Metrics Management Requests sent per batch slot.
+     *
+     * @returns The batch size, or zero if batching is disabled.
+     */
+    uint8_t GetBatchSize(void) const { return mBatchSize; }
+
 private:
     static constexpr uint16_t kTimeBeforeStartMilliSec         = 5000;
     static constexpr uint32_t kStateUpdateIntervalMilliSec     = 150000;
     static constexpr uint8_t  kConfigureLinkMetricsMaxAttempts = 3;
+    static constexpr uint32_t kBatchSlotInterval = OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_BATCH_SLOT_INTERVAL;
+    static constexpr uint32_t kOneMinuteMilliSec = 60 * 1000;
 #if OPENTHREAD_FTD
     static constexpr uint8_t kMaximumSubjectToTrack = 128;
 #elif OPENTHREAD_MTD
@@ -196,6 +234,8 @@ private:
 
     void        HandleNotifierEvents(Events aEvents);
     void        HandleTimer(void);
+    void        HandleBatchTimer(void);
+    bool        IsBatching(void) const { return mBatchSize != 0; }
     static void HandleMgmtResponse(const otIp6Address *aAddress, otLinkMetricsStatus aStatus, void *aContext);
     void        HandleMgmtResponse(const otIp6Address *aAddress, otLinkMetricsStatus aStatus);
     static void HandleEnhAckIe(otShortAddress             aShortAddress,
@@ -207,11 +247,18 @@ private:
                                const otLinkMetricsValues *aMetricsValues);
 
     using LinkMetricsMgrTimer = TimerMilliIn<LinkMetricsManager, &LinkMetricsManager::HandleTimer>;
+    using BatchTimer          = TimerMilliIn<LinkMetricsManager, &LinkMetricsManager::HandleBatchTimer>;
 
     Pool<Subject, kMaximumSubjectToTrack> mPool;
     LinkedList<Subject>                   mSubjectList;
     LinkMetricsMgrTimer                   mTimer;
+    BatchTimer                            mBatchTimer;
     bool                                  mEnabled;
+    uint8_t                               mBatchSize;
+    uint32_t                              mMgmtRequests;
+    uint32_t                              mMgmtResponses;
+    uint32_t                              mEnhAckReports;
+    TimeMilli                             mStartTime;
 };
 
 /**
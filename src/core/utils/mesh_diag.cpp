@@ -60,7 +60,11 @@ MeshDiag::MeshDiag(Instance &aInstance)
     , mExpectedAnswerIndex(0)
     , mResponseTimeout(kResponseTimeout)
     , mTimer(aInstance)
+    , mDiscoverConcurrency(kDiscoverConcurrency)
+    , mDiscoverMaxRetries(kDiscoverMaxRetries)
+    , mDiscoverResponseTimeSum(0)
 {
+    ClearAllBytes(mDiscoverStats);
 }
 
 void MeshDiag::SetResponseTimeout(uint32_t aTimeout)
@@ -68,6 +72,16 @@ void MeshDiag::SetResponseTimeout(uint32_t aTimeout)
     mResponseTimeout = Clamp(aTimeout, kMinResponseTimeout, kMaxResponseTimeout);
 }
 
+void MeshDiag::SetDiscoverConcurrency(uint8_t aConcurrency)
+{
+    mDiscoverConcurrency = Clamp<uint8_t>(aConcurrency, 1, Mle::kMaxRouters);
+}
+
+void MeshDiag::SetDiscoverMaxRetries(uint8_t aMaxRetries)
+{
+    mDiscoverMaxRetries = Min(aMaxRetries, kMaxDiscoverMaxRetries);
+}
+
 Error MeshDiag::DiscoverTopology(const DiscoverConfig &aConfig, DiscoverCallback aCallback, void *aContext)
 {
     Error   error = kErrorNone;
@@ -102,39 +116,223 @@ Error MeshDiag::DiscoverTopology(const DiscoverConfig &aConfig, DiscoverCallback
 
     SuccessOrExit(error = tlvList.AddAll(aConfig.mExtraTlvTypes, aConfig.mExtraTlvTypesLength));
 
-    Get<RouterTable>().GetRouterIdMask(mDiscover.mExpectedRouterIds);
+    // Routers are queried in a pipelined way. At most `mConcurrency`
+    // queries are outstanding at any time and a new query is sent as
+    // soon as an earlier one is answered or times out, which avoids
+    // a burst of responses from all routers at once.
 
-    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    memcpy(mDiscover.mTlvs, tlvList.GetArrayBuffer(), tlvList.GetLength());
+    mDiscover.mTlvsLength      = tlvList.GetLength();
+    mDiscover.mConcurrency     = mDiscoverConcurrency;
+    mDiscover.mMaxRetries      = mDiscoverMaxRetries;
+    mDiscover.mResponseTimeout = mResponseTimeout;
+
+    Get<RouterTable>().GetRouterIdMask(mDiscover.mQueuedRouterIds);
+    mDiscover.mInFlightRouterIds.Clear();
+    ClearAllBytes(mDiscover.mAttempts);
+
+    ClearAllBytes(mDiscoverStats);
+    mDiscoverStats.mNumTargets = mDiscover.mQueuedRouterIds.DetermineAllocatedCount();
+    mDiscoverStartTime         = TimerMilli::GetNow();
+    mDiscoverResponseTimeSum   = 0;
+
+    mDiscover.mCallback.Set(aCallback, aContext);
+    mState = kStateDiscoverTopology;
+
+    error = SendDiscoverQueries();
+
+    if ((error != kErrorNone) && (mDiscover.mInFlightRouterIds.DetermineAllocatedCount() == 0))
+    {
+        Cancel();
+        ExitNow();
+    }
+
+    error = kErrorNone;
+    StartDiscoverTimer();
+
+exit:
+    return error;
+}
+
+Error MeshDiag::SendDiscoverQueries(void)
+{
+    // Sends queries to the queued routers while the number of
+    // outstanding queries is below the concurrency limit.
+
+    Error   error    = kErrorNone;
+    uint8_t inFlight = mDiscover.mInFlightRouterIds.DetermineAllocatedCount();
+
+    for (uint8_t routerId = 0; (routerId <= Mle::kMaxRouterId) && (inFlight < mDiscover.mConcurrency); routerId++)
     {
         Ip6::Address destination;
 
-        if (!mDiscover.mExpectedRouterIds.IsAllocated(routerId))
+        if (!mDiscover.mQueuedRouterIds.IsAllocated(routerId))
         {
             continue;
         }
 
         Get<Mle::Mle>().ComposeRloc(Mle::Rloc16FromRouterId(routerId), destination);
 
-        SuccessOrExit(error = Get<Client>().SendCommand(kUriDiagnosticGetRequest, Message::kPriorityLow, destination,
-                                                        tlvList.GetArrayBuffer(), tlvList.GetLength(),
-                                                        HandleDiagGetResponse, this));
-    }
+        error = Get<Client>().SendCommand(kUriDiagnosticGetRequest, Message::kPriorityLow, destination,
+                                          mDiscover.mTlvs, mDiscover.mTlvsLength, HandleDiagGetResponse, this);
 
-    mDiscover.mCallback.Set(aCallback, aContext);
-    mState = kStateDiscoverTopology;
-    mTimer.Start(mResponseTimeout);
+        if (error != kErrorNone)
+        {
+            // A failed send counts as an attempt so that the router is
+            // eventually given up on if sending keeps failing. The
+            // remaining queued routers are tried again later.
+
+            if (++mDiscover.mAttempts[routerId] > mDiscover.mMaxRetries)
+            {
+                mDiscover.mQueuedRouterIds.Remove(routerId);
+                mDiscoverStats.mNumFailures++;
+            }
+
+            ExitNow();
+        }
+
+        if (mDiscover.mAttempts[routerId] > 0)
+        {
+            mDiscoverStats.mNumRetries++;
+        }
+
+        mDiscover.mAttempts[routerId]++;
+        mDiscover.mSendTimes[routerId] = TimerMilli::GetNow();
+        mDiscover.mQueuedRouterIds.Remove(routerId);
+        mDiscover.mInFlightRouterIds.Add(routerId);
+        inFlight++;
+
+        mDiscoverStats.mNumQueries++;
+        mDiscoverStats.mMaxInFlight = Max(mDiscoverStats.mMaxInFlight, inFlight);
+    }
 
 exit:
     return error;
 }
 
+void MeshDiag::StartDiscoverTimer(void)
+{
+    // Schedules the timer for the earliest response timeout among
+    // the outstanding queries. If there is none (all sends failed),
+    // the queued routers are tried again after the response timeout.
+
+    NextFireTime nextTime;
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        if (mDiscover.mInFlightRouterIds.IsAllocated(routerId))
+        {
+            nextTime.UpdateIfEarlier(mDiscover.mSendTimes[routerId] + mDiscover.mResponseTimeout);
+        }
+    }
+
+    if (!nextTime.IsSet())
+    {
+        nextTime.UpdateIfEarlier(nextTime.GetNow() + mDiscover.mResponseTimeout);
+    }
+
+    mTimer.FireAt(nextTime);
+}
+
+void MeshDiag::HandleDiscoverTimer(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        if (!mDiscover.mInFlightRouterIds.IsAllocated(routerId) ||
+            (now - mDiscover.mSendTimes[routerId] < mDiscover.mResponseTimeout))
+        {
+            continue;
+        }
+
+        mDiscover.mInFlightRouterIds.Remove(routerId);
+
+        if (mDiscover.mAttempts[routerId] <= mDiscover.mMaxRetries)
+        {
+            mDiscover.mQueuedRouterIds.Add(routerId);
+        }
+        else
+        {
+            mDiscoverStats.mNumFailures++;
+        }
+    }
+
+    IgnoreError(SendDiscoverQueries());
+
+    mDiscoverStats.mDuration = now - mDiscoverStartTime;
+
+    if (IsDiscoverDone())
+    {
+        // All responses are handled in `HandleDiagGetResponse()`, so
+        // getting here means at least one router did not respond.
+        Finalize(kErrorResponseTimeout);
+    }
+    else
+    {
+        StartDiscoverTimer();
+    }
+}
+
+bool MeshDiag::IsDiscoverDone(void) const
+{
+    return (mDiscover.mQueuedRouterIds.DetermineAllocatedCount() == 0) &&
+           (mDiscover.mInFlightRouterIds.DetermineAllocatedCount() == 0);
+}
+
+void MeshDiag::UpdateDiscoverStats(const RouterInfo &aRouterInfo, const ChildIterator *aChildIterator)
+{
+    TimeMilli now          = TimerMilli::GetNow();
+    uint32_t  responseTime = now - mDiscover.mSendTimes[aRouterInfo.mRouterId];
+
+    mDiscoverStats.mNumResponses++;
+    mDiscoverResponseTimeSum += responseTime;
+
+    if (mDiscoverStats.mNumResponses == 1)
+    {
+        mDiscoverStats.mMinResponseTime = responseTime;
+    }
+    else
+    {
+        mDiscoverStats.mMinResponseTime = Min(mDiscoverStats.mMinResponseTime, responseTime);
+    }
+
+    mDiscoverStats.mMaxResponseTime = Max(mDiscoverStats.mMaxResponseTime, responseTime);
+    mDiscoverStats.mAvgResponseTime = mDiscoverResponseTimeSum / mDiscoverStats.mNumResponses;
+
+    for (uint8_t linkQuality : aRouterInfo.mLinkQualities)
+    {
+        if (linkQuality != 0)
+        {
+            mDiscoverStats.mNumRouterLinks++;
+        }
+    }
+
+    if (aChildIterator != nullptr)
+    {
+        // Count the children on a copy so the caller's iterator still
+        // starts from the first child.
+
+        ChildIterator iterator = *aChildIterator;
+        ChildInfo     childInfo;
+
+        while (iterator.GetNextChildInfo(childInfo) == kErrorNone)
+        {
+            mDiscoverStats.mNumChildren++;
+        }
+    }
+
+    mDiscoverStats.mDuration = now - mDiscoverStartTime;
+}
+
 void MeshDiag::HandleDiagGetResponse(Coap::Msg *aMsg, Error aResult)
 {
-    Error           error;
-    RouterInfo      routerInfo;
-    Ip6AddrIterator ip6AddrIterator;
-    ChildIterator   childIterator;
-    TlvIterator     tlvIterator;
+    Error                      error;
+    RouterInfo                 routerInfo;
+    Ip6AddrIterator            ip6AddrIterator;
+    ChildIterator              childIterator;
+    TlvIterator                tlvIterator;
+    Callback<DiscoverCallback> callback;
 
     SuccessOrExit(aResult);
     VerifyOrExit(aMsg != nullptr);
@@ -155,20 +353,39 @@ void MeshDiag::HandleDiagGetResponse(Coap::Msg *aMsg, Error aResult)
     tlvIterator.InitFrom(aMsg->mMessage);
     routerInfo.mTlvIterator = &tlvIterator;
 
-    mDiscover.mExpectedRouterIds.Remove(routerInfo.mRouterId);
+    // A router may respond to both the original and a re-sent query.
+    // Only the first response from a router that was queried and has
+    // not been given up on is reported.
 
-    if (mDiscover.mExpectedRouterIds.DetermineAllocatedCount() == 0)
+    VerifyOrExit(mDiscover.mAttempts[routerInfo.mRouterId] > 0);
+    VerifyOrExit(mDiscover.mInFlightRouterIds.IsAllocated(routerInfo.mRouterId) ||
+                 mDiscover.mQueuedRouterIds.IsAllocated(routerInfo.mRouterId));
+
+    mDiscover.mInFlightRouterIds.Remove(routerInfo.mRouterId);
+    mDiscover.mQueuedRouterIds.Remove(routerInfo.mRouterId);
+
+    UpdateDiscoverStats(routerInfo, routerInfo.mChildIterator != nullptr ? &childIterator : nullptr);
+
+    callback = mDiscover.mCallback;
+
+    if (!IsDiscoverDone())
     {
-        error  = kErrorNone;
+        IgnoreError(SendDiscoverQueries());
+    }
+
+    if (IsDiscoverDone())
+    {
+        error  = (mDiscoverStats.mNumFailures == 0) ? kErrorNone : kErrorResponseTimeout;
         mState = kStateIdle;
         mTimer.Stop();
     }
     else
     {
         error = kErrorPending;
+        StartDiscoverTimer();
     }
 
-    mDiscover.mCallback.InvokeIfSet(error, &routerInfo);
+    callback.InvokeIfSet(error, &routerInfo);
 
 exit:
     return;
@@ -478,7 +695,17 @@ void MeshDiag::Finalize(Error aError)
     }
 }
 
-void MeshDiag::HandleTimer(void) { Finalize(kErrorResponseTimeout); }
+void MeshDiag::HandleTimer(void)
+{
+    if (mState == kStateDiscoverTopology)
+    {
+        HandleDiscoverTimer();
+    }
+    else
+    {
+        Finalize(kErrorResponseTimeout);
+    }
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 // MeshDiag::RouterInfo
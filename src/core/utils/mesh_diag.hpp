@@ -76,11 +76,13 @@ class MeshDiag : public InstanceLocator
     friend class ot::NetDiag::Client;
 
 public:
-    static constexpr uint16_t kVersionUnknown = OT_MESH_DIAG_VERSION_UNKNOWN; ///< Unknown version.
+    static constexpr uint16_t kVersionUnknown        = OT_MESH_DIAG_VERSION_UNKNOWN;      ///< Unknown version.
+    static constexpr uint8_t  kMaxDiscoverMaxRetries = OT_MESH_DIAG_MAX_DISCOVER_RETRIES; ///< Max retries limit.
 
     typedef otMeshDiagDiscoverConfig                   DiscoverConfig;              ///< Discovery configuration.
     typedef otMeshDiagTlvInfo                          DiagTlvInfo;                 ///< Diagnostic TLV Info.
     typedef otMeshDiagDiscoverCallback                 DiscoverCallback;            ///< Discovery callback.
+    typedef otMeshDiagDiscoverStats                    DiscoverStats;               ///< Discovery statistics.
     typedef otMeshDiagQueryChildTableCallback          QueryChildTableCallback;     ///< Query Child Table callback.
     typedef otMeshDiagChildIp6AddrsCallback            ChildIp6AddrsCallback;       ///< Child IPv6 addresses callback.
     typedef otMeshDiagQueryRouterNeighborTableCallback RouterNeighborTableCallback; ///< Neighbor table callback.
@@ -204,6 +206,49 @@ public:
      */
     uint32_t GetResponseTimeout(void) const { return mResponseTimeout; }
 
+    /**
+     * Sets the maximum number of routers queried concurrently during topology discovery.
+     *
+     * Changing the concurrency does not impact an ongoing discovery.
+     *
+     * The provided @p aConcurrency value will be clamped to stay between 1 and the maximum number of routers.
+     *
+     * @param[in] aConcurrency   The maximum number of outstanding queries.
+     */
+    void SetDiscoverConcurrency(uint8_t aConcurrency);
+
+    /**
+     * Gets the maximum number of routers queried concurrently during topology discovery.
+     *
+     * @returns The maximum number of outstanding queries.
+     */
+    uint8_t GetDiscoverConcurrency(void) const { return mDiscoverConcurrency; }
+
+    /**
+     * Sets the maximum number of times a query to a router is re-sent during topology discovery.
+     *
+     * Changing the max retries does not impact an ongoing discovery.
+     *
+     * The provided @p aMaxRetries value will be clamped to stay at or below `kMaxDiscoverMaxRetries`.
+     *
+     * @param[in] aMaxRetries   The maximum number of retries per router.
+     */
+    void SetDiscoverMaxRetries(uint8_t aMaxRetries);
+
+    /**
+     * Gets the maximum number of times a query to a router is re-sent during topology discovery.
+     *
+     * @returns The maximum number of retries per router.
+     */
+    uint8_t GetDiscoverMaxRetries(void) const { return mDiscoverMaxRetries; }
+
+    /**
+     * Gets the statistics of the ongoing or the most recent topology discovery.
+     *
+     * @returns The discovery statistics.
+     */
+    const DiscoverStats &GetDiscoverStats(void) const { return mDiscoverStats; }
+
     /**
      * Starts network topology discovery.
      *
@@ -279,6 +324,11 @@ private:
     static constexpr uint32_t kMaxResponseTimeout = 10 * Time::kOneMinuteInMsec;
     static constexpr uint16_t kMaxTlvTypes        = 32;
 
+    static constexpr uint8_t kDiscoverConcurrency = OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_CONCURRENCY;
+    static constexpr uint8_t kDiscoverMaxRetries  = OPENTHREAD_CONFIG_MESH_DIAG_DISCOVER_MAX_RETRIES;
+
+    static_assert(kDiscoverMaxRetries <= OT_MESH_DIAG_MAX_DISCOVER_RETRIES, "DISCOVER_MAX_RETRIES is too large");
+
     enum State : uint8_t
     {
         kStateIdle,
@@ -291,7 +341,15 @@ private:
     struct DiscoverInfo
     {
         Callback<DiscoverCallback> mCallback;
-        Mle::RouterIdMask          mExpectedRouterIds;
+        Mle::RouterIdMask          mQueuedRouterIds;   // Routers waiting for a (re-)sent query.
+        Mle::RouterIdMask          mInFlightRouterIds; // Routers with an outstanding query.
+        TimeMilli                  mSendTimes[Mle::kMaxRouterId + 1];
+        uint8_t                    mAttempts[Mle::kMaxRouterId + 1];
+        uint8_t                    mTlvs[kMaxTlvTypes];
+        uint8_t                    mTlvsLength;
+        uint8_t                    mConcurrency;
+        uint8_t                    mMaxRetries;
+        uint32_t                   mResponseTimeout;
     };
 
     struct QueryChildTableInfo
@@ -338,6 +396,11 @@ private:
     };
 
     Error SendQuery(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t aTlvsLength);
+    Error SendDiscoverQueries(void);
+    void  StartDiscoverTimer(void);
+    void  HandleDiscoverTimer(void);
+    void  UpdateDiscoverStats(const RouterInfo &aRouterInfo, const ChildIterator *aChildIterator);
+    bool  IsDiscoverDone(void) const;
     void  Finalize(Error aError);
     void  HandleTimer(void);
     bool  HandleDiagnosticGetAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
@@ -358,6 +421,12 @@ private:
     uint32_t     mResponseTimeout;
     TimeoutTimer mTimer;
 
+    uint8_t       mDiscoverConcurrency;
+    uint8_t       mDiscoverMaxRetries;
+    TimeMilli     mDiscoverStartTime;
+    uint32_t      mDiscoverResponseTimeSum;
+    DiscoverStats mDiscoverStats;
+
     union
     {
         DiscoverInfo                 mDiscover;
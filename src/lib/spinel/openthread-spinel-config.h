@@ -69,6 +69,18 @@
 #define OPENTHREAD_LIB_SPINEL_NCP_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_LIB_HDLC_FCS_SLICING_BY_8_ENABLE
+ *
+ * Define 1 to compute the HDLC-lite FCS eight bytes at a time using slicing-by-8 lookup tables.
+ *
+ * This speeds up encoding and decoding of large frames at the cost of 3.5 KB of additional lookup tables, so it is
+ * enabled by default only on POSIX platform.
+ */
+#ifndef OPENTHREAD_LIB_HDLC_FCS_SLICING_BY_8_ENABLE
+#define OPENTHREAD_LIB_HDLC_FCS_SLICING_BY_8_ENABLE OPENTHREAD_PLATFORM_POSIX
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
  *
@@ -35,11 +35,17 @@
 #include "firewall.hpp"
 
 #include <string.h>
+#include <sys/socket.h>
+
+#ifdef __linux__
+#include <linux/netlink.h>
+#endif
 
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
 
 #include "common/code_utils.hpp"
+#include "posix/platform/ipset.hpp"
 #include "posix/platform/utils.hpp"
 
 namespace ot {
@@ -51,71 +57,69 @@ namespace Posix {
 #error Configurations 'OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE' and 'OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE' are required.
 #endif
 
-static const char kIpsetCommand[]             = OPENTHREAD_POSIX_CONFIG_IPSET_BINARY;
 static const char kIngressDenySrcIpSet[]      = "otbr-ingress-deny-src";
 static const char kIngressDenySrcSwapIpSet[]  = "otbr-ingress-deny-src-swap";
 static const char kIngressAllowDstIpSet[]     = "otbr-ingress-allow-dst";
 static const char kIngressAllowDstSwapIpSet[] = "otbr-ingress-allow-dst-swap";
 
-class IpSetManager
+enum : uint8_t
 {
-public:
-    otError FlushIpSet(const char *aName);
-    otError AddToIpSet(const char *aSetName, const char *aAddress);
-    otError SwapIpSets(const char *aSetName1, const char *aSetName2);
+    kIngressDenySrc,
+    kIngressAllowDst,
+    kNumIpSets,
 };
 
-inline otError IpSetManager::FlushIpSet(const char *aName)
-{
-    return ExecuteCommand("%s flush %s", kIpsetCommand, aName);
-}
+static int sNetlinkFd = -1;
 
-inline otError IpSetManager::AddToIpSet(const char *aSetName, const char *aAddress)
-{
-    return ExecuteCommand("%s add %s %s -exist", kIpsetCommand, aSetName, aAddress);
-}
+static IpSetManager::IpSet sIpSets[kNumIpSets] = {
+    {kIngressDenySrcIpSet, kIngressDenySrcSwapIpSet, IpSetManager::PrefixSet(), IpSetManager::PrefixSet(), false},
+    {kIngressAllowDstIpSet, kIngressAllowDstSwapIpSet, IpSetManager::PrefixSet(), IpSetManager::PrefixSet(), false},
+};
 
-inline otError IpSetManager::SwapIpSets(const char *aSetName1, const char *aSetName2)
-{
-    return ExecuteCommand("%s swap %s %s", kIpsetCommand, aSetName1, aSetName2);
-}
+static IpSetManager sIpSetManager(sIpSets, kNumIpSets);
 
 void UpdateIpSets(otInstance *aInstance)
 {
-    otError               error    = OT_ERROR_NONE;
-    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
-    otBorderRouterConfig  config;
-    otIp6Prefix           prefix;
-    char                  prefixBuf[OT_IP6_PREFIX_STRING_SIZE];
-    IpSetManager          ipSetManager;
-
-    // 1. Flush the '*-swap' ipsets
-    SuccessOrExit(error = ipSetManager.FlushIpSet(kIngressAllowDstSwapIpSet));
-    SuccessOrExit(error = ipSetManager.FlushIpSet(kIngressDenySrcSwapIpSet));
-
-    // 2. Update otbr-deny-src-swap
-    while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &config) == OT_ERROR_NONE)
+    otError                 error    = OT_ERROR_NONE;
+    otNetworkDataIterator   iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    otBorderRouterConfig    config;
+    otIp6Prefix             prefix;
+    IpSetManager::PrefixSet prefixes[kNumIpSets];
+
+    if (sNetlinkFd < 0)
     {
-        otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+        sNetlinkFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_NETFILTER, kSocketNonBlock);
+        VerifyOrExit(sNetlinkFd >= 0, error = OT_ERROR_FAILED);
+        sIpSetManager.SetSocket(sNetlinkFd);
+        Mainloop::Manager::Get().Add(sIpSetManager);
     }
+
+    // otbr-ingress-deny-src holds the mesh-local prefix and the on-mesh
+    // prefixes, otbr-ingress-allow-dst holds the on-mesh prefixes. The
+    // mesh-local prefix is added first so that it is always denied.
+
+    memset(&prefix, 0, sizeof(prefix));
     memcpy(prefix.mPrefix.mFields.m8, otThreadGetMeshLocalPrefix(aInstance)->m8,
            sizeof(otThreadGetMeshLocalPrefix(aInstance)->m8));
     prefix.mLength = OT_IP6_PREFIX_BITSIZE;
-    otIp6PrefixToString(&prefix, prefixBuf, sizeof(prefixBuf));
-    SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+    SuccessOrExit(error = prefixes[kIngressDenySrc].Add(prefix));
 
-    // 3. Update otbr-allow-dst-swap
-    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
     while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &config) == OT_ERROR_NONE)
     {
-        otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressAllowDstSwapIpSet, prefixBuf));
+        if (prefixes[kIngressDenySrc].Add(config.mPrefix) != OT_ERROR_NONE)
+        {
+            // Fail closed: an on-mesh prefix that cannot be denied as
+            // source must not be trusted, so no destination is allowed.
+
+            otLogWarnPlat("Firewall - too many on-mesh prefixes, denying all unicast ingress traffic");
+            prefixes[kIngressAllowDst].Clear();
+            break;
+        }
+
+        SuccessOrExit(error = prefixes[kIngressAllowDst].Add(config.mPrefix));
     }
 
-    // 4. Swap ipsets to let them take effect
-    SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressDenySrcSwapIpSet, kIngressDenySrcIpSet));
-    SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressAllowDstSwapIpSet, kIngressAllowDstIpSet));
+    error = sIpSetManager.RequestUpdate(prefixes);
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -0,0 +1,311 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the memory-mapped History Tracker file.
+ */
+
+#include "posix/platform/history_file.hpp"
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <openthread/history_tracker.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+static_assert(sizeof(otHistoryTrackerMessageInfo) <= OT_SYS_HISTORY_ENTRY_MAX_SIZE, "Max entry size is too small");
+static_assert(sizeof(otHistoryTrackerAilRouter) <= OT_SYS_HISTORY_ENTRY_MAX_SIZE, "Max entry size is too small");
+static_assert(sizeof(otHistoryTrackerDnsSrpAddrInfo) <= OT_SYS_HISTORY_ENTRY_MAX_SIZE, "Max entry size is too small");
+
+const char HistoryFile::kLogModuleName[] = "HistoryFile";
+
+HistoryFile &HistoryFile::Get(void)
+{
+    static HistoryFile sInstance;
+
+    return sInstance;
+}
+
+HistoryFile::HistoryFile(void)
+    : mFd(-1)
+    , mMapSize(0)
+    , mHeader(nullptr)
+    , mRecords(nullptr)
+{
+}
+
+void HistoryFile::Init(const char *aDataPath)
+{
+    const char *offset = getenv("PORT_OFFSET");
+    char        path[PATH_MAX];
+    int         length;
+
+    length = snprintf(path, sizeof(path), "%s/%s.history",
+                      (aDataPath == nullptr) ? OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH : aDataPath,
+                      (offset == nullptr) ? "0" : offset);
+    VerifyOrExit(length > 0 && static_cast<size_t>(length) < sizeof(path), LogWarn("History file path is too long"));
+
+    IgnoreError(Open(path, OPENTHREAD_POSIX_CONFIG_HISTORY_FILE_DEPTH));
+
+exit:
+    return;
+}
+
+otError HistoryFile::Open(const char *aPath, uint32_t aDepth)
+{
+    otError error = OT_ERROR_NONE;
+    size_t  size  = sizeof(Header) + static_cast<size_t>(aDepth) * sizeof(Record);
+    void   *map;
+
+    VerifyOrExit(aDepth > 0, error = OT_ERROR_INVALID_ARGS);
+
+    Close();
+
+    mFd = open(aPath, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    VerifyOrExit(mFd != -1, error = OT_ERROR_FAILED);
+
+    VerifyOrExit(ftruncate(mFd, static_cast<off_t>(size)) == 0, error = OT_ERROR_FAILED);
+
+    map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    VerifyOrExit(map != MAP_FAILED, error = OT_ERROR_FAILED);
+
+    mMapSize = size;
+    mHeader  = static_cast<Header *>(map);
+    mRecords = reinterpret_cast<Record *>(mHeader + 1);
+
+    if (!IsHeaderValid(aDepth))
+    {
+        LogNote("Initializing history file %s with %lu records", aPath, static_cast<unsigned long>(aDepth));
+        Reset(aDepth);
+    }
+
+    // Recover a `mNextSeq` which was not yet updated when the
+    // process stopped right after committing a record.
+
+    while (GetRecord(mHeader->mNextSeq).mSeq == mHeader->mNextSeq)
+    {
+        mHeader->mNextSeq++;
+    }
+
+    LogInfo("Opened history file %s, next seq %llu", aPath, static_cast<unsigned long long>(mHeader->mNextSeq));
+
+exit:
+    if (error == OT_ERROR_FAILED)
+    {
+        LogWarn("Failed to open history file %s: %s", aPath, strerror(errno));
+        Close();
+    }
+
+    return error;
+}
+
+void HistoryFile::Close(void)
+{
+    if (mHeader != nullptr)
+    {
+        munmap(mHeader, mMapSize);
+        mHeader  = nullptr;
+        mRecords = nullptr;
+        mMapSize = 0;
+    }
+
+    if (mFd != -1)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+bool HistoryFile::IsHeaderValid(uint32_t aDepth) const
+{
+    return (mHeader->mMagic == kMagic) && (mHeader->mVersion == kVersion) && (mHeader->mRecordSize == sizeof(Record)) &&
+           (mHeader->mDepth == aDepth) && (mHeader->mNextSeq != 0);
+}
+
+void HistoryFile::Reset(uint32_t aDepth)
+{
+    memset(mHeader, 0, mMapSize);
+
+    mHeader->mMagic      = kMagic;
+    mHeader->mVersion    = kVersion;
+    mHeader->mRecordSize = sizeof(Record);
+    mHeader->mDepth      = aDepth;
+    mHeader->mNextSeq    = 1;
+}
+
+uint64_t HistoryFile::GetOldestSeq(void) const
+{
+    return (mHeader->mNextSeq > mHeader->mDepth) ? mHeader->mNextSeq - mHeader->mDepth : 1;
+}
+
+void HistoryFile::Save(otPlatHistoryTrackerList aList, uint32_t aAge, const void *aEntry, uint16_t aLength)
+{
+    uint64_t seq;
+    Record  *record;
+
+    VerifyOrExit(IsOpen());
+
+    seq    = mHeader->mNextSeq;
+    record = &GetRecord(seq);
+
+    if (aLength > kMaxEntrySize)
+    {
+        aLength = kMaxEntrySize;
+    }
+
+    // Invalidate the record first and set its sequence number
+    // last, so that a record torn by a crash is never accepted.
+
+    record->mSeq = 0;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    record->mTimestamp = GetNow() - static_cast<uint64_t>(aAge) * 1000u;
+    record->mList      = static_cast<uint8_t>(aList);
+    record->mLength    = aLength;
+    memcpy(record->mEntry, aEntry, aLength);
+    memset(record->mEntry + aLength, 0, kMaxEntrySize - aLength);
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    record->mSeq = seq;
+
+    mHeader->mNextSeq = seq + 1;
+
+exit:
+    return;
+}
+
+otError HistoryFile::ReadNext(otSysHistoryCursor &aCursor, otSysHistoryRecord &aRecord, uint64_t &aNumSkipped) const
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t oldestSeq;
+
+    aNumSkipped = 0;
+
+    VerifyOrExit(IsOpen(), error = OT_ERROR_INVALID_STATE);
+
+    oldestSeq = GetOldestSeq();
+
+    if (aCursor.mNextSeq == 0 || aCursor.mNextSeq > mHeader->mNextSeq)
+    {
+        // A new cursor, or a cursor from before the file was
+        // reinitialized, starts from the oldest entry.
+
+        aCursor.mNextSeq = oldestSeq;
+    }
+    else if (aCursor.mNextSeq < oldestSeq)
+    {
+        aNumSkipped      = oldestSeq - aCursor.mNextSeq;
+        aCursor.mNextSeq = oldestSeq;
+    }
+
+    for (; aCursor.mNextSeq < mHeader->mNextSeq; aCursor.mNextSeq++)
+    {
+        const Record &record = GetRecord(aCursor.mNextSeq);
+
+        if (record.mSeq != aCursor.mNextSeq)
+        {
+            aNumSkipped++;
+            continue;
+        }
+
+        aRecord.mSeq       = record.mSeq;
+        aRecord.mTimestamp = record.mTimestamp;
+        aRecord.mList      = static_cast<otPlatHistoryTrackerList>(record.mList);
+        aRecord.mLength    = record.mLength;
+        memcpy(aRecord.mEntry, record.mEntry, sizeof(aRecord.mEntry));
+
+        aCursor.mNextSeq++;
+        ExitNow();
+    }
+
+    error = OT_ERROR_NOT_FOUND;
+
+exit:
+    return error;
+}
+
+uint64_t HistoryFile::GetNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000u + static_cast<uint64_t>(now.tv_nsec) / 1000u;
+}
+
+} // namespace Posix
+} // namespace ot
+
+void otPlatHistoryTrackerSaveEntry(otInstance              *aInstance,
+                                   otPlatHistoryTrackerList aList,
+                                   uint32_t                 aSequence,
+                                   uint32_t                 aAge,
+                                   const void              *aEntry,
+                                   uint16_t                 aLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aSequence);
+
+    // Entries are received in the order they were recorded, which is
+    // the order they are kept in the file.
+
+    ot::Posix::HistoryFile::Get().Save(aList, aAge, aEntry, aLength);
+}
+
+void otSysHistoryInitCursor(otSysHistoryCursor *aCursor) { aCursor->mNextSeq = 0; }
+
+otError otSysHistoryReadNext(otSysHistoryCursor *aCursor, otSysHistoryRecord *aRecord, uint64_t *aNumSkipped)
+{
+    uint64_t numSkipped;
+    otError  error = ot::Posix::HistoryFile::Get().ReadNext(*aCursor, *aRecord, numSkipped);
+
+    if (aNumSkipped != nullptr)
+    {
+        *aNumSkipped = numSkipped;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
@@ -0,0 +1,188 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes definitions of the memory-mapped History Tracker file.
+ */
+
+#ifndef OT_POSIX_PLATFORM_HISTORY_FILE_HPP_
+#define OT_POSIX_PLATFORM_HISTORY_FILE_HPP_
+
+#include "posix/platform/openthread-posix-config.h"
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/openthread-system.h>
+#include <openthread/platform/history_tracker.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/logger.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Keeps the History Tracker entries in a memory-mapped file.
+ *
+ * The file holds a header followed by a fixed number of fixed-size records used as a single ring shared by all
+ * History Tracker lists. Every record is tagged with a sequence number which keeps increasing across restarts, so
+ * consumers can stream new entries with a cursor (`otSysHistoryCursor`) and detect overwritten ones.
+ *
+ * The file is mapped with `MAP_SHARED`, so every saved entry is in the page cache as soon as `Save()` returns and
+ * survives a crash of the process. A record's sequence number is written last, so a record torn by a crash in the
+ * middle of `Save()` is detected and skipped.
+ */
+class HistoryFile : public Logger<HistoryFile>, private NonCopyable
+{
+public:
+    static const char kLogModuleName[]; ///< Module name used for logging.
+
+    /**
+     * Gets the `HistoryFile` singleton.
+     *
+     * @returns The singleton object.
+     */
+    static HistoryFile &Get(void);
+
+    /**
+     * Initializes the `HistoryFile`.
+     */
+    HistoryFile(void);
+
+    /**
+     * Opens the history file in the data directory using `OPENTHREAD_POSIX_CONFIG_HISTORY_FILE_DEPTH` records.
+     *
+     * @param[in] aDataPath  The data directory (can be `nullptr` to use the default settings path).
+     */
+    void Init(const char *aDataPath);
+
+    /**
+     * Opens (and if needed creates or resets) the history file.
+     *
+     * Existing entries are kept when the file was created with the same @p aDepth and record layout, otherwise the
+     * file is reinitialized.
+     *
+     * @param[in] aPath   The path of the history file.
+     * @param[in] aDepth  The number of records in the ring.
+     *
+     * @retval OT_ERROR_NONE            Successfully opened the history file.
+     * @retval OT_ERROR_INVALID_ARGS    @p aDepth is zero.
+     * @retval OT_ERROR_FAILED          Failed to open, resize or map the file.
+     */
+    otError Open(const char *aPath, uint32_t aDepth);
+
+    /**
+     * Unmaps and closes the history file.
+     */
+    void Close(void);
+
+    /**
+     * Indicates whether the history file is open.
+     *
+     * @retval TRUE   The history file is open.
+     * @retval FALSE  The history file is not open.
+     */
+    bool IsOpen(void) const { return mHeader != nullptr; }
+
+    /**
+     * Saves a History Tracker entry.
+     *
+     * Does nothing if the history file is not open. Entries longer than `OT_SYS_HISTORY_ENTRY_MAX_SIZE` are
+     * truncated. The entry is timestamped with the wall-clock time it was recorded, derived from @p aAge.
+     *
+     * @param[in] aList    The list the entry belongs to.
+     * @param[in] aAge     The time in milliseconds since the entry was recorded.
+     * @param[in] aEntry   A pointer to the entry.
+     * @param[in] aLength  The length of the entry in bytes.
+     */
+    void Save(otPlatHistoryTrackerList aList, uint32_t aAge, const void *aEntry, uint16_t aLength);
+
+    /**
+     * Reads the next entry after a cursor and advances the cursor.
+     *
+     * @param[in,out] aCursor      The cursor.
+     * @param[out]    aRecord      A reference to output the read entry.
+     * @param[out]    aNumSkipped  A reference to output the number of overwritten or torn entries skipped.
+     *
+     * @retval OT_ERROR_NONE           Successfully read the next entry.
+     * @retval OT_ERROR_NOT_FOUND      No new entry after @p aCursor.
+     * @retval OT_ERROR_INVALID_STATE  The history file is not open.
+     */
+    otError ReadNext(otSysHistoryCursor &aCursor, otSysHistoryRecord &aRecord, uint64_t &aNumSkipped) const;
+
+private:
+    static constexpr uint32_t kMagic        = 0x4f544854; // "OTHT"
+    static constexpr uint16_t kVersion      = 1;
+    static constexpr uint16_t kMaxEntrySize = OT_SYS_HISTORY_ENTRY_MAX_SIZE;
+
+    struct Header
+    {
+        uint32_t mMagic;
+        uint16_t mVersion;
+        uint16_t mRecordSize;
+        uint32_t mDepth;
+        uint32_t mReserved;
+        uint64_t mNextSeq; // Sequence numbers start from one.
+    };
+
+    struct Record
+    {
+        uint64_t mSeq; // Zero for an unused or torn record.
+        uint64_t mTimestamp;
+        uint8_t  mList;
+        uint8_t  mReserved;
+        uint16_t mLength;
+        uint32_t mReserved2;
+        uint8_t  mEntry[kMaxEntrySize];
+    };
+
+    bool     IsHeaderValid(uint32_t aDepth) const;
+    void     Reset(uint32_t aDepth);
+    uint64_t GetOldestSeq(void) const;
+    Record  &GetRecord(uint64_t aSeq) const { return mRecords[(aSeq - 1) % mHeader->mDepth]; }
+
+    static uint64_t GetNow(void);
+
+    int     mFd;
+    size_t  mMapSize;
+    Header *mHeader;
+    Record *mRecords;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+
+#endif // OT_POSIX_PLATFORM_HISTORY_FILE_HPP_
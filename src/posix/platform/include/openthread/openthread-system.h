@@ -44,6 +44,7 @@
 #include <openthread/error.h>
 #include <openthread/instance.h>
 #include <openthread/ip6.h>
+#include <openthread/platform/history_tracker.h>
 #include <openthread/platform/misc.h>
 
 #include "lib/spinel/coprocessor_type.h"
@@ -349,6 +350,61 @@ typedef void (*otSysCrashCallback)(void);
  */
 void otSysRegisterCrashCallback(otSysCrashCallback aCallback);
 
+/**
+ * Represents the maximum size (in bytes) of a History Tracker entry kept in the history file.
+ */
+#define OT_SYS_HISTORY_ENTRY_MAX_SIZE 48
+
+/**
+ * Represents a cursor to stream the History Tracker entries from the history file.
+ *
+ * The cursor only holds the sequence number of the next entry to read, so a consumer can save and restore it (e.g.
+ * across restarts) to continue exporting from where it stopped.
+ */
+typedef struct otSysHistoryCursor
+{
+    uint64_t mNextSeq; ///< Sequence number of the next entry to read (zero to start from the oldest entry).
+} otSysHistoryCursor;
+
+/**
+ * Represents a History Tracker entry read from the history file.
+ */
+typedef struct otSysHistoryRecord
+{
+    uint64_t                 mSeq;                                  ///< Sequence number of the entry.
+    uint64_t                 mTimestamp;                            ///< Wall-clock time recorded (usec since epoch).
+    otPlatHistoryTrackerList mList;                                 ///< The list the entry belongs to.
+    uint16_t                 mLength;                               ///< Length of the entry in bytes.
+    uint8_t                  mEntry[OT_SYS_HISTORY_ENTRY_MAX_SIZE]; ///< The entry (type determined by `mList`).
+} otSysHistoryRecord;
+
+/**
+ * Initializes a history cursor to start from the oldest entry in the history file.
+ *
+ * Requires `OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE`.
+ *
+ * @param[out] aCursor  A pointer to the cursor to initialize.
+ */
+void otSysHistoryInitCursor(otSysHistoryCursor *aCursor);
+
+/**
+ * Reads the next entry from the history file and advances the cursor.
+ *
+ * The history file is a bounded ring. If the entries after @p aCursor were overwritten since the last read, the
+ * cursor moves to the oldest available entry and the number of lost entries is reported in @p aNumSkipped.
+ *
+ * Requires `OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE`.
+ *
+ * @param[in,out] aCursor      A pointer to the cursor.
+ * @param[out]    aRecord      A pointer to output the read entry.
+ * @param[out]    aNumSkipped  A pointer to output the number of lost entries (can be NULL).
+ *
+ * @retval OT_ERROR_NONE           Successfully read the next entry.
+ * @retval OT_ERROR_NOT_FOUND      No new entry after @p aCursor.
+ * @retval OT_ERROR_INVALID_STATE  The history file is not open.
+ */
+otError otSysHistoryReadNext(otSysHistoryCursor *aCursor, otSysHistoryRecord *aRecord, uint64_t *aNumSkipped);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
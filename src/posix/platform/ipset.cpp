@@ -0,0 +1,469 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the netlink-based ipset manager used by the firewall.
+ */
+
+#include "ipset.hpp"
+
+#if defined(__linux__) && OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <linux/netfilter/ipset/ip_set.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include <openthread/logging.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+//---------------------------------------------------------------------------------------------------------------------
+// IpSetManager::PrefixSet
+
+otError IpSetManager::PrefixSet::Add(const otIp6Prefix &aPrefix)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(!Contains(aPrefix));
+    VerifyOrExit(mNumPrefixes < kMaxPrefixes, error = OT_ERROR_NO_BUFS);
+    mPrefixes[mNumPrefixes++] = aPrefix;
+
+exit:
+    return error;
+}
+
+bool IpSetManager::PrefixSet::Contains(const otIp6Prefix &aPrefix) const
+{
+    bool contains = false;
+
+    for (uint8_t i = 0; i < mNumPrefixes; i++)
+    {
+        if (otIp6ArePrefixesEqual(&mPrefixes[i], &aPrefix))
+        {
+            contains = true;
+            break;
+        }
+    }
+
+    return contains;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// IpSetManager::Batch
+
+// The largest message is an `ADD`, `DEL` or `SWAP` command: the headers, the protocol and set name attributes, and
+// either the nested data attributes or the second set name attribute (both 36 bytes long).
+static constexpr uint16_t kMaxMessageSize =
+    NLMSG_SPACE(sizeof(nfgenmsg)) + NLA_ALIGN(NLA_HDRLEN + 1) + 2 * NLA_ALIGN(NLA_HDRLEN + IPSET_MAXNAMELEN);
+
+IpSetManager::Batch::Batch(int aFd, uint32_t aSequence)
+    : mFd(aFd)
+    , mSequence(aSequence)
+    , mNumSentMessages(0)
+    , mLength(0)
+    , mMessageOffset(0)
+    , mNumMessages(0)
+{
+}
+
+otError IpSetManager::Batch::AppendFlush(const char *aSetName)
+{
+    otError error;
+
+    SuccessOrExit(error = BeginMessage(IPSET_CMD_FLUSH, aSetName));
+    EndMessage();
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::AppendSwap(const char *aSetName1, const char *aSetName2)
+{
+    otError error;
+
+    VerifyOrExit(strlen(aSetName2) < IPSET_MAXNAMELEN, error = OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = BeginMessage(IPSET_CMD_SWAP, aSetName1));
+    SuccessOrExit(
+        error = AppendAttribute(IPSET_ATTR_SETNAME2, aSetName2, static_cast<uint16_t>(strlen(aSetName2) + 1)));
+    EndMessage();
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::AppendAddOrDelete(uint8_t aCommand, const char *aSetName, const otIp6Prefix &aPrefix)
+{
+    otError  error;
+    uint16_t dataOffset;
+    uint16_t ipOffset;
+
+    SuccessOrExit(error = BeginMessage(aCommand, aSetName));
+    SuccessOrExit(error = BeginNested(IPSET_ATTR_DATA, dataOffset));
+    SuccessOrExit(error = BeginNested(IPSET_ATTR_IP, ipOffset));
+    SuccessOrExit(error = AppendAttribute(IPSET_ATTR_IPADDR_IPV6 | NLA_F_NET_BYTEORDER, aPrefix.mPrefix.mFields.m8,
+                                          sizeof(aPrefix.mPrefix.mFields.m8)));
+    EndNested(ipOffset);
+    SuccessOrExit(error = AppendAttribute(IPSET_ATTR_CIDR, &aPrefix.mLength, sizeof(aPrefix.mLength)));
+    EndNested(dataOffset);
+    EndMessage();
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::Send(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mNumMessages > 0);
+
+    if (send(mFd, mBuffer, mLength, MSG_DONTWAIT) != static_cast<ssize_t>(mLength))
+    {
+        otLogWarnPlat("Firewall - failed to send ipset netlink batch: %s", strerror(errno));
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
+    mNumSentMessages += mNumMessages;
+    mNumMessages = 0;
+    mLength      = 0;
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::BeginMessage(uint8_t aCommand, const char *aSetName)
+{
+    static constexpr uint16_t kHeaderSize = NLMSG_SPACE(sizeof(nfgenmsg));
+
+    otError   error    = OT_ERROR_NONE;
+    uint8_t   protocol = IPSET_PROTOCOL;
+    nlmsghdr *header;
+    nfgenmsg *genMsg;
+
+    VerifyOrExit(strlen(aSetName) < IPSET_MAXNAMELEN, error = OT_ERROR_INVALID_ARGS);
+
+    // Send the buffered messages first when the new message may
+    // not fit in the rest of the buffer.
+
+    if (mLength + kMaxMessageSize > kBufferSize)
+    {
+        SuccessOrExit(error = Send());
+    }
+
+    mMessageOffset = mLength;
+
+    header = reinterpret_cast<nlmsghdr *>(&mBuffer[mLength]);
+    memset(header, 0, kHeaderSize);
+    header->nlmsg_type  = static_cast<uint16_t>((NFNL_SUBSYS_IPSET << 8) | aCommand);
+    header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK;
+    header->nlmsg_seq   = mSequence + mNumSentMessages + mNumMessages;
+
+    genMsg               = static_cast<nfgenmsg *>(NLMSG_DATA(header));
+    genMsg->nfgen_family = AF_INET6;
+    genMsg->version      = NFNETLINK_V0;
+
+    mLength += kHeaderSize;
+
+    SuccessOrExit(error = AppendAttribute(IPSET_ATTR_PROTOCOL, &protocol, sizeof(protocol)));
+    error = AppendAttribute(IPSET_ATTR_SETNAME, aSetName, static_cast<uint16_t>(strlen(aSetName) + 1));
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::AppendAttribute(uint16_t aType, const void *aValue, uint16_t aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t size  = NLA_ALIGN(NLA_HDRLEN + aLength);
+    nlattr  *attr;
+
+    VerifyOrExit(mLength + size <= kBufferSize, error = OT_ERROR_NO_BUFS);
+
+    attr = reinterpret_cast<nlattr *>(&mBuffer[mLength]);
+    memset(attr, 0, size);
+    attr->nla_type = aType;
+    attr->nla_len  = static_cast<uint16_t>(NLA_HDRLEN + aLength);
+
+    if (aLength > 0)
+    {
+        memcpy(&mBuffer[mLength + NLA_HDRLEN], aValue, aLength);
+    }
+
+    mLength += size;
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Batch::BeginNested(uint16_t aType, uint16_t &aNestOffset)
+{
+    aNestOffset = mLength;
+
+    return AppendAttribute(aType | NLA_F_NESTED, nullptr, 0);
+}
+
+void IpSetManager::Batch::EndNested(uint16_t aNestOffset)
+{
+    reinterpret_cast<nlattr *>(&mBuffer[aNestOffset])->nla_len = mLength - aNestOffset;
+}
+
+void IpSetManager::Batch::EndMessage(void)
+{
+    reinterpret_cast<nlmsghdr *>(&mBuffer[mMessageOffset])->nlmsg_len = mLength - mMessageOffset;
+    mNumMessages++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// IpSetManager
+
+IpSetManager::IpSetManager(IpSet *aIpSets, uint8_t aNumIpSets)
+    : mIpSets(aIpSets)
+    , mNumIpSets(aNumIpSets)
+    , mHasRequest(false)
+    , mUpdateFailed(false)
+    , mFd(-1)
+    , mSequence(0)
+    , mNumPendingAcks(0)
+{
+}
+
+void IpSetManager::SetSocket(int aFd) { mFd = aFd; }
+
+otError IpSetManager::RequestUpdate(const PrefixSet *aPrefixes)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mFd >= 0, error = OT_ERROR_INVALID_STATE);
+
+    for (uint8_t i = 0; i < mNumIpSets; i++)
+    {
+        mIpSets[i].mRequested = aPrefixes[i];
+    }
+
+    mHasRequest = true;
+
+    // The request is sent once the update in progress completes, so
+    // that the diff is always computed against acknowledged content.
+
+    VerifyOrExit(!IsUpdateInProgress());
+    error = SendRequestedUpdate();
+
+exit:
+    return error;
+}
+
+void IpSetManager::Update(Mainloop::Context &aContext)
+{
+    if (IsUpdateInProgress())
+    {
+        Mainloop::AddToReadFdSet(mFd, aContext);
+    }
+}
+
+void IpSetManager::Process(const Mainloop::Context &aContext)
+{
+    if (IsUpdateInProgress() && Mainloop::IsFdReadable(mFd, aContext))
+    {
+        ReceiveAcks();
+    }
+}
+
+otError IpSetManager::SendRequestedUpdate(void)
+{
+    otError error = OT_ERROR_NONE;
+    Batch   batch(mFd, mSequence);
+
+    mHasRequest   = false;
+    mUpdateFailed = false;
+
+    for (uint8_t i = 0; i < mNumIpSets; i++)
+    {
+        if (mIpSets[i].mIsSynced)
+        {
+            SuccessOrExit(error = AppendIncrementalUpdate(batch, mIpSets[i]));
+        }
+        else
+        {
+            SuccessOrExit(error = AppendFullUpdate(batch, mIpSets[i]));
+        }
+    }
+
+    error = batch.Send();
+
+exit:
+    // The kernel acknowledges each sent message, even when a later
+    // part of the update fails to be sent.
+
+    mSequence += batch.GetNumSentMessages();
+    mNumPendingAcks = batch.GetNumSentMessages();
+
+    for (uint8_t i = 0; i < mNumIpSets; i++)
+    {
+        // On failure the content of the active ipset is unknown, so
+        // the next update rebuilds it from scratch.
+
+        mIpSets[i].mApplied  = mIpSets[i].mRequested;
+        mIpSets[i].mIsSynced = (error == OT_ERROR_NONE);
+    }
+
+    return error;
+}
+
+otError IpSetManager::AppendFullUpdate(Batch &aBatch, const IpSet &aIpSet)
+{
+    otError          error;
+    const PrefixSet &prefixes = aIpSet.mRequested;
+
+    SuccessOrExit(error = aBatch.AppendFlush(aIpSet.mSwapName));
+
+    for (uint8_t i = 0; i < prefixes.GetNumPrefixes(); i++)
+    {
+        SuccessOrExit(error = aBatch.AppendAddOrDelete(IPSET_CMD_ADD, aIpSet.mSwapName, prefixes.GetPrefix(i)));
+    }
+
+    error = aBatch.AppendSwap(aIpSet.mSwapName, aIpSet.mName);
+
+exit:
+    return error;
+}
+
+otError IpSetManager::AppendIncrementalUpdate(Batch &aBatch, const IpSet &aIpSet)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint8_t i = 0; i < aIpSet.mApplied.GetNumPrefixes(); i++)
+    {
+        const otIp6Prefix &prefix = aIpSet.mApplied.GetPrefix(i);
+
+        if (!aIpSet.mRequested.Contains(prefix))
+        {
+            SuccessOrExit(error = aBatch.AppendAddOrDelete(IPSET_CMD_DEL, aIpSet.mName, prefix));
+        }
+    }
+
+    for (uint8_t i = 0; i < aIpSet.mRequested.GetNumPrefixes(); i++)
+    {
+        const otIp6Prefix &prefix = aIpSet.mRequested.GetPrefix(i);
+
+        if (!aIpSet.mApplied.Contains(prefix))
+        {
+            SuccessOrExit(error = aBatch.AppendAddOrDelete(IPSET_CMD_ADD, aIpSet.mName, prefix));
+        }
+    }
+
+exit:
+    return error;
+}
+
+void IpSetManager::ReceiveAcks(void)
+{
+    // The kernel acknowledges each message separately, reporting the
+    // result of the command in the `nlmsgerr`. Only the acks already
+    // queued on the socket are read, the rest are read once the socket
+    // becomes readable again.
+
+    while (IsUpdateInProgress())
+    {
+        uint8_t   buffer[kAckBufferSize];
+        ssize_t   length = recv(mFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        int       remaining;
+        nlmsghdr *header;
+
+        if ((length < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            ExitNow();
+        }
+
+        if (length <= 0)
+        {
+            otLogWarnPlat("Firewall - failed to receive ipset netlink ack: %s", strerror(errno));
+            mNumPendingAcks = 0;
+            mUpdateFailed   = true;
+            break;
+        }
+
+        remaining = static_cast<int>(length);
+
+        for (header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, remaining);
+             header = NLMSG_NEXT(header, remaining))
+        {
+            uint32_t        firstSeq = mSequence - mNumPendingAcks;
+            const nlmsgerr *ack;
+
+            if ((header->nlmsg_type != NLMSG_ERROR) || (header->nlmsg_seq - firstSeq >= mNumPendingAcks))
+            {
+                continue;
+            }
+
+            mNumPendingAcks--;
+            ack = static_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+            if (ack->error != 0)
+            {
+                otLogWarnPlat("Firewall - ipset netlink command (seq %u) failed: %s", header->nlmsg_seq,
+                              strerror(-ack->error));
+                mUpdateFailed = true;
+            }
+        }
+    }
+
+    HandleUpdateDone();
+
+exit:
+    return;
+}
+
+void IpSetManager::HandleUpdateDone(void)
+{
+    if (mUpdateFailed)
+    {
+        for (uint8_t i = 0; i < mNumIpSets; i++)
+        {
+            mIpSets[i].mIsSynced = false;
+        }
+    }
+
+    if (mHasRequest && (SendRequestedUpdate() != OT_ERROR_NONE))
+    {
+        otLogWarnPlat("Firewall - failed to send the queued ipset update");
+    }
+}
+
+} // namespace Posix
+} // namespace ot
+
+#endif // defined(__linux__) && OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
@@ -0,0 +1,252 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes definitions of the netlink-based ipset manager used by the firewall.
+ */
+
+#ifndef OT_POSIX_PLATFORM_IPSET_HPP_
+#define OT_POSIX_PLATFORM_IPSET_HPP_
+
+#include "posix/platform/openthread-posix-config.h"
+
+#if defined(__linux__) && OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/ip6.h>
+#include <openthread/thread.h>
+
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Manages the content of `hash:net` ipsets through the netlink `NFNL_SUBSYS_IPSET` interface.
+ *
+ * Each managed ipset is paired with a swap ipset of the same type. The first update (and any update following a
+ * failure) rebuilds the swap ipset and atomically swaps it with the active one. Later updates only delete the
+ * removed prefixes from and add the new prefixes to the active ipset.
+ *
+ * The commands of an update are sent to the kernel in as few netlink batches as possible without blocking. Their
+ * acknowledgments are processed from the mainloop, and at most one update is in progress at a time.
+ */
+class IpSetManager : public Mainloop::Source
+{
+public:
+    /**
+     * Maximum number of prefixes in a managed ipset.
+     *
+     * The smallest on-mesh prefix entry in the Network Data is a Prefix TLV with a zero-length prefix (4 bytes)
+     * holding a Border Router sub-TLV with a single entry (6 bytes). So the Network Data holds no more than
+     * `OT_NETWORK_BASE_TLV_MAX_LENGTH / 10` distinct on-mesh prefixes. One more entry is kept for the mesh-local
+     * prefix.
+     */
+    static constexpr uint8_t kMaxPrefixes = OT_NETWORK_BASE_TLV_MAX_LENGTH / (4 + 6) + 1;
+
+    /**
+     * Represents a set of IPv6 prefixes.
+     */
+    class PrefixSet
+    {
+    public:
+        /**
+         * Initializes the `PrefixSet` as empty.
+         */
+        PrefixSet(void) { Clear(); }
+
+        /**
+         * Clears the `PrefixSet`.
+         */
+        void Clear(void) { mNumPrefixes = 0; }
+
+        /**
+         * Adds a prefix to the `PrefixSet` (if not already present).
+         *
+         * @param[in] aPrefix  The prefix to add.
+         *
+         * @retval OT_ERROR_NONE     The prefix was added or was already present.
+         * @retval OT_ERROR_NO_BUFS  The `PrefixSet` is full.
+         */
+        otError Add(const otIp6Prefix &aPrefix);
+
+        /**
+         * Indicates whether the `PrefixSet` contains a given prefix.
+         *
+         * @param[in] aPrefix  The prefix to search for.
+         *
+         * @retval TRUE   The `PrefixSet` contains @p aPrefix.
+         * @retval FALSE  The `PrefixSet` does not contain @p aPrefix.
+         */
+        bool Contains(const otIp6Prefix &aPrefix) const;
+
+        /**
+         * Gets the number of prefixes in the `PrefixSet`.
+         *
+         * @returns The number of prefixes.
+         */
+        uint8_t GetNumPrefixes(void) const { return mNumPrefixes; }
+
+        /**
+         * Gets the prefix at a given index.
+         *
+         * @param[in] aIndex  The index, MUST be less than `GetNumPrefixes()`.
+         *
+         * @returns The prefix at @p aIndex.
+         */
+        const otIp6Prefix &GetPrefix(uint8_t aIndex) const { return mPrefixes[aIndex]; }
+
+    private:
+        otIp6Prefix mPrefixes[kMaxPrefixes];
+        uint8_t     mNumPrefixes;
+    };
+
+    /**
+     * Represents an ipset managed by `IpSetManager`.
+     */
+    struct IpSet
+    {
+        const char *mName;      ///< The name of the active ipset.
+        const char *mSwapName;  ///< The name of the swap ipset.
+        PrefixSet   mApplied;   ///< The prefixes in the active ipset once the sent commands are acknowledged.
+        PrefixSet   mRequested; ///< The prefixes of the latest requested update.
+        bool        mIsSynced;  ///< Whether `mApplied` is known to match the active ipset.
+    };
+
+    /**
+     * Initializes the `IpSetManager`.
+     *
+     * @param[in] aIpSets     The ipsets to manage.
+     * @param[in] aNumIpSets  The number of entries in @p aIpSets.
+     */
+    IpSetManager(IpSet *aIpSets, uint8_t aNumIpSets);
+
+    /**
+     * Sets the netlink socket used to talk to the kernel.
+     *
+     * The socket is not owned by `IpSetManager`. It is only used with `MSG_DONTWAIT`.
+     *
+     * @param[in] aFd  A `NETLINK_NETFILTER` socket file descriptor.
+     */
+    void SetSocket(int aFd);
+
+    /**
+     * Requests the content of the managed ipsets to be updated.
+     *
+     * If no update is in progress, the commands are sent right away. Otherwise the request is sent once the update in
+     * progress completes, replacing any earlier request still waiting.
+     *
+     * Once the update completes, each managed ipset contains exactly the prefixes in the corresponding entry of
+     * @p aPrefixes. Failures reported by the kernel are logged, and the next update rebuilds the ipsets.
+     *
+     * @param[in] aPrefixes  The new prefixes of each managed ipset, in the order of the ipsets.
+     *
+     * @retval OT_ERROR_NONE           Successfully sent or queued the update.
+     * @retval OT_ERROR_INVALID_STATE  The netlink socket is not set.
+     * @retval OT_ERROR_FAILED         Failed to send the update to the kernel.
+     */
+    otError RequestUpdate(const PrefixSet *aPrefixes);
+
+    /**
+     * Indicates whether an update is waiting for acknowledgments from the kernel.
+     *
+     * @retval TRUE   An update is in progress.
+     * @retval FALSE  No update is in progress.
+     */
+    bool IsUpdateInProgress(void) const { return mNumPendingAcks > 0; }
+
+    /**
+     * Updates the fd_set for mainloop.
+     *
+     * @param[in,out]   aContext    A reference to the mainloop context.
+     */
+    void Update(Mainloop::Context &aContext) override;
+
+    /**
+     * Processes the acknowledgments received from the kernel.
+     *
+     * @param[in]   aContext   A reference to the mainloop context.
+     */
+    void Process(const Mainloop::Context &aContext) override;
+
+private:
+    static constexpr uint16_t kBufferSize    = 2048;
+    static constexpr uint16_t kAckBufferSize = 512;
+
+    class Batch
+    {
+    public:
+        Batch(int aFd, uint32_t aSequence);
+
+        otError AppendFlush(const char *aSetName);
+        otError AppendSwap(const char *aSetName1, const char *aSetName2);
+        otError AppendAddOrDelete(uint8_t aCommand, const char *aSetName, const otIp6Prefix &aPrefix);
+        otError Send(void);
+
+        uint32_t GetNumSentMessages(void) const { return mNumSentMessages; }
+
+    private:
+        otError BeginMessage(uint8_t aCommand, const char *aSetName);
+        otError AppendAttribute(uint16_t aType, const void *aValue, uint16_t aLength);
+        otError BeginNested(uint16_t aType, uint16_t &aNestOffset);
+        void    EndNested(uint16_t aNestOffset);
+        void    EndMessage(void);
+
+        int      mFd;
+        uint32_t mSequence;
+        uint32_t mNumSentMessages;
+        uint16_t mLength;
+        uint16_t mMessageOffset;
+        uint16_t mNumMessages;
+        uint8_t  mBuffer[kBufferSize];
+    };
+
+    otError SendRequestedUpdate(void);
+    otError AppendFullUpdate(Batch &aBatch, const IpSet &aIpSet);
+    otError AppendIncrementalUpdate(Batch &aBatch, const IpSet &aIpSet);
+    void    ReceiveAcks(void);
+    void    HandleUpdateDone(void);
+
+    IpSet   *mIpSets;
+    uint8_t  mNumIpSets;
+    bool     mHasRequest;
+    bool     mUpdateFailed;
+    int      mFd;
+    uint32_t mSequence;
+    uint32_t mNumPendingAcks;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // defined(__linux__) && OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
+#endif // OT_POSIX_PLATFORM_IPSET_HPP_
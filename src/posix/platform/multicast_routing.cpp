@@ -52,6 +52,7 @@
 #include "utils.hpp"
 #include "common/arg_macros.hpp"
 #include "core/common/debug.hpp"
+#include "core/common/hash.hpp"
 
 namespace ot {
 namespace Posix {
@@ -270,10 +271,7 @@ otError MulticastRoutingManager::InitMulticastRouterSock(void)
     struct icmp6_filter filter;
     struct mif6ctl      mif6ctl;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
-    {
-        mfc.Erase();
-    }
+    ResetMulticastForwardingCacheTable();
 
     // Create a Multicast Routing socket
     mMulticastRouterSock = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketBlock);
@@ -362,6 +360,8 @@ void MulticastRoutingManager::ProcessMulticastRouterMessages(void)
     src.InitFrom(mrt6msg->im6_src.s6_addr);
     dst.InitFrom(mrt6msg->im6_dst.s6_addr);
 
+    mCounters.mUpcalls++;
+
     error = AddMulticastForwardingCache(src, dst, static_cast<MifIndex>(mrt6msg->im6_mif));
 
 exit:
@@ -438,12 +438,14 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6::
     mf6cctl.mf6cc_parent = kMifIndexBackbone;
     IF_SET(kMifIndexThread, &mf6cctl.mf6cc_ifset);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    for (uint16_t index = mGroupBuckets[HashGroup(aGroupAddr)]; index != kNone;)
     {
-        otError error;
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+        otError                   error;
+
+        index = mfc.mNextInGroup;
 
-        if (!mfc.IsValid() || mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread ||
-            mfc.mGroupAddr != aGroupAddr)
+        if (mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread || mfc.mGroupAddr != aGroupAddr)
         {
             continue;
         }
@@ -457,6 +459,7 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6::
                     : OT_ERROR_FAILED;
 
         mfc.Set(kMifIndexBackbone, kMifIndexThread);
+        MoveToLruTail(mfc);
 
         LogResult(error, "%s: %s %s => %s %s", __FUNCTION__, MifIndexToString(mfc.mIif),
                   mfc.mSrcAddr.ToString().AsCString(), mfc.mGroupAddr.ToString().AsCString(),
@@ -466,9 +469,14 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6::
 
 void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr)
 {
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    for (uint16_t index = mGroupBuckets[HashGroup(aGroupAddr)]; index != kNone;)
     {
-        if (mfc.IsValid() && mfc.mIif == kMifIndexBackbone && mfc.mGroupAddr == aGroupAddr)
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+
+        // Read the next index first since removing `mfc` unlinks it from the group bucket.
+        index = mfc.mNextInGroup;
+
+        if (mfc.mIif == kMifIndexBackbone && mfc.mGroupAddr == aGroupAddr)
         {
             RemoveMulticastForwardingCache(mfc);
         }
@@ -477,26 +485,31 @@ void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6::A
 
 void MulticastRoutingManager::ExpireMulticastForwardingCache(void)
 {
-    struct sioc_sg_req6 sioc_sg_req6;
-    uint64_t            now = otPlatTimeGet();
-    struct mf6cctl      mf6cctl;
+    uint64_t now = otPlatTimeGet();
 
     VerifyOrExit(now >= mLastExpireTime + kMulticastForwardingCacheExpiringInterval * OT_US_PER_S);
 
-    mLastExpireTime = now;
-
-    memset(&mf6cctl, 0, sizeof(mf6cctl));
-    memset(&sioc_sg_req6, 0, sizeof(sioc_sg_req6));
+    LogCounters(now);
+    mLastLoggedCounters = mCounters;
+    mLastExpireTime     = now;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    // The LRU list is ordered by `mLastUseTime`, so only the idle prefix of the list needs its kernel counters
+    // queried. An entry that saw traffic is moved to the tail with a fresh `mLastUseTime`, which also guarantees
+    // the walk stops once every idle entry has been visited.
+    while (mLruHead != kNone)
     {
-        if (mfc.IsValid() && mfc.mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S < now)
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[mLruHead];
+
+        if (mfc.mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S >= now)
         {
-            if (!UpdateMulticastRouteInfo(mfc))
-            {
-                // The multicast route is expired
-                RemoveMulticastForwardingCache(mfc);
-            }
+            break;
+        }
+
+        if (!UpdateMulticastRouteInfo(mfc))
+        {
+            // The multicast route is expired
+            mCounters.mExpirations++;
+            RemoveMulticastForwardingCache(mfc);
         }
     }
 
@@ -506,7 +519,7 @@ exit:
     return;
 }
 
-bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const
+bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc)
 {
     bool                updated = false;
     struct sioc_sg_req6 sioc_sg_req6;
@@ -528,6 +541,7 @@ bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache
         if (validPktCnt != aMfc.mValidPktCnt)
         {
             aMfc.SetValidPktCnt(validPktCnt);
+            MoveToLruTail(aMfc);
 
             updated = true;
         }
@@ -566,13 +580,12 @@ void MulticastRoutingManager::DumpMulticastForwardingCache(void) const
 #if OPENTHREAD_CONFIG_LOG_PLATFORM && (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_DEBG)
     LogDebg("==================== MFC ENTRIES ====================");
 
-    for (const MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    for (uint16_t index = mLruHead; index != kNone; index = mMulticastForwardingCacheTable[index].mLruNext)
     {
-        if (mfc.IsValid())
-        {
-            LogDebg("%s %s => %s %s", MifIndexToString(mfc.mIif), mfc.mSrcAddr.ToString().AsCString(),
-                    mfc.mGroupAddr.ToString().AsCString(), MifIndexToString(mfc.mOif));
-        }
+        const MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+
+        LogDebg("%s %s => %s %s", MifIndexToString(mfc.mIif), mfc.mSrcAddr.ToString().AsCString(),
+                mfc.mGroupAddr.ToString().AsCString(), MifIndexToString(mfc.mOif));
     }
 
     LogDebg("=====================================================");
@@ -628,47 +641,37 @@ void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6::Address
                                                            MulticastRoutingManager::MifIndex aIif,
                                                            MulticastRoutingManager::MifIndex aOif)
 {
-    MulticastForwardingCache *invalid = nullptr;
-    MulticastForwardingCache *oldest  = nullptr;
+    MulticastForwardingCache *mfc = FindMulticastForwardingCache(aSrcAddr, aGroupAddr);
+    uint16_t                  index;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    if (mfc != nullptr)
     {
-        if (mfc.IsValid())
-        {
-            if (mfc.mSrcAddr == aSrcAddr && mfc.mGroupAddr == aGroupAddr)
-            {
-                mfc.Set(aIif, aOif);
-                ExitNow();
-            }
-
-            if (oldest == nullptr || mfc.mLastUseTime < oldest->mLastUseTime)
-            {
-                oldest = &mfc;
-            }
-        }
-        else if (invalid == nullptr)
-        {
-            invalid = &mfc;
-        }
+        mCounters.mHits++;
+        mfc->Set(aIif, aOif);
+        MoveToLruTail(*mfc);
+        ExitNow();
     }
 
-    if (invalid != nullptr)
-    {
-        invalid->Set(aSrcAddr, aGroupAddr, aIif, aOif);
-    }
-    else
+    if (mFreeHead == kNone)
     {
-        RemoveMulticastForwardingCache(*oldest);
-        oldest->Set(aSrcAddr, aGroupAddr, aIif, aOif);
+        // Evict the least recently used entry, it returns to the free list.
+        mCounters.mEvictions++;
+        RemoveMulticastForwardingCache(mMulticastForwardingCacheTable[mLruHead]);
     }
 
+    index     = mFreeHead;
+    mFreeHead = mMulticastForwardingCacheTable[index].mLruNext;
+
+    mMulticastForwardingCacheTable[index].Set(aSrcAddr, aGroupAddr, aIif, aOif);
+    LinkMulticastForwardingCache(index);
+
 exit:
     return;
 }
 
-void MulticastRoutingManager::RemoveMulticastForwardingCache(
-    MulticastRoutingManager::MulticastForwardingCache &aMfc) const
+void MulticastRoutingManager::RemoveMulticastForwardingCache(MulticastRoutingManager::MulticastForwardingCache &aMfc)
 {
+    uint16_t       index = IndexOf(aMfc);
     otError        error;
     struct mf6cctl mf6cctl;
 
@@ -689,7 +692,202 @@ void MulticastRoutingManager::RemoveMulticastForwardingCache(
               aMfc.mSrcAddr.ToString().AsCString(), aMfc.mGroupAddr.ToString().AsCString(),
               MifIndexToString(aMfc.mOif));
 
+    UnlinkMulticastForwardingCache(index);
     aMfc.Erase();
+
+    aMfc.mLruNext = mFreeHead;
+    mFreeHead     = index;
+}
+
+void MulticastRoutingManager::ResetMulticastForwardingCacheTable(void)
+{
+    for (uint16_t &bucket : mSourceGroupBuckets)
+    {
+        bucket = kNone;
+    }
+
+    for (uint16_t &bucket : mGroupBuckets)
+    {
+        bucket = kNone;
+    }
+
+    for (uint16_t index = 0; index < kMulticastForwardingCacheTableSize; index++)
+    {
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+
+        mfc.Erase();
+        mfc.mNextInBucket = kNone;
+        mfc.mNextInGroup  = kNone;
+        mfc.mLruPrev      = kNone;
+        mfc.mLruNext      = (index + 1 < kMulticastForwardingCacheTableSize) ? index + 1 : kNone;
+    }
+
+    mFreeHead = 0;
+    mLruHead  = kNone;
+    mLruTail  = kNone;
+
+    memset(&mCounters, 0, sizeof(mCounters));
+    mLastLoggedCounters = mCounters;
+}
+
+MulticastRoutingManager::MulticastForwardingCache *MulticastRoutingManager::FindMulticastForwardingCache(
+    const Ip6::Address &aSrcAddr,
+    const Ip6::Address &aGroupAddr)
+{
+    MulticastForwardingCache *mfc   = nullptr;
+    uint16_t                  index = mSourceGroupBuckets[HashSourceGroup(aSrcAddr, aGroupAddr)];
+
+    while (index != kNone)
+    {
+        MulticastForwardingCache &entry = mMulticastForwardingCacheTable[index];
+
+        if (entry.mSrcAddr == aSrcAddr && entry.mGroupAddr == aGroupAddr)
+        {
+            ExitNow(mfc = &entry);
+        }
+
+        index = entry.mNextInBucket;
+    }
+
+exit:
+    return mfc;
+}
+
+void MulticastRoutingManager::LinkMulticastForwardingCache(uint16_t aIndex)
+{
+    MulticastForwardingCache &mfc         = mMulticastForwardingCacheTable[aIndex];
+    uint16_t                 &sourceGroup = mSourceGroupBuckets[HashSourceGroup(mfc.mSrcAddr, mfc.mGroupAddr)];
+    uint16_t                 &group       = mGroupBuckets[HashGroup(mfc.mGroupAddr)];
+
+    mfc.mNextInBucket = sourceGroup;
+    sourceGroup       = aIndex;
+    mfc.mNextInGroup  = group;
+    group             = aIndex;
+
+    AppendToLru(aIndex);
+}
+
+void MulticastRoutingManager::UnlinkMulticastForwardingCache(uint16_t aIndex)
+{
+    MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[aIndex];
+    uint16_t                 *link;
+
+    for (link = &mSourceGroupBuckets[HashSourceGroup(mfc.mSrcAddr, mfc.mGroupAddr)]; *link != aIndex;
+         link = &mMulticastForwardingCacheTable[*link].mNextInBucket)
+    {
+        OT_ASSERT(*link != kNone);
+    }
+
+    *link = mfc.mNextInBucket;
+
+    for (link = &mGroupBuckets[HashGroup(mfc.mGroupAddr)]; *link != aIndex;
+         link = &mMulticastForwardingCacheTable[*link].mNextInGroup)
+    {
+        OT_ASSERT(*link != kNone);
+    }
+
+    *link = mfc.mNextInGroup;
+
+    mfc.mNextInBucket = kNone;
+    mfc.mNextInGroup  = kNone;
+
+    RemoveFromLru(aIndex);
+}
+
+void MulticastRoutingManager::AppendToLru(uint16_t aIndex)
+{
+    MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[aIndex];
+
+    mfc.mLruPrev = mLruTail;
+    mfc.mLruNext = kNone;
+
+    if (mLruTail == kNone)
+    {
+        mLruHead = aIndex;
+    }
+    else
+    {
+        mMulticastForwardingCacheTable[mLruTail].mLruNext = aIndex;
+    }
+
+    mLruTail = aIndex;
+}
+
+void MulticastRoutingManager::RemoveFromLru(uint16_t aIndex)
+{
+    MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[aIndex];
+
+    if (mfc.mLruPrev == kNone)
+    {
+        mLruHead = mfc.mLruNext;
+    }
+    else
+    {
+        mMulticastForwardingCacheTable[mfc.mLruPrev].mLruNext = mfc.mLruNext;
+    }
+
+    if (mfc.mLruNext == kNone)
+    {
+        mLruTail = mfc.mLruPrev;
+    }
+    else
+    {
+        mMulticastForwardingCacheTable[mfc.mLruNext].mLruPrev = mfc.mLruPrev;
+    }
+
+    mfc.mLruPrev = kNone;
+    mfc.mLruNext = kNone;
+}
+
+void MulticastRoutingManager::MoveToLruTail(MulticastForwardingCache &aMfc)
+{
+    uint16_t index = IndexOf(aMfc);
+
+    VerifyOrExit(index != mLruTail);
+
+    RemoveFromLru(index);
+    AppendToLru(index);
+
+exit:
+    return;
+}
+
+uint16_t MulticastRoutingManager::IndexOf(const MulticastForwardingCache &aMfc) const
+{
+    return static_cast<uint16_t>(&aMfc - &mMulticastForwardingCacheTable[0]);
+}
+
+void MulticastRoutingManager::LogCounters(uint64_t aNow) const
+{
+    uint64_t elapsedSec;
+
+    VerifyOrExit(mLastExpireTime != 0);
+
+    elapsedSec = OT_MAX((aNow - mLastExpireTime) / OT_US_PER_S, static_cast<uint64_t>(1));
+
+    LogInfo("MFC: upcalls %lu/s, hits %lu/s, evictions %lu, expirations %lu",
+            static_cast<unsigned long>((mCounters.mUpcalls - mLastLoggedCounters.mUpcalls) / elapsedSec),
+            static_cast<unsigned long>((mCounters.mHits - mLastLoggedCounters.mHits) / elapsedSec),
+            mCounters.mEvictions - mLastLoggedCounters.mEvictions,
+            mCounters.mExpirations - mLastLoggedCounters.mExpirations);
+
+exit:
+    return;
+}
+
+uint16_t MulticastRoutingManager::HashSourceGroup(const Ip6::Address &aSrcAddr, const Ip6::Address &aGroupAddr)
+{
+    Fnv1aHash hash;
+
+    hash.Feed(aSrcAddr);
+    hash.Feed(aGroupAddr);
+
+    return static_cast<uint16_t>(hash.GetHash() % kNumBuckets);
+}
+
+uint16_t MulticastRoutingManager::HashGroup(const Ip6::Address &aGroupAddr)
+{
+    return static_cast<uint16_t>(Fnv1aHash().Feed(aGroupAddr) % kNumBuckets);
 }
 
 } // namespace Posix
@@ -62,6 +62,7 @@ public:
         , mRetryIntervalMs(kMinRetryIntervalMs)
         , mNextRetryTime(0)
     {
+        ResetMulticastForwardingCacheTable();
     }
 
     bool IsEnabled(void) const { return mState == kStateEnabled; }
@@ -78,6 +79,18 @@ private:
     static constexpr uint16_t kMulticastForwardingCacheExpiringInterval = 60;
     static constexpr uint16_t kMulticastForwardingCacheTableSize =
         OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE;
+    static constexpr uint16_t kNumBuckets = kMulticastForwardingCacheTableSize;
+    static constexpr uint16_t kNone       = 0xffff;
+
+    static_assert(kMulticastForwardingCacheTableSize < kNone, "MFC table is too large for uint16_t indexes");
+
+    struct Counters
+    {
+        unsigned long mUpcalls;     // `MRT6MSG_NOCACHE` upcalls from the kernel.
+        unsigned long mHits;        // Upcalls for a (source, group) already present in the table.
+        unsigned long mEvictions;   // Entries evicted (least recently used first) to make room.
+        unsigned long mExpirations; // Entries removed since the kernel counters showed no traffic.
+    };
 
     enum State : uint8_t
     {
@@ -115,6 +128,10 @@ private:
         unsigned long mValidPktCnt;
         MifIndex      mIif;
         MifIndex      mOif;
+        uint16_t      mNextInBucket; // Next entry in the same (source, group) hash bucket.
+        uint16_t      mNextInGroup;  // Next entry in the same group hash bucket.
+        uint16_t      mLruPrev;      // Previous (less recently used) entry, or `kNone`.
+        uint16_t      mLruNext;      // Next (more recently used) entry, also links the free list.
     };
 
     void    Enable(void);
@@ -134,8 +151,20 @@ private:
     void    UnblockInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    RemoveInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    ExpireMulticastForwardingCache(void);
-    bool    UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const;
-    void    RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc) const;
+    bool    UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc);
+    void    RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc);
+    void    ResetMulticastForwardingCacheTable(void);
+    MulticastForwardingCache *FindMulticastForwardingCache(const Ip6::Address &aSrcAddr,
+                                                           const Ip6::Address &aGroupAddr);
+    void                      LinkMulticastForwardingCache(uint16_t aIndex);
+    void                      UnlinkMulticastForwardingCache(uint16_t aIndex);
+    void                      AppendToLru(uint16_t aIndex);
+    void                      RemoveFromLru(uint16_t aIndex);
+    void                      MoveToLruTail(MulticastForwardingCache &aMfc);
+    uint16_t                  IndexOf(const MulticastForwardingCache &aMfc) const;
+    void                      LogCounters(uint64_t aNow) const;
+    static uint16_t           HashSourceGroup(const Ip6::Address &aSrcAddr, const Ip6::Address &aGroupAddr);
+    static uint16_t           HashGroup(const Ip6::Address &aGroupAddr);
     static const char *MifIndexToString(MifIndex aMif);
     void               DumpMulticastForwardingCache(void) const;
     static void        HandleBackboneMulticastListenerEvent(void                                  *aContext,
@@ -145,6 +174,13 @@ private:
                                                             const Ip6::Address                    &aAddress);
 
     MulticastForwardingCache mMulticastForwardingCacheTable[kMulticastForwardingCacheTableSize];
+    uint16_t                 mSourceGroupBuckets[kNumBuckets];
+    uint16_t                 mGroupBuckets[kNumBuckets];
+    uint16_t                 mLruHead; // Least recently used entry.
+    uint16_t                 mLruTail; // Most recently used entry.
+    uint16_t                 mFreeHead;
+    Counters                 mCounters;
+    Counters                 mLastLoggedCounters;
     uint64_t                 mLastExpireTime;
     int                      mMulticastRouterSock;
     State                    mState;
@@ -122,6 +122,27 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE 1
 #endif
 
+#ifndef OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE
+#define OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE 1
+#endif
+
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE 4
+#endif
+
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_INDEXED_PENDING_REQUESTS 32
+#endif
+
+/**
+ * Define to 1 to enable settings write-behind.
+ *
+ * The posix settings file is rewritten on every save, so bursts of saves are coalesced.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE 1
+#endif
+
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (63 * 1024)
 #endif
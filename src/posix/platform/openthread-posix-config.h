@@ -252,7 +252,8 @@
  *
  * Define as 1 to enable firewall.
  *
- * The rules are implemented using ip6tables and ipset. The rules are as follows.
+ * The rules are implemented using ip6tables and ipset. The content of the ipsets is updated over netlink on network
+ * data changes. The rules are as follows.
  *
  * ip6tables -A $OTBR_FORWARD_INGRESS_CHAIN -m pkttype --pkt-type unicast -i $THREAD_IF -p ip -j DROP
  * ip6tables -A $OTBR_FORWARD_INGRESS_CHAIN -m set --match-set otbr-ingress-deny-src src -p ip -j DROP
@@ -264,6 +265,13 @@
 #define OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_IPSET_BINARY
+ *
+ * The path of the `ipset` binary.
+ *
+ * @note This configuration is deprecated and ignored. The content of the firewall ipsets is updated over netlink.
+ */
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
 #ifndef OPENTHREAD_POSIX_CONFIG_IPSET_BINARY
 #define OPENTHREAD_POSIX_CONFIG_IPSET_BINARY "ipset"
@@ -456,6 +464,18 @@
 #define OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_HISTORY_FILE_DEPTH
+ *
+ * Specifies the number of History Tracker entries kept in the memory-mapped history file.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE` is enabled. The history file is a
+ * single ring shared by all History Tracker lists, so once full the oldest entry (from any list) is overwritten.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_HISTORY_FILE_DEPTH
+#define OPENTHREAD_POSIX_CONFIG_HISTORY_FILE_DEPTH 8192
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_RESOLV_CONF_ENABLED_INIT
  *
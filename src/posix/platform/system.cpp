@@ -54,6 +54,7 @@
 #include "common/debug.hpp"
 #include "posix/platform/daemon.hpp"
 #include "posix/platform/firewall.hpp"
+#include "posix/platform/history_file.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
 #include "posix/platform/mdns_socket.hpp"
@@ -266,6 +267,10 @@ void platformSetUp(otPlatformConfig *aPlatformConfig)
     ot::Posix::Daemon::Get().SetUp();
 #endif
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    ot::Posix::HistoryFile::Get().Init(aPlatformConfig->mDataPath);
+#endif
+
     SuccessOrDie(otSetStateChangedCallback(gInstance, processStateChange, gInstance));
 
 exit:
@@ -312,6 +317,10 @@ void platformTearDown(void)
 {
     VerifyOrExit(!gDryRun);
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE && OPENTHREAD_CONFIG_HISTORY_TRACKER_PLATFORM_STORE_ENABLE
+    ot::Posix::HistoryFile::Get().Close();
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     ot::Posix::Daemon::Get().TearDown();
 #endif
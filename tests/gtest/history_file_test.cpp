@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <openthread/history_tracker.h>
+
+#include "posix/platform/history_file.hpp"
+
+using namespace ot::Posix;
+
+namespace {
+
+class HistoryFileTest : public ::testing::Test
+{
+protected:
+    static constexpr uint32_t kDepth = 4;
+
+    void SetUp(void) override
+    {
+        char path[] = "/tmp/ot-history-XXXXXX";
+        int  fd     = mkstemp(path);
+
+        ASSERT_NE(-1, fd);
+        close(fd);
+        mPath = path;
+
+        ASSERT_EQ(OT_ERROR_NONE, mFile.Open(mPath.c_str(), kDepth));
+        otSysHistoryInitCursor(&mCursor);
+    }
+
+    void TearDown(void) override
+    {
+        mFile.Close();
+        unlink(mPath.c_str());
+    }
+
+    void SaveNetInfo(uint16_t aRloc16, uint32_t aAge = 0)
+    {
+        otHistoryTrackerNetworkInfo info;
+
+        memset(&info, 0, sizeof(info));
+        info.mRloc16 = aRloc16;
+        mFile.Save(OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO, aAge, &info, sizeof(info));
+    }
+
+    static uint64_t GetNowUsec(void)
+    {
+        struct timespec now;
+
+        clock_gettime(CLOCK_REALTIME, &now);
+
+        return static_cast<uint64_t>(now.tv_sec) * 1000000u + static_cast<uint64_t>(now.tv_nsec) / 1000u;
+    }
+
+    // Reads the next record and returns its `mRloc16`, or zero if
+    // there is no new record.
+    uint16_t ReadNetInfo(uint64_t &aNumSkipped)
+    {
+        otSysHistoryRecord          record;
+        otHistoryTrackerNetworkInfo info;
+
+        if (mFile.ReadNext(mCursor, record, aNumSkipped) != OT_ERROR_NONE)
+        {
+            return 0;
+        }
+
+        EXPECT_EQ(OT_PLAT_HISTORY_TRACKER_LIST_NET_INFO, record.mList);
+        EXPECT_EQ(sizeof(info), record.mLength);
+        EXPECT_EQ(mCursor.mNextSeq - 1, record.mSeq);
+        EXPECT_NE(0u, record.mTimestamp);
+        memcpy(&info, record.mEntry, sizeof(info));
+
+        return info.mRloc16;
+    }
+
+    std::string        mPath;
+    HistoryFile        mFile;
+    otSysHistoryCursor mCursor;
+};
+
+TEST_F(HistoryFileTest, StreamsNewEntries)
+{
+    otSysHistoryRecord record;
+    uint64_t           numSkipped;
+
+    EXPECT_EQ(OT_ERROR_NOT_FOUND, mFile.ReadNext(mCursor, record, numSkipped));
+
+    SaveNetInfo(0x1000);
+    SaveNetInfo(0x1001);
+
+    EXPECT_EQ(0x1000, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0x1001, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0u, numSkipped);
+    EXPECT_EQ(OT_ERROR_NOT_FOUND, mFile.ReadNext(mCursor, record, numSkipped));
+
+    SaveNetInfo(0x1002);
+
+    EXPECT_EQ(0x1002, ReadNetInfo(numSkipped));
+    EXPECT_EQ(4u, mCursor.mNextSeq);
+}
+
+TEST_F(HistoryFileTest, TimestampsEntriesWhenRecorded)
+{
+    static constexpr uint32_t kAge = 5000; // msec
+
+    otSysHistoryRecord record;
+    uint64_t           numSkipped;
+    uint64_t           before;
+    uint64_t           after;
+
+    before = GetNowUsec();
+    SaveNetInfo(0x6000, kAge);
+    after = GetNowUsec();
+
+    ASSERT_EQ(OT_ERROR_NONE, mFile.ReadNext(mCursor, record, numSkipped));
+    EXPECT_GE(record.mTimestamp, before - kAge * 1000u);
+    EXPECT_LE(record.mTimestamp, after - kAge * 1000u);
+}
+
+TEST_F(HistoryFileTest, ReportsOverwrittenEntries)
+{
+    uint64_t numSkipped;
+
+    SaveNetInfo(0x2000);
+    EXPECT_EQ(0x2000, ReadNetInfo(numSkipped));
+
+    for (uint16_t i = 1; i <= 6; i++)
+    {
+        SaveNetInfo(0x2000 + i);
+    }
+
+    // Depth is 4, so entries 1 and 2 were overwritten.
+
+    EXPECT_EQ(0x2003, ReadNetInfo(numSkipped));
+    EXPECT_EQ(2u, numSkipped);
+    EXPECT_EQ(0x2004, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0u, numSkipped);
+    EXPECT_EQ(0x2005, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0x2006, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0, ReadNetInfo(numSkipped));
+}
+
+TEST_F(HistoryFileTest, KeepsEntriesAcrossReopen)
+{
+    uint64_t numSkipped;
+
+    SaveNetInfo(0x3000);
+    SaveNetInfo(0x3001);
+    EXPECT_EQ(0x3000, ReadNetInfo(numSkipped));
+
+    mFile.Close();
+    EXPECT_FALSE(mFile.IsOpen());
+    ASSERT_EQ(OT_ERROR_NONE, mFile.Open(mPath.c_str(), kDepth));
+
+    // The saved cursor continues after a restart and new entries
+    // keep increasing sequence numbers.
+
+    SaveNetInfo(0x3002);
+    EXPECT_EQ(0x3001, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0x3002, ReadNetInfo(numSkipped));
+    EXPECT_EQ(4u, mCursor.mNextSeq);
+}
+
+TEST_F(HistoryFileTest, ResetsOnDepthChange)
+{
+    uint64_t numSkipped;
+
+    SaveNetInfo(0x4000);
+    SaveNetInfo(0x4001);
+    EXPECT_EQ(0x4000, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0x4001, ReadNetInfo(numSkipped));
+
+    ASSERT_EQ(OT_ERROR_NONE, mFile.Open(mPath.c_str(), kDepth * 2));
+    EXPECT_EQ(0, ReadNetInfo(numSkipped));
+
+    // A cursor from before the reset restarts from the oldest entry.
+
+    SaveNetInfo(0x4002);
+    EXPECT_EQ(0x4002, ReadNetInfo(numSkipped));
+    EXPECT_EQ(0u, numSkipped);
+}
+
+TEST_F(HistoryFileTest, RejectsReadWhenClosed)
+{
+    otSysHistoryRecord record;
+    uint64_t           numSkipped;
+
+    mFile.Close();
+    SaveNetInfo(0x5000);
+    EXPECT_EQ(OT_ERROR_INVALID_STATE, mFile.ReadNext(mCursor, record, numSkipped));
+    EXPECT_EQ(OT_ERROR_INVALID_ARGS, mFile.Open(mPath.c_str(), 0));
+}
+
+} // namespace
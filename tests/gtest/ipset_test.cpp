@@ -0,0 +1,475 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include <linux/netfilter/ipset/ip_set.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include "posix/platform/ipset.hpp"
+
+using namespace ot::Posix;
+using ::testing::ElementsAre;
+
+namespace {
+
+struct Command
+{
+    uint8_t     mCommand;
+    std::string mSetName;
+    std::string mSetName2;
+    std::string mPrefix;
+
+    bool operator==(const Command &aOther) const
+    {
+        return mCommand == aOther.mCommand && mSetName == aOther.mSetName && mSetName2 == aOther.mSetName2 &&
+               mPrefix == aOther.mPrefix;
+    }
+};
+
+void PrintTo(const Command &aCommand, std::ostream *aOs)
+{
+    *aOs << "{cmd:" << static_cast<int>(aCommand.mCommand) << ", set:" << aCommand.mSetName
+         << ", set2:" << aCommand.mSetName2 << ", prefix:" << aCommand.mPrefix << "}";
+}
+
+Command Flush(const char *aSetName) { return Command{IPSET_CMD_FLUSH, aSetName, "", ""}; }
+Command Swap(const char *aSetName1, const char *aSetName2) { return Command{IPSET_CMD_SWAP, aSetName1, aSetName2, ""}; }
+Command Add(const char *aSetName, const char *aPrefix) { return Command{IPSET_CMD_ADD, aSetName, "", aPrefix}; }
+Command Del(const char *aSetName, const char *aPrefix) { return Command{IPSET_CMD_DEL, aSetName, "", aPrefix}; }
+
+otIp6Prefix MakePrefix(const char *aString)
+{
+    otIp6Prefix prefix;
+
+    EXPECT_EQ(OT_ERROR_NONE, otIp6PrefixFromString(aString, &prefix));
+
+    return prefix;
+}
+
+std::string PrefixToString(const uint8_t *aAddress, uint8_t aLength)
+{
+    otIp6Prefix prefix;
+    char        string[OT_IP6_PREFIX_STRING_SIZE];
+
+    memset(&prefix, 0, sizeof(prefix));
+    memcpy(prefix.mPrefix.mFields.m8, aAddress, sizeof(prefix.mPrefix.mFields.m8));
+    prefix.mLength = aLength;
+    otIp6PrefixToString(&prefix, string, sizeof(string));
+
+    return string;
+}
+
+/**
+ * Emulates the kernel side of a `NETLINK_NETFILTER` socket for ipset commands.
+ */
+class FakeIpSetKernel
+{
+public:
+    FakeIpSetKernel(void)
+    {
+        int fds[2];
+
+        EXPECT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds));
+        mClientFd = fds[0];
+        mKernelFd = fds[1];
+    }
+
+    ~FakeIpSetKernel(void)
+    {
+        close(mClientFd);
+        close(mKernelFd);
+    }
+
+    int GetClientFd(void) const { return mClientFd; }
+
+    // Fails the command at `aIndex` in the next update with `aError` (an errno value).
+    void FailCommand(size_t aIndex, int aError)
+    {
+        mCommandIndex = 0;
+        mFailIndex    = aIndex;
+        mFailError    = aError;
+    }
+
+    bool HasPendingBatch(void) const
+    {
+        uint8_t byte;
+
+        return recv(mKernelFd, &byte, sizeof(byte), MSG_DONTWAIT | MSG_PEEK) > 0;
+    }
+
+    // Receives all pending batches, records their commands in `mCommands` and acknowledges each message.
+    void HandleBatches(void)
+    {
+        mCommands.clear();
+
+        while (HasPendingBatch())
+        {
+            HandleBatch();
+        }
+    }
+
+    std::vector<Command> mCommands;
+    size_t               mNumBatches = 0;
+
+private:
+    void HandleBatch(void)
+    {
+        uint8_t buffer[65536];
+        ssize_t length = recv(mKernelFd, buffer, sizeof(buffer), 0);
+        int     remaining;
+
+        mNumBatches++;
+        ASSERT_GT(length, 0);
+
+        remaining = static_cast<int>(length);
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, remaining);
+             header = NLMSG_NEXT(header, remaining))
+        {
+            int error = 0;
+
+            ASSERT_EQ(NFNL_SUBSYS_IPSET, header->nlmsg_type >> 8);
+            ASSERT_NE(0, header->nlmsg_flags & NLM_F_ACK);
+
+            mCommands.push_back(ParseCommand(header));
+
+            if (mCommandIndex++ == mFailIndex)
+            {
+                error      = -mFailError;
+                mFailIndex = SIZE_MAX;
+            }
+
+            SendAck(*header, error);
+        }
+    }
+
+    static Command ParseCommand(const nlmsghdr *aHeader)
+    {
+        Command         command;
+        const nfgenmsg *genMsg = static_cast<const nfgenmsg *>(NLMSG_DATA(aHeader));
+        const uint8_t  *start  = reinterpret_cast<const uint8_t *>(genMsg) + NLMSG_ALIGN(sizeof(nfgenmsg));
+        const uint8_t  *end    = reinterpret_cast<const uint8_t *>(aHeader) + aHeader->nlmsg_len;
+
+        command.mCommand = aHeader->nlmsg_type & 0xff;
+        EXPECT_EQ(AF_INET6, genMsg->nfgen_family);
+
+        for (const uint8_t *cur = start; cur < end;)
+        {
+            const nlattr  *attr  = reinterpret_cast<const nlattr *>(cur);
+            const uint8_t *value = cur + NLA_HDRLEN;
+
+            switch (attr->nla_type & NLA_TYPE_MASK)
+            {
+            case IPSET_ATTR_PROTOCOL:
+                EXPECT_EQ(IPSET_PROTOCOL, value[0]);
+                break;
+            case IPSET_ATTR_SETNAME:
+                command.mSetName = reinterpret_cast<const char *>(value);
+                break;
+            case IPSET_ATTR_SETNAME2:
+                command.mSetName2 = reinterpret_cast<const char *>(value);
+                break;
+            case IPSET_ATTR_DATA:
+                EXPECT_NE(0, attr->nla_type & NLA_F_NESTED);
+                command.mPrefix = ParseData(value, cur + attr->nla_len);
+                break;
+            default:
+                ADD_FAILURE() << "unexpected attribute " << attr->nla_type;
+                break;
+            }
+
+            cur += NLA_ALIGN(attr->nla_len);
+        }
+
+        return command;
+    }
+
+    static std::string ParseData(const uint8_t *aStart, const uint8_t *aEnd)
+    {
+        const uint8_t *address = nullptr;
+        uint8_t        cidr    = 0;
+
+        for (const uint8_t *cur = aStart; cur < aEnd;)
+        {
+            const nlattr *attr = reinterpret_cast<const nlattr *>(cur);
+
+            switch (attr->nla_type & NLA_TYPE_MASK)
+            {
+            case IPSET_ATTR_IP:
+            {
+                const nlattr *ipAttr = reinterpret_cast<const nlattr *>(cur + NLA_HDRLEN);
+
+                EXPECT_NE(0, attr->nla_type & NLA_F_NESTED);
+                EXPECT_EQ(IPSET_ATTR_IPADDR_IPV6 | NLA_F_NET_BYTEORDER, ipAttr->nla_type);
+                EXPECT_EQ(NLA_HDRLEN + sizeof(otIp6Address), ipAttr->nla_len);
+                address = reinterpret_cast<const uint8_t *>(ipAttr) + NLA_HDRLEN;
+                break;
+            }
+            case IPSET_ATTR_CIDR:
+                cidr = cur[NLA_HDRLEN];
+                break;
+            default:
+                ADD_FAILURE() << "unexpected data attribute " << attr->nla_type;
+                break;
+            }
+
+            cur += NLA_ALIGN(attr->nla_len);
+        }
+
+        EXPECT_NE(nullptr, address);
+
+        return (address != nullptr) ? PrefixToString(address, cidr) : "";
+    }
+
+    void SendAck(const nlmsghdr &aRequest, int aError)
+    {
+        uint8_t   buffer[NLMSG_SPACE(sizeof(nlmsgerr))];
+        nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer);
+        nlmsgerr *ack    = static_cast<nlmsgerr *>(NLMSG_DATA(header));
+
+        memset(buffer, 0, sizeof(buffer));
+        header->nlmsg_len  = NLMSG_LENGTH(sizeof(nlmsgerr));
+        header->nlmsg_type = NLMSG_ERROR;
+        header->nlmsg_seq  = aRequest.nlmsg_seq;
+        ack->error         = aError;
+        ack->msg           = aRequest;
+
+        ASSERT_EQ(static_cast<ssize_t>(header->nlmsg_len), send(mKernelFd, buffer, header->nlmsg_len, 0));
+    }
+
+    int    mClientFd;
+    int    mKernelFd;
+    size_t mCommandIndex = 0;
+    size_t mFailIndex    = SIZE_MAX;
+    int    mFailError    = 0;
+};
+
+class IpSetManagerTest : public ::testing::Test
+{
+protected:
+    enum : uint8_t
+    {
+        kDenySrc,
+        kAllowDst,
+        kNumIpSets,
+    };
+
+    void SetUp() override { mManager.SetSocket(mKernel.GetClientFd()); }
+
+    // Runs one mainloop iteration of `mManager` without blocking.
+    void RunMainloop(void)
+    {
+        ot::Posix::Mainloop::Context context;
+
+        memset(&context, 0, sizeof(context));
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+        context.mMaxFd = -1;
+
+        mManager.Update(context);
+        ASSERT_LE(0, select(context.mMaxFd + 1, &context.mReadFdSet, nullptr, nullptr, &context.mTimeout));
+        mManager.Process(context);
+    }
+
+    otError UpdateAndHandleBatches(void)
+    {
+        otError error = mManager.RequestUpdate(mPrefixes);
+
+        mKernel.HandleBatches();
+        RunMainloop();
+
+        return error;
+    }
+
+    FakeIpSetKernel         mKernel;
+    IpSetManager::PrefixSet mPrefixes[kNumIpSets];
+    IpSetManager::IpSet     mIpSets[kNumIpSets] = {
+        {"deny-src", "deny-src-swap", IpSetManager::PrefixSet(), IpSetManager::PrefixSet(), false},
+        {"allow-dst", "allow-dst-swap", IpSetManager::PrefixSet(), IpSetManager::PrefixSet(), false},
+    };
+    IpSetManager mManager{mIpSets, kNumIpSets};
+};
+
+} // namespace
+
+TEST_F(IpSetManagerTest, FirstUpdateRebuildsAndSwapsInOneBatch)
+{
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fdde:ad00:beef::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kAllowDst].Add(MakePrefix("fd00:1::/64")));
+
+    EXPECT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    EXPECT_EQ(1u, mKernel.mNumBatches);
+    EXPECT_THAT(mKernel.mCommands,
+                ElementsAre(Flush("deny-src-swap"), Add("deny-src-swap", "fd00:1:0:0::/64"),
+                            Add("deny-src-swap", "fdde:ad00:beef:0::/64"), Swap("deny-src-swap", "deny-src"),
+                            Flush("allow-dst-swap"), Add("allow-dst-swap", "fd00:1:0:0::/64"),
+                            Swap("allow-dst-swap", "allow-dst")));
+    EXPECT_TRUE(mIpSets[kDenySrc].mIsSynced);
+    EXPECT_TRUE(mIpSets[kAllowDst].mIsSynced);
+}
+
+TEST_F(IpSetManagerTest, LaterUpdatesOnlyApplyTheDiff)
+{
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:2::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kAllowDst].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    mPrefixes[kDenySrc].Clear();
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:2::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:3::/64")));
+
+    EXPECT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    EXPECT_EQ(2u, mKernel.mNumBatches);
+    EXPECT_THAT(mKernel.mCommands,
+                ElementsAre(Del("deny-src", "fd00:1:0:0::/64"), Add("deny-src", "fd00:3:0:0::/64")));
+}
+
+TEST_F(IpSetManagerTest, UnchangedPrefixesSendNothing)
+{
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    EXPECT_EQ(OT_ERROR_NONE, mManager.RequestUpdate(mPrefixes));
+
+    EXPECT_FALSE(mManager.IsUpdateInProgress());
+    EXPECT_FALSE(mKernel.HasPendingBatch());
+    EXPECT_EQ(1u, mKernel.mNumBatches);
+}
+
+TEST_F(IpSetManagerTest, FailureForcesFullRebuild)
+{
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:2::/64")));
+    mKernel.FailCommand(0, ENOENT);
+
+    EXPECT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+    EXPECT_FALSE(mManager.IsUpdateInProgress());
+    EXPECT_FALSE(mIpSets[kDenySrc].mIsSynced);
+
+    EXPECT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+    EXPECT_THAT(mKernel.mCommands,
+                ElementsAre(Flush("deny-src-swap"), Add("deny-src-swap", "fd00:1:0:0::/64"),
+                            Add("deny-src-swap", "fd00:2:0:0::/64"), Swap("deny-src-swap", "deny-src"),
+                            Flush("allow-dst-swap"), Swap("allow-dst-swap", "allow-dst")));
+}
+
+TEST_F(IpSetManagerTest, DoesNotBlockWaitingForAcksAndQueuesTheLatestRequest)
+{
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:1::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mManager.RequestUpdate(mPrefixes));
+    EXPECT_TRUE(mManager.IsUpdateInProgress());
+
+    // No ack is queued yet, so the mainloop returns right away.
+    RunMainloop();
+    EXPECT_TRUE(mManager.IsUpdateInProgress());
+
+    // Requests made while waiting are coalesced and sent afterwards.
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:2::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mManager.RequestUpdate(mPrefixes));
+    ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(MakePrefix("fd00:3::/64")));
+    ASSERT_EQ(OT_ERROR_NONE, mManager.RequestUpdate(mPrefixes));
+
+    mKernel.HandleBatches();
+    EXPECT_EQ(1u, mKernel.mNumBatches);
+    EXPECT_THAT(mKernel.mCommands,
+                ElementsAre(Flush("deny-src-swap"), Add("deny-src-swap", "fd00:1:0:0::/64"),
+                            Swap("deny-src-swap", "deny-src"), Flush("allow-dst-swap"),
+                            Swap("allow-dst-swap", "allow-dst")));
+
+    RunMainloop();
+    EXPECT_TRUE(mManager.IsUpdateInProgress());
+
+    mKernel.HandleBatches();
+    EXPECT_EQ(2u, mKernel.mNumBatches);
+    EXPECT_THAT(mKernel.mCommands,
+                ElementsAre(Add("deny-src", "fd00:2:0:0::/64"), Add("deny-src", "fd00:3:0:0::/64")));
+
+    RunMainloop();
+    EXPECT_FALSE(mManager.IsUpdateInProgress());
+    EXPECT_TRUE(mIpSets[kDenySrc].mIsSynced);
+}
+
+TEST_F(IpSetManagerTest, LargeUpdatesAreSplitAcrossBatches)
+{
+    otIp6Prefix prefix = MakePrefix("fd00::/64");
+
+    for (uint8_t i = 0; i < IpSetManager::kMaxPrefixes; i++)
+    {
+        prefix.mPrefix.mFields.m8[1] = i;
+        ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kDenySrc].Add(prefix));
+        ASSERT_EQ(OT_ERROR_NONE, mPrefixes[kAllowDst].Add(prefix));
+    }
+
+    EXPECT_EQ(OT_ERROR_NONE, UpdateAndHandleBatches());
+
+    EXPECT_LT(1u, mKernel.mNumBatches);
+    ASSERT_EQ(2u * (IpSetManager::kMaxPrefixes + 2), mKernel.mCommands.size());
+    EXPECT_EQ(Swap("deny-src-swap", "deny-src"), mKernel.mCommands[IpSetManager::kMaxPrefixes + 1]);
+    EXPECT_EQ(Swap("allow-dst-swap", "allow-dst"), mKernel.mCommands.back());
+    EXPECT_FALSE(mManager.IsUpdateInProgress());
+    EXPECT_TRUE(mIpSets[kDenySrc].mIsSynced);
+    EXPECT_TRUE(mIpSets[kAllowDst].mIsSynced);
+}
+
+TEST_F(IpSetManagerTest, PrefixSetIgnoresDuplicatesAndRejectsOverflow)
+{
+    IpSetManager::PrefixSet prefixes;
+    otIp6Prefix             prefix = MakePrefix("fd00::/64");
+
+    EXPECT_EQ(OT_ERROR_NONE, prefixes.Add(prefix));
+    EXPECT_EQ(OT_ERROR_NONE, prefixes.Add(prefix));
+    EXPECT_EQ(1, prefixes.GetNumPrefixes());
+
+    for (uint8_t i = 1; i < IpSetManager::kMaxPrefixes; i++)
+    {
+        prefix.mPrefix.mFields.m8[1] = i;
+        EXPECT_EQ(OT_ERROR_NONE, prefixes.Add(prefix));
+    }
+
+    prefix.mPrefix.mFields.m8[2] = 1;
+    EXPECT_EQ(OT_ERROR_NO_BUFS, prefixes.Add(prefix));
+}
@@ -58,7 +58,9 @@
 #define OPENTHREAD_CONFIG_BORDER_ROUTING_TESTING_API_ENABLE 1
 #define OPENTHREAD_CONFIG_BORDER_ROUTING_USE_HEAP_ENABLE 1
 #define OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE 1
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS 1
 #define OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE 1
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE 1
 #define OPENTHREAD_CONFIG_CLI_PROMPT_ENABLE 1
 #define OPENTHREAD_CONFIG_COAP_API_ENABLE 1
 #define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 1
@@ -81,6 +83,7 @@
 #define OPENTHREAD_CONFIG_ECDSA_ENABLE 1
 #define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE 1
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_FLOW_LIST_SIZE 32
 #define OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE 1
 #define OPENTHREAD_CONFIG_IP6_MAX_EXT_MCAST_ADDRS 80
 #define OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS 80
@@ -145,6 +148,7 @@
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 1
 #define OPENTHREAD_CONFIG_RADIO_STATS_ENABLE 0
 #define OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE 1
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE 4
 #define OPENTHREAD_CONFIG_SEEKER_ENABLE 1
 #define OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_DEFAULT_MODE 0
 #define OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE 1
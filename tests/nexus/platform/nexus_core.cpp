@@ -49,6 +49,8 @@ Core::Core(void)
     , mPendingAction(false)
     , mSaveNodeLogs(false)
     , mNow(0)
+    , mFrameErrorRate(0)
+    , mFrameErrorSeed(1)
 {
     const char *pcapFile;
     const char *saveLogs;
@@ -59,6 +61,11 @@ Core::Core(void)
 
     mNextAlarmTime = NumericLimits<uint64_t>::kMax;
 
+    for (int8_t &noise : mChannelNoise)
+    {
+        noise = Radio::kRadioSensitivity;
+    }
+
     pcapFile = getenv("OT_NEXUS_PCAP_FILE");
 
     if ((pcapFile != nullptr) && (pcapFile[0] != '\0'))
@@ -720,6 +727,38 @@ void Core::Process(Node &aNode)
     }
 }
 
+void Core::SetFrameErrorRate(uint8_t aPercent) { mFrameErrorRate = Min<uint8_t>(aPercent, 100); }
+
+void Core::SetChannelNoise(uint8_t aChannel, int8_t aRssi)
+{
+    VerifyOrQuit(aChannel <= ot::Radio::kChannelMax);
+    mChannelNoise[aChannel] = aRssi;
+}
+
+int8_t Core::GetChannelNoise(uint8_t aChannel) const
+{
+    return (aChannel <= ot::Radio::kChannelMax) ? mChannelNoise[aChannel] : Radio::kRadioSensitivity;
+}
+
+bool Core::ShouldDropFrame(void)
+{
+    // Random frame loss on top of the radio model, drawn from a fixed-seed
+    // xorshift sequence so that lossy runs are reproducible.
+
+    bool drop = false;
+
+    VerifyOrExit(mFrameErrorRate != 0);
+
+    mFrameErrorSeed ^= mFrameErrorSeed << 13;
+    mFrameErrorSeed ^= mFrameErrorSeed >> 17;
+    mFrameErrorSeed ^= mFrameErrorSeed << 5;
+
+    drop = (mFrameErrorSeed % 100) < mFrameErrorRate;
+
+exit:
+    return drop;
+}
+
 void Core::ProcessRadio(Node &aNode)
 {
     Mac::Address dstAddr;
@@ -805,7 +844,7 @@ void Core::ProcessRadio(Node &aNode)
             int16_t localRssi = RadioModel::CalculateRssi(aNode, rxNode);
 
             // Completely intercept and drop packets that dip below target receiver sensitivity
-            if (RadioModel::ShouldDropPacket(localRssi))
+            if (RadioModel::ShouldDropPacket(localRssi) || ShouldDropFrame())
             {
                 continue;
             }
@@ -901,7 +940,7 @@ void Core::ProcessRadio(Node &aNode)
 
             mPcap.WriteFrame(ackFrame, mNow);
 
-            if (RadioModel::ShouldDropPacket(ackRssi))
+            if (RadioModel::ShouldDropPacket(ackRssi) || ShouldDropFrame())
             {
                 otPlatRadioTxDone(&aNode.GetInstance(), &aNode.mRadio.mTxFrame, nullptr, kErrorNoAck);
             }
@@ -85,6 +85,11 @@ public:
     void AddTestVar(const char *aName, const char *aValue);
     void AddTestVar(const char *aName, uint32_t aValue);
     void AddOmrPrefixTestVar(const char *aName, Node &aNode);
+    void SetFrameErrorRate(uint8_t aPercent);
+    void SetChannelNoise(uint8_t aChannel, int8_t aRssi);
+
+    int8_t GetChannelNoise(uint8_t aChannel) const;
+
     void SendAndVerifyEchoRequest(Node               &aSender,
                                   const Ip6::Address &aDestination,
                                   uint16_t            aPayloadSize     = 0,
@@ -159,6 +164,7 @@ private:
 
     void Process(Node &aNode);
     void ProcessRadio(Node &aNode);
+    bool ShouldDropFrame(void);
     void ProcessInfraIf(Node &aNode);
 
     static void HandleIcmpResponse(void                *aContext,
@@ -178,6 +184,9 @@ private:
     bool                  mSaveNodeLogs;
     uint64_t              mNow;
     uint64_t              mNextAlarmTime;
+    uint8_t               mFrameErrorRate;
+    uint32_t              mFrameErrorSeed;
+    int8_t                mChannelNoise[ot::Radio::kChannelMax + 1];
 
     LinkedList<Observer> mObservers;
 };
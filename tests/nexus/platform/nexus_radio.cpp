@@ -165,8 +165,7 @@ otRadioTime64 otPlatRadioGetNow(otInstance *aInstance)
 
 int8_t otPlatRadioGetRssi(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-    return Radio::kRadioSensitivity;
+    return Core::Get().GetChannelNoise(AsNode(aInstance).mRadio.mChannel);
 }
 
 void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+
+typedef Utils::ChannelMonitor::ChannelStats ChannelStats;
+
+static constexpr int8_t   kBusyRssi           = -60; // Above the monitor RSSI threshold (-75 dBm).
+static constexpr int8_t   kBusyRssiBinEdge    = -56; // Upper edge of the RSSI histogram bin containing `kBusyRssi`.
+static constexpr int8_t   kQuietRssiBinEdge   = -96; // Upper edge of the first RSSI histogram bin.
+static constexpr uint8_t  kSteadyBusyChannel  = 12;  // Busy all the time.
+static constexpr uint8_t  kBurstyChannel      = 20;  // Quiet except for most of the second hour.
+static constexpr uint8_t  kEvenlyBusyChannel  = 21;  // Busy for a quarter of every minute.
+static constexpr uint32_t kOneMinute          = 60 * 1000;
+static constexpr uint32_t kOneHour            = 60 * kOneMinute;
+static constexpr uint32_t kTestDuration       = 7 * kOneHour + 30 * kOneMinute;
+static constexpr uint32_t kBurstStart         = kOneHour + 5 * kOneMinute;
+static constexpr uint32_t kBurstEnd           = 2 * kOneHour - 5 * kOneMinute;
+static constexpr uint16_t kMinBusyRatioP90    = 0xffff / 2;
+static constexpr uint16_t kMaxQuietBusyRatio  = 0xffff / 100;
+static constexpr uint16_t kMinSteadyBusyRatio = 0xffff - 0xffff / 100;
+
+void LogChannelStats(uint8_t aChannel, const ChannelStats &aStats)
+{
+    Log("ch %u: rssi median %d p90 %d, busy median 0x%04x p90 0x%04x, %u buckets", aChannel, aStats.mRssiMedian,
+        aStats.mRssiP90, aStats.mBusyRatioMedian, aStats.mBusyRatioP90, aStats.mNumTimeBuckets);
+}
+
+void TestChannelMonitorStats(void)
+{
+    Core             nexus;
+    Node            &leader = nexus.CreateNode();
+    uint8_t          panChannel;
+    ChannelStats     stats;
+    Mac::ChannelMask mask;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestChannelMonitorStats");
+
+    leader.Form();
+    nexus.AdvanceTime(50 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    panChannel = leader.Get<Mac::Mac>().GetPanChannel();
+    VerifyOrQuit(panChannel != kSteadyBusyChannel);
+    VerifyOrQuit(panChannel != kBurstyChannel);
+    VerifyOrQuit(panChannel != kEvenlyBusyChannel);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Collect samples with a per-channel noise pattern");
+
+    // Restart the monitor so that all samples follow the noise pattern.
+
+    SuccessOrQuit(leader.Get<Utils::ChannelMonitor>().Stop());
+    SuccessOrQuit(leader.Get<Utils::ChannelMonitor>().Start());
+
+    nexus.SetChannelNoise(panChannel, kBusyRssi);
+    nexus.SetChannelNoise(kSteadyBusyChannel, kBusyRssi);
+
+    for (uint32_t elapsed = 0; elapsed < kTestDuration; elapsed += kOneMinute)
+    {
+        bool isBurst = (elapsed >= kBurstStart) && (elapsed < kBurstEnd);
+
+        nexus.SetChannelNoise(kBurstyChannel, isBurst ? kBusyRssi : Radio::kRadioSensitivity);
+
+        nexus.SetChannelNoise(kEvenlyBusyChannel, kBusyRssi);
+        nexus.AdvanceTime(kOneMinute / 4);
+        nexus.SetChannelNoise(kEvenlyBusyChannel, Radio::kRadioSensitivity);
+        nexus.AdvanceTime(kOneMinute - kOneMinute / 4);
+    }
+
+    Log("Sample count %lu", ToUlong(leader.Get<Utils::ChannelMonitor>().GetSampleCount()));
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Verify the statistics of each channel");
+
+    VerifyOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelStats(0, stats) == kErrorInvalidArgs);
+
+    SuccessOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelStats(kSteadyBusyChannel, stats));
+    LogChannelStats(kSteadyBusyChannel, stats);
+    VerifyOrQuit(stats.mNumTimeBuckets == kTestDuration / kOneHour + 1);
+    VerifyOrQuit(stats.mRssiMedian == kBusyRssiBinEdge);
+    VerifyOrQuit(stats.mRssiP90 == kBusyRssiBinEdge);
+    VerifyOrQuit(stats.mBusyRatioMedian >= kMinSteadyBusyRatio);
+
+    SuccessOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelStats(kBurstyChannel, stats));
+    LogChannelStats(kBurstyChannel, stats);
+    VerifyOrQuit(stats.mRssiMedian == kQuietRssiBinEdge);
+    VerifyOrQuit(stats.mBusyRatioMedian <= kMaxQuietBusyRatio);
+    VerifyOrQuit(stats.mBusyRatioP90 >= kMinBusyRatioP90);
+    VerifyOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelOccupancy(kBurstyChannel) < kMinBusyRatioP90 / 2);
+
+    SuccessOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelStats(kEvenlyBusyChannel, stats));
+    LogChannelStats(kEvenlyBusyChannel, stats);
+    VerifyOrQuit(stats.mRssiMedian == kQuietRssiBinEdge);
+    VerifyOrQuit(stats.mRssiP90 == kBusyRssiBinEdge);
+    VerifyOrQuit(stats.mBusyRatioMedian > kMaxQuietBusyRatio);
+    VerifyOrQuit(stats.mBusyRatioP90 < kMinBusyRatioP90);
+
+    // The bursty channel has the lower average occupancy, but the
+    // evenly busy one has the lower retransmission cost.
+
+    VerifyOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelOccupancy(kBurstyChannel) <
+                 leader.Get<Utils::ChannelMonitor>().GetChannelOccupancy(kEvenlyBusyChannel));
+    VerifyOrQuit(leader.Get<Utils::ChannelMonitor>().GetChannelRetxCost(kBurstyChannel) >
+                 leader.Get<Utils::ChannelMonitor>().GetChannelRetxCost(kEvenlyBusyChannel));
+
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_USE_CHANNEL_STATS
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Verify Channel Manager selects the channel with the least retransmission cost");
+
+    mask.Clear();
+    mask.AddChannel(panChannel);
+    mask.AddChannel(kBurstyChannel);
+    mask.AddChannel(kEvenlyBusyChannel);
+
+    leader.Get<Utils::ChannelManager>().SetSupportedChannels(mask.GetMask());
+    leader.Get<Utils::ChannelManager>().SetFavoredChannels(mask.GetMask());
+
+    SuccessOrQuit(leader.Get<Utils::ChannelManager>().RequestNetworkChannelSelect(/* aSkipQualityCheck */ true));
+    VerifyOrQuit(leader.Get<Utils::ChannelManager>().GetRequestedChannel() == kEvenlyBusyChannel);
+#else
+    OT_UNUSED_VARIABLE(mask);
+#endif
+}
+
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE
+    ot::Nexus::TestChannelMonitorStats();
+    printf("All tests passed\n");
+#else
+    printf("OPENTHREAD_CONFIG_CHANNEL_MONITOR_STATS_ENABLE is not enabled, test is skipped\n");
+#endif
+    return 0;
+}
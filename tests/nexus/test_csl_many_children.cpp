@@ -0,0 +1,152 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "thread/child_table.hpp"
+#include "thread/csl_tx_scheduler.hpp"
+
+namespace ot {
+namespace Nexus {
+
+void TestCslManyChildren(void)
+{
+    static constexpr uint16_t kNumSseds      = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kJoinBatchSize = 16;
+    static constexpr uint16_t kNumRounds     = 5;
+
+    // All times in msec
+    static constexpr uint32_t kFormNetworkTime  = 13 * 1000;
+    static constexpr uint32_t kAttachAsSsedTime = 20 * 1000;
+    static constexpr uint32_t kCslSyncTime      = 5 * 1000;
+    static constexpr uint32_t kRoundTime        = 10 * 1000;
+    static constexpr uint32_t kCslPeriodMs      = 500;
+
+    static constexpr uint32_t kCslPeriod              = kCslPeriodMs * 1000 / OT_US_PER_TEN_SYMBOLS;
+    static constexpr uint16_t kEchoPayloadSize        = 10;
+    static constexpr uint32_t kMaxMissedWindowPercent = 20;
+
+    Core     nexus;
+    Node    *sseds[kNumSseds];
+    uint16_t numCslChildren;
+
+    Node &leader = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+
+    for (uint16_t i = 0; i < kNumSseds; i++)
+    {
+        sseds[i] = &nexus.CreateNode();
+        sseds[i]->SetName("SSED", i);
+    }
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network and attach %u SSEDs", kNumSseds);
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    for (uint16_t i = 0; i < kNumSseds; i++)
+    {
+        sseds[i]->Join(leader, Node::kAsSed);
+
+        if (((i + 1) % kJoinBatchSize) == 0)
+        {
+            nexus.AdvanceTime(kAttachAsSsedTime);
+        }
+    }
+
+    nexus.AdvanceTime(kAttachAsSsedTime);
+
+    for (Node *ssed : sseds)
+    {
+        VerifyOrQuit(ssed->Get<Mle::Mle>().IsChild());
+        ssed->Get<Mac::Mac>().SetCslPeriod(kCslPeriod);
+    }
+
+    nexus.AdvanceTime(kCslSyncTime);
+
+    numCslChildren = 0;
+
+    for (Child &child : leader.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        if (child.IsCslSynchronized())
+        {
+            numCslChildren++;
+        }
+    }
+
+    Log("CSL synchronized children: %u", numCslChildren);
+    VerifyOrQuit(numCslChildren == kNumSseds);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send echo requests to all SSEDs in %u rounds", kNumRounds);
+
+    leader.Get<CslTxScheduler>().ResetCounters();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (Node *ssed : sseds)
+        {
+            leader.SendEchoRequest(ssed->Get<Mle::Mle>().GetMeshLocalEid(), round, kEchoPayloadSize);
+        }
+
+        nexus.AdvanceTime(kRoundTime);
+
+        for (Child &child : leader.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            VerifyOrQuit(child.GetIndirectMessageCount() == 0);
+        }
+    }
+
+    {
+        const CslTxScheduler::Counters &counters = leader.Get<CslTxScheduler>().GetCounters();
+
+        Log("CSL tx windows: %lu, missed: %lu", ToUlong(counters.mTxWindows), ToUlong(counters.mMissedWindows));
+
+        VerifyOrQuit(counters.mTxWindows >= kNumSseds * kNumRounds);
+        VerifyOrQuit(counters.mMissedWindows * 100 <= counters.mTxWindows * kMaxMissedWindowPercent);
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestCslManyChildren();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -43,7 +43,8 @@ static constexpr uint16_t kUdpPort     = 1234;
 static constexpr uint16_t kMessageSize = 100;
 static constexpr uint16_t kMaxAttempts = 3;
 
-static const uint8_t kPsk[] = {0x10, 0x20, 0x03, 0x15, 0x10, 0x00, 0x60, 0x16};
+static const uint8_t kPsk[]  = {0x10, 0x20, 0x03, 0x15, 0x10, 0x00, 0x60, 0x16};
+static const uint8_t kPsk2[] = {0x21, 0x30, 0x14, 0x26, 0x21, 0x11, 0x71, 0x27};
 
 static Dtls::Session::ConnectEvent  sDtlsEvent[kMaxNodes];
 static Array<uint8_t, kMessageSize> sDtlsLastReceive[kMaxNodes];
@@ -135,6 +136,17 @@ OwnedPtr<Message> PrepareMessage(Node &aNode)
     return OwnedPtr<Message>(message);
 }
 
+void SendAndVerify(Core &aNexus, Node &aSender, Dtls::Session &aSession, Node &aReceiver)
+{
+    OwnedPtr<Message> msg(PrepareMessage(aSender));
+
+    SuccessOrQuit(aSession.Send(*msg->Clone<kNoReservedHeader>()));
+    aNexus.AdvanceTime(100);
+
+    VerifyOrQuit(sDtlsLastReceive[aReceiver.GetId()].GetLength() == msg->GetLength());
+    VerifyOrQuit(msg->CompareBytes(0, sDtlsLastReceive[aReceiver.GetId()].GetArrayBuffer(), msg->GetLength()));
+}
+
 class DtlsTransportAndSingleSession : public InstanceLocator, public Dtls::Transport, public Dtls::Session
 {
     // A DTLS transport and single session
@@ -183,6 +195,29 @@ public:
         SetRemoveSessionCallback(HandleRemoveSession, this);
     }
 
+    Error ConnectNewSession(const Ip6::SockAddr &aSockAddr)
+    {
+        // Connects a new heap allocated session as a client.
+
+        HeapDtlsSession *session = HeapDtlsSession::Allocate(*this);
+        Error            error;
+
+        VerifyOrQuit(session != nullptr);
+
+        session->SetReceiveCallback(&ot::Nexus::HandleReceive, &mNode);
+        session->SetConnectCallback(&ot::Nexus::HandleConnectEvent, &mNode);
+
+        error = session->Connect(aSockAddr);
+
+        if (error != kErrorNone)
+        {
+            session->Free();
+            sHeapSessionsAllocated--;
+        }
+
+        return error;
+    }
+
 private:
     class HeapDtlsSession : public Dtls::Session, public Heap::Allocatable<HeapDtlsSession>
     {
@@ -648,6 +683,287 @@ void TestDtlsMultiSession(void)
     }
 }
 
+void TestDtlsSessionResumption(void)
+{
+    Core  nexus;
+    Node &node0 = nexus.CreateNode();
+    Node &node1 = nexus.CreateNode();
+
+    Log("------------------------------------------------------------------------------------------------------");
+    Log("TestDtlsSessionResumption");
+
+    nexus.AdvanceTime(0);
+
+    // Form the topology: node0 leader, with node1 as its FTD child
+
+    node0.Form();
+    nexus.AdvanceTime(50 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node0.Get<Mle::Mle>().IsLeader());
+
+    node1.Join(node0, Node::kAsFed);
+    nexus.AdvanceTime(20 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node1.Get<Mle::Mle>().IsChild());
+
+    {
+        DtlsTransportAndHeapSession   dtls0(node0);
+        DtlsTransportAndSingleSession dtls1(node1);
+        Ip6::SockAddr                 sockAddr;
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Start DTLS (server) on node0 bound to port %u", kUdpPort);
+
+        SuccessOrQuit(dtls0.SetPsk(kPsk, sizeof(kPsk)));
+        SuccessOrQuit(dtls0.Open(kUdpPort));
+
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        sockAddr.SetAddress(node0.Get<Mle::Mle>().GetMeshLocalRloc());
+        sockAddr.SetPort(kUdpPort);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Establish a DTLS connection from node1 - validate a full handshake is done");
+
+        SuccessOrQuit(dtls1.SetPsk(kPsk, sizeof(kPsk)));
+        dtls1.SetReceiveCallback(HandleReceive, &node1);
+        dtls1.SetConnectCallback(HandleConnectEvent, &node1);
+        SuccessOrQuit(dtls1.Open(0));
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mFullHandshakes == 1);
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 0);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mFullHandshakes == 1);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mResumedHandshakes == 0);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Disconnect and reconnect from node1 - validate the session is resumed");
+
+        dtls1.Disconnect();
+        nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+        VerifyOrQuit(!dtls1.IsConnected());
+
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mFullHandshakes == 1);
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 1);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mFullHandshakes == 1);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mResumedHandshakes == 1);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Send message over the resumed session from node1 to node0");
+
+        for (uint16_t iter = 0; iter < 5; iter++)
+        {
+            OwnedPtr<Message> msg(PrepareMessage(node1));
+
+            SuccessOrQuit(dtls1.Send(*msg->Clone<kNoReservedHeader>()));
+            nexus.AdvanceTime(100);
+
+            VerifyOrQuit(sDtlsLastReceive[node0.GetId()].GetLength() == msg->GetLength());
+            VerifyOrQuit(msg->CompareBytes(0, sDtlsLastReceive[node0.GetId()].GetArrayBuffer(), msg->GetLength()));
+        }
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Change the PSK on node0 - validate node1 cannot resume its session using the old PSK");
+
+        dtls1.Disconnect();
+        nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+        SuccessOrQuit(dtls0.SetPsk(kPsk2, sizeof(kPsk2)));
+
+        memset(sDtlsEvent, Dtls::Session::kConnected, sizeof(sDtlsEvent));
+
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+        nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(!dtls1.IsConnected());
+        VerifyOrQuit(sDtlsEvent[node0.GetId()] == Dtls::Session::kDisconnectedError);
+        VerifyOrQuit(sDtlsEvent[node1.GetId()] == Dtls::Session::kDisconnectedError);
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 1);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Change the PSK on node1 - validate a new full handshake is done");
+
+        SuccessOrQuit(dtls1.SetPsk(kPsk2, sizeof(kPsk2)));
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mFullHandshakes == 2);
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 1);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mFullHandshakes == 2);
+        VerifyOrQuit(dtls1.GetHandshakeCounters().mResumedHandshakes == 1);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Set the same PSK again on node0 - validate the session is still resumed");
+
+        dtls1.Disconnect();
+        nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+        SuccessOrQuit(dtls0.SetPsk(kPsk2, sizeof(kPsk2)));
+
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mFullHandshakes == 2);
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 2);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Wait for the cached session to expire - validate a new full handshake is done");
+
+        dtls1.Disconnect();
+        nexus.AdvanceTime(Time::SecToMsec(OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_TIMEOUT));
+
+        SuccessOrQuit(dtls1.Connect(sockAddr));
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mFullHandshakes == 3);
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 2);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        dtls0.Close();
+        dtls1.Close();
+    }
+}
+
+void TestDtlsConfigRebuildWithActiveSession(void)
+{
+    Core  nexus;
+    Node &node0 = nexus.CreateNode();
+    Node &node1 = nexus.CreateNode();
+    Node &node2 = nexus.CreateNode();
+
+    Log("------------------------------------------------------------------------------------------------------");
+    Log("TestDtlsConfigRebuildWithActiveSession");
+
+    nexus.AdvanceTime(0);
+
+    // Form the topology: node0 leader, with node1 & node2 as its FTD children
+
+    node0.Form();
+    nexus.AdvanceTime(50 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node0.Get<Mle::Mle>().IsLeader());
+
+    node1.Join(node0, Node::kAsFed);
+    nexus.AdvanceTime(20 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node1.Get<Mle::Mle>().IsChild());
+
+    node2.Join(node0, Node::kAsFed);
+    nexus.AdvanceTime(20 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node2.Get<Mle::Mle>().IsChild());
+
+    {
+        DtlsTransportAndHeapSession   dtls0(node0);
+        DtlsTransportAndSingleSession dtls1(node1);
+        DtlsTransportAndSingleSession dtls2(node2);
+        Ip6::SockAddr                 sockAddr0;
+        Ip6::SockAddr                 sockAddr2;
+        uint16_t                      numSessions;
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Start DTLS (server) on node0 and node2 bound to port %u", kUdpPort);
+
+        SuccessOrQuit(dtls0.SetPsk(kPsk, sizeof(kPsk)));
+        SuccessOrQuit(dtls0.Open(kUdpPort));
+
+        SuccessOrQuit(dtls2.SetPsk(kPsk, sizeof(kPsk)));
+        dtls2.SetReceiveCallback(HandleReceive, &node2);
+        dtls2.SetConnectCallback(HandleConnectEvent, &node2);
+        SuccessOrQuit(dtls2.Open(kUdpPort));
+
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        sockAddr0.SetAddress(node0.Get<Mle::Mle>().GetMeshLocalRloc());
+        sockAddr0.SetPort(kUdpPort);
+        sockAddr2.SetAddress(node2.Get<Mle::Mle>().GetMeshLocalRloc());
+        sockAddr2.SetPort(kUdpPort);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Establish a DTLS connection with node0 (server) from node1");
+
+        SuccessOrQuit(dtls1.SetPsk(kPsk, sizeof(kPsk)));
+        dtls1.SetReceiveCallback(HandleReceive, &node1);
+        dtls1.SetConnectCallback(HandleConnectEvent, &node1);
+        SuccessOrQuit(dtls1.Open(0));
+        SuccessOrQuit(dtls1.Connect(sockAddr0));
+
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Establish a DTLS connection from node0 (client) to node2 while the session with node1 is active");
+
+        SuccessOrQuit(dtls0.ConnectNewSession(sockAddr2));
+
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+        VerifyOrQuit(dtls2.IsConnected());
+
+        numSessions = 0;
+
+        for (MeshCoP::SecureSession &session : dtls0.GetSessions())
+        {
+            VerifyOrQuit(session.IsConnected());
+            numSessions++;
+        }
+
+        VerifyOrQuit(numSessions == 2);
+        VerifyOrQuit(sHeapSessionsAllocated == 2);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Send messages from node1 and node2 to node0 over both sessions");
+
+        SendAndVerify(nexus, node1, dtls1, node0);
+        SendAndVerify(nexus, node2, dtls2, node0);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Reconnect from node1 while the session with node2 is active - validate the session is resumed");
+
+        dtls1.Disconnect();
+        nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(!dtls1.IsConnected());
+        VerifyOrQuit(dtls2.IsConnected());
+
+        SuccessOrQuit(dtls1.Connect(sockAddr0));
+        nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(dtls1.IsConnected());
+        VerifyOrQuit(dtls2.IsConnected());
+
+        VerifyOrQuit(dtls0.GetHandshakeCounters().mResumedHandshakes == 1);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Send messages again from node1 and node2 to node0 over both sessions");
+
+        SendAndVerify(nexus, node1, dtls1, node0);
+        SendAndVerify(nexus, node2, dtls2, node0);
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        dtls0.Close();
+        dtls1.Close();
+        dtls2.Close();
+
+        VerifyOrQuit(sHeapSessionsAllocated == 0);
+    }
+}
+
 } // namespace Nexus
 } // namespace ot
 
@@ -655,6 +971,8 @@ int main(void)
 {
     ot::Nexus::TestDtlsSingleSession();
     ot::Nexus::TestDtlsMultiSession();
+    ot::Nexus::TestDtlsSessionResumption();
+    ot::Nexus::TestDtlsConfigRebuildWithActiveSession();
     printf("All tests passed\n");
     return 0;
 }
@@ -231,6 +231,50 @@ void TestHistoryTracker(void)
         }
     }
     VerifyOrQuit(repliesFound == 3);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Verify the Echo Requests are aggregated into a single flow on leader and child");
+
+    const HistoryTracker::FlowInfo *flowInfo;
+    uint32_t                        expectedBytes = 0;
+
+    for (uint16_t size : kPingSizes)
+    {
+        expectedBytes += size + sizeof(Ip6::Icmp6Header) + sizeof(Ip6::Header);
+    }
+
+    iter.Init();
+    uint8_t txFlowsFound = 0;
+    while ((flowInfo = leader.Get<HistoryTracker::Local>().IterateFlowHistory(iter, age)) != nullptr)
+    {
+        if (flowInfo->mIsTx && (flowInfo->mIpProto == OT_IP6_PROTO_ICMP6) &&
+            (AsCoreType(&flowInfo->mDestination.mAddress) == child.Get<Mle::Mle>().GetMeshLocalEid()))
+        {
+            VerifyOrQuit(AsCoreType(&flowInfo->mSource.mAddress) == leader.Get<Mle::Mle>().GetMeshLocalEid());
+            VerifyOrQuit(flowInfo->mNeighborRloc16 == child.Get<Mle::Mle>().GetRloc16());
+            VerifyOrQuit(flowInfo->mMessageCount == 3);
+            VerifyOrQuit(flowInfo->mByteCount == expectedBytes);
+            VerifyOrQuit(flowInfo->mTxFailureCount == 0);
+            txFlowsFound++;
+        }
+    }
+    VerifyOrQuit(txFlowsFound == 1);
+
+    iter.Init();
+    uint8_t rxFlowsFound = 0;
+    while ((flowInfo = child.Get<HistoryTracker::Local>().IterateFlowHistory(iter, age)) != nullptr)
+    {
+        if (!flowInfo->mIsTx && (flowInfo->mIpProto == OT_IP6_PROTO_ICMP6) &&
+            (AsCoreType(&flowInfo->mSource.mAddress) == leader.Get<Mle::Mle>().GetMeshLocalEid()))
+        {
+            VerifyOrQuit(AsCoreType(&flowInfo->mDestination.mAddress) == child.Get<Mle::Mle>().GetMeshLocalEid());
+            VerifyOrQuit(flowInfo->mNeighborRloc16 == leader.Get<Mle::Mle>().GetRloc16());
+            VerifyOrQuit(flowInfo->mMessageCount == 3);
+            VerifyOrQuit(flowInfo->mByteCount == expectedBytes);
+            rxFlowsFound++;
+        }
+    }
+    VerifyOrQuit(rxFlowsFound == 1);
 }
 
 } // namespace Nexus
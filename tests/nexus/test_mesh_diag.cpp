@@ -310,6 +310,96 @@ void TestMeshDiag(void)
 
     VerifyOrQuit(leader.Get<Utils::MeshDiag>().DiscoverTopology(config, HandleDiscoverCallback, nullptr) ==
                  kErrorInvalidArgs);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Test Scenario 5: Discovery with concurrency of one and discovery stats");
+
+    ResetTest();
+
+    ClearAllBytes(config);
+    config.mDiscoverChildTable = true;
+
+    leader.Get<Utils::MeshDiag>().SetDiscoverConcurrency(0);
+    VerifyOrQuit(leader.Get<Utils::MeshDiag>().GetDiscoverConcurrency() == 1);
+
+    SuccessOrQuit(leader.Get<Utils::MeshDiag>().DiscoverTopology(config, HandleDiscoverCallback, nullptr));
+
+    nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+    SuccessOrQuit(sLastCallbackError);
+    VerifyOrQuit(sDiscoveredRouters.GetLength() == 2);
+
+    {
+        const MeshDiag::DiscoverStats &stats = leader.Get<Utils::MeshDiag>().GetDiscoverStats();
+
+        VerifyOrQuit(stats.mNumTargets == 2);
+        VerifyOrQuit(stats.mNumResponses == 2);
+        VerifyOrQuit(stats.mNumFailures == 0);
+        VerifyOrQuit(stats.mNumQueries == 2);
+        VerifyOrQuit(stats.mNumRetries == 0);
+        VerifyOrQuit(stats.mMaxInFlight == 1);
+        VerifyOrQuit(stats.mNumRouterLinks == 2);
+        VerifyOrQuit(stats.mNumChildren == 2);
+        VerifyOrQuit(stats.mMinResponseTime <= stats.mAvgResponseTime);
+        VerifyOrQuit(stats.mAvgResponseTime <= stats.mMaxResponseTime);
+        VerifyOrQuit(stats.mDuration >= stats.mMaxResponseTime);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Test Scenario 6: Retry and give up on a router that does not respond");
+
+    ResetTest();
+
+    ClearAllBytes(config);
+
+    leader.Get<Utils::MeshDiag>().SetDiscoverConcurrency(2);
+    leader.Get<Utils::MeshDiag>().SetDiscoverMaxRetries(1);
+    leader.Get<Utils::MeshDiag>().SetResponseTimeout(1000);
+
+    UnallowLinkBetween(leader, router1);
+
+    SuccessOrQuit(leader.Get<Utils::MeshDiag>().DiscoverTopology(config, HandleDiscoverCallback, nullptr));
+
+    nexus.AdvanceTime(1500);
+    VerifyOrQuit(sLastCallbackError == kErrorPending);
+    VerifyOrQuit(sDiscoveredRouters.GetLength() == 1);
+    VerifyOrQuit(leader.Get<Utils::MeshDiag>().GetDiscoverStats().mNumRetries == 1);
+
+    nexus.AdvanceTime(1000);
+    VerifyOrQuit(sLastCallbackError == kErrorResponseTimeout);
+    VerifyOrQuit(sDiscoveredRouters.GetLength() == 1);
+
+    {
+        const MeshDiag::DiscoverStats &stats = leader.Get<Utils::MeshDiag>().GetDiscoverStats();
+
+        VerifyOrQuit(stats.mNumTargets == 2);
+        VerifyOrQuit(stats.mNumResponses == 1);
+        VerifyOrQuit(stats.mNumFailures == 1);
+        VerifyOrQuit(stats.mNumQueries == 3);
+        VerifyOrQuit(stats.mNumRetries == 1);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Test Scenario 7: Max retries is clamped and discovery still completes");
+
+    ResetTest();
+
+    leader.Get<Utils::MeshDiag>().SetDiscoverMaxRetries(255);
+    VerifyOrQuit(leader.Get<Utils::MeshDiag>().GetDiscoverMaxRetries() == MeshDiag::kMaxDiscoverMaxRetries);
+
+    SuccessOrQuit(leader.Get<Utils::MeshDiag>().DiscoverTopology(config, HandleDiscoverCallback, nullptr));
+
+    nexus.AdvanceTime((MeshDiag::kMaxDiscoverMaxRetries + 1) * 1000 + 500);
+    VerifyOrQuit(sLastCallbackError == kErrorResponseTimeout);
+    VerifyOrQuit(sDiscoveredRouters.GetLength() == 1);
+
+    {
+        const MeshDiag::DiscoverStats &stats = leader.Get<Utils::MeshDiag>().GetDiscoverStats();
+
+        VerifyOrQuit(stats.mNumFailures == 1);
+        VerifyOrQuit(stats.mNumRetries == MeshDiag::kMaxDiscoverMaxRetries);
+        VerifyOrQuit(stats.mNumQueries == MeshDiag::kMaxDiscoverMaxRetries + 2);
+    }
 }
 
 } // namespace Nexus
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include <openthread/thread_ftd.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+void TestRouteUpdateCoalescing(void)
+{
+    // Forms a chain `leader - routers[0] - routers[1] - routers[2]`.
+    // The leader learns the routes to `routers[1]` and `routers[2]`
+    // only from Route TLVs in received MLE Advertisements, so they
+    // are applied through the deferred (coalesced) route updates.
+
+    static constexpr uint16_t kNumRouters = 3;
+
+    Core                         nexus;
+    Node                        &leader = nexus.CreateNode();
+    Node                        *routers[kNumRouters];
+    const otRouteUpdateCounters *counters;
+    uint16_t                     nextHop;
+    uint8_t                      pathCost;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestRouteUpdateCoalescing");
+
+    leader.Form();
+    nexus.AdvanceTime(50 * Time::kOneSecondInMsec);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        Node &parent = (i == 0) ? leader : *routers[i - 1];
+
+        routers[i] = &nexus.CreateNode();
+        AllowLinkBetween(*routers[i], parent);
+        routers[i]->Join(parent, Node::kAsFtd);
+        nexus.AdvanceTime(200 * Time::kOneSecondInMsec);
+
+        VerifyOrQuit(routers[i]->Get<Mle::Mle>().IsRouter());
+    }
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Check the multi-hop routes on leader");
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        otThreadGetNextHopAndPathCost(&leader, routers[i]->Get<Mle::Mle>().GetRloc16(), &nextHop, &pathCost);
+        Log("Route to router %u: next hop 0x%04x, cost %u", i, nextHop, pathCost);
+
+        VerifyOrQuit(nextHop == routers[0]->Get<Mle::Mle>().GetRloc16());
+        VerifyOrQuit(pathCost == i + 1);
+    }
+
+    counters = otThreadGetRouteUpdateCounters(&leader);
+
+    Log("Route update counters: scheduled %lu, replaced %lu, recomputations %lu", ToUlong(counters->mScheduled),
+        ToUlong(counters->mReplaced), ToUlong(counters->mRecomputations));
+
+    VerifyOrQuit(counters->mScheduled > 0);
+    VerifyOrQuit(counters->mRecomputations > 0);
+    VerifyOrQuit(counters->mRecomputations <= counters->mScheduled);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Break the link to the last router and check the leader drops its route");
+
+    otThreadResetRouteUpdateCounters(&leader);
+    VerifyOrQuit(counters->mScheduled == 0);
+    VerifyOrQuit(counters->mReplaced == 0);
+    VerifyOrQuit(counters->mRecomputations == 0);
+
+    UnallowLinkBetween(*routers[kNumRouters - 1], *routers[kNumRouters - 2]);
+    nexus.AdvanceTime(300 * Time::kOneSecondInMsec);
+
+    otThreadGetNextHopAndPathCost(&leader, routers[kNumRouters - 1]->Get<Mle::Mle>().GetRloc16(), &nextHop,
+                                  &pathCost);
+    Log("Route to last router: next hop 0x%04x, cost %u", nextHop, pathCost);
+
+    VerifyOrQuit(pathCost >= Mle::kMaxRouteCost);
+
+    otThreadGetNextHopAndPathCost(&leader, routers[kNumRouters - 2]->Get<Mle::Mle>().GetRloc16(), &nextHop,
+                                  &pathCost);
+    VerifyOrQuit(pathCost == kNumRouters - 1);
+
+    VerifyOrQuit(counters->mScheduled > 0);
+    VerifyOrQuit(counters->mRecomputations > 0);
+    VerifyOrQuit(counters->mRecomputations <= counters->mScheduled);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestRouteUpdateCoalescing();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+#if OPENTHREAD_CONFIG_TCP_ENABLE
+
+typedef Ip6::Tcp::Endpoint::CongestionControl CongestionControl;
+
+static constexpr uint16_t kNumRouters      = 5;
+static constexpr uint16_t kTcpPort         = 7000;
+static constexpr uint32_t kTransferSize    = 16 * 1024;
+static constexpr uint32_t kTransferTimeout = 20 * 60 * 1000;
+static constexpr uint8_t  kLossyFrameError = 15;
+
+static uint8_t  sSendData[kTransferSize];
+static uint8_t  sSenderRecvBuffer[OT_TCP_RECEIVE_BUFFER_SIZE_MANY_HOPS];
+static uint8_t  sReceiverRecvBuffer[OT_TCP_RECEIVE_BUFFER_SIZE_MANY_HOPS];
+static bool     sEstablished;
+static bool     sSendDone;
+static bool     sDataMismatch;
+static uint32_t sBytesReceived;
+
+static otTcpEndpoint *sAcceptEndpoint;
+
+static void HandleEstablished(otTcpEndpoint *aEndpoint)
+{
+    OT_UNUSED_VARIABLE(aEndpoint);
+    sEstablished = true;
+}
+
+static void HandleSendDone(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData)
+{
+    OT_UNUSED_VARIABLE(aEndpoint);
+    OT_UNUSED_VARIABLE(aData);
+    sSendDone = true;
+}
+
+static void HandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                   size_t         aBytesAvailable,
+                                   bool           aEndOfStream,
+                                   size_t         aBytesRemaining)
+{
+    Ip6::Tcp::Endpoint   &endpoint = AsCoreType(aEndpoint);
+    const otLinkedBuffer *buffer;
+    size_t                consumed = 0;
+
+    OT_UNUSED_VARIABLE(aBytesAvailable);
+    OT_UNUSED_VARIABLE(aEndOfStream);
+    OT_UNUSED_VARIABLE(aBytesRemaining);
+
+    SuccessOrQuit(endpoint.ReceiveByReference(buffer));
+
+    for (; buffer != nullptr; buffer = buffer->mNext)
+    {
+        VerifyOrQuit(sBytesReceived + consumed + buffer->mLength <= kTransferSize);
+
+        if (memcmp(buffer->mData, &sSendData[sBytesReceived + consumed], buffer->mLength) != 0)
+        {
+            sDataMismatch = true;
+        }
+
+        consumed += buffer->mLength;
+    }
+
+    SuccessOrQuit(endpoint.CommitReceive(consumed, 0));
+    sBytesReceived += static_cast<uint32_t>(consumed);
+}
+
+static void HandleDisconnected(otTcpEndpoint *aEndpoint, otTcpDisconnectedReason aReason)
+{
+    OT_UNUSED_VARIABLE(aEndpoint);
+    OT_UNUSED_VARIABLE(aReason);
+}
+
+static otTcpIncomingConnectionAction HandleAcceptReady(otTcpListener    *aListener,
+                                                       const otSockAddr *aPeer,
+                                                       otTcpEndpoint   **aAcceptInto)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aPeer);
+
+    *aAcceptInto = sAcceptEndpoint;
+
+    return OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT;
+}
+
+static void HandleAcceptDone(otTcpListener *aListener, otTcpEndpoint *aEndpoint, const otSockAddr *aPeer)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aEndpoint);
+    OT_UNUSED_VARIABLE(aPeer);
+}
+
+static void InitEndpoint(Node &aNode, Ip6::Tcp::Endpoint &aEndpoint, uint8_t *aRecvBuffer, size_t aRecvBufferSize)
+{
+    otTcpEndpointInitializeArgs args;
+
+    ClearAllBytes(args);
+    args.mEstablishedCallback      = HandleEstablished;
+    args.mSendDoneCallback         = HandleSendDone;
+    args.mReceiveAvailableCallback = HandleReceiveAvailable;
+    args.mDisconnectedCallback     = HandleDisconnected;
+    args.mReceiveBuffer            = aRecvBuffer;
+    args.mReceiveBufferSize        = aRecvBufferSize;
+
+    SuccessOrQuit(aEndpoint.Initialize(aNode.GetInstance(), args));
+}
+
+static const char *CongestionControlToString(CongestionControl aCongestionControl)
+{
+    return (aCongestionControl == Ip6::Tcp::Endpoint::kCongestionControlNewReno) ? "newreno" : "rttgrad";
+}
+
+static void RunBulkTransfer(Core &aNexus, Node &aSender, Node &aReceiver, uint16_t aHops, CongestionControl aCc)
+{
+    Ip6::Tcp::Endpoint          sender;
+    Ip6::Tcp::Endpoint          receiver;
+    Ip6::Tcp::Listener          listener;
+    otTcpListenerInitializeArgs listenerArgs;
+    otLinkedBuffer              linkedBuffer;
+    TimeMilli                   startTime;
+    uint32_t                    elapsed;
+    uint32_t                    sent;
+    uint32_t                    retransmitted;
+
+    sEstablished    = false;
+    sSendDone       = false;
+    sDataMismatch   = false;
+    sBytesReceived  = 0;
+    sAcceptEndpoint = &receiver;
+
+    InitEndpoint(aReceiver, receiver, sReceiverRecvBuffer, sizeof(sReceiverRecvBuffer));
+    InitEndpoint(aSender, sender, sSenderRecvBuffer, sizeof(sSenderRecvBuffer));
+    SuccessOrQuit(receiver.SetCongestionControl(aCc));
+    SuccessOrQuit(sender.SetCongestionControl(aCc));
+    VerifyOrQuit(sender.GetCongestionControl() == aCc);
+
+    ClearAllBytes(listenerArgs);
+    listenerArgs.mAcceptReadyCallback = HandleAcceptReady;
+    listenerArgs.mAcceptDoneCallback  = HandleAcceptDone;
+    SuccessOrQuit(listener.Initialize(aReceiver.GetInstance(), listenerArgs));
+    SuccessOrQuit(listener.Listen(Ip6::SockAddr(aReceiver.Get<Mle::Mle>().GetMeshLocalEid(), kTcpPort)));
+
+    SuccessOrQuit(sender.Connect(Ip6::SockAddr(aReceiver.Get<Mle::Mle>().GetMeshLocalEid(), kTcpPort),
+                                 OT_TCP_CONNECT_NO_FAST_OPEN));
+
+    for (uint32_t waited = 0; !sEstablished && waited < kTransferTimeout; waited += 100)
+    {
+        aNexus.AdvanceTime(100);
+    }
+
+    VerifyOrQuit(sEstablished);
+
+    linkedBuffer.mNext   = nullptr;
+    linkedBuffer.mData   = sSendData;
+    linkedBuffer.mLength = kTransferSize;
+
+    startTime = aNexus.GetNow();
+    SuccessOrQuit(sender.SendByReference(linkedBuffer, 0));
+
+    for (uint32_t waited = 0; (sBytesReceived < kTransferSize || !sSendDone) && waited < kTransferTimeout;
+         waited += 100)
+    {
+        aNexus.AdvanceTime(100);
+    }
+
+    elapsed       = aNexus.GetNow() - startTime;
+    sent          = sender.GetSentSegmentCount();
+    retransmitted = sender.GetRetransmittedSegmentCount();
+
+    Log("%u hops  %-8s  %6lu B/s  segments %4lu  retransmitted %3lu (%2lu.%lu%%)  losses ignored %u", aHops,
+        CongestionControlToString(aCc), ToUlong(kTransferSize * 1000ull / Max<uint32_t>(elapsed, 1)), ToUlong(sent),
+        ToUlong(retransmitted), ToUlong(retransmitted * 100 / Max<uint32_t>(sent, 1)),
+        ToUlong(retransmitted * 1000 / Max<uint32_t>(sent, 1) % 10), sender.GetIgnoredLossCount());
+
+    VerifyOrQuit(sBytesReceived == kTransferSize);
+    VerifyOrQuit(sSendDone);
+    VerifyOrQuit(!sDataMismatch);
+
+    if (aCc == Ip6::Tcp::Endpoint::kCongestionControlNewReno)
+    {
+        VerifyOrQuit(sender.GetIgnoredLossCount() == 0);
+    }
+
+    SuccessOrQuit(sender.Abort());
+    SuccessOrQuit(receiver.Abort());
+    SuccessOrQuit(sender.Deinitialize());
+    SuccessOrQuit(receiver.Deinitialize());
+    SuccessOrQuit(listener.Deinitialize());
+
+    aNexus.AdvanceTime(5 * 1000);
+}
+
+void TestTcpBulkTransfer(void)
+{
+    // Bulk transfer over a chain of routers, from routers at 3, 4 and 5 hops
+    // from the leader, comparing New Reno against the RTT-gradient congestion
+    // control on a clean medium and with random frame loss.
+
+    static const CongestionControl kCcs[] = {
+        Ip6::Tcp::Endpoint::kCongestionControlNewReno,
+        Ip6::Tcp::Endpoint::kCongestionControlRttGradient,
+    };
+    static const uint8_t kFrameErrorRates[] = {0, kLossyFrameError};
+
+    Core  nexus;
+    Node &leader = nexus.CreateNode();
+    Node *routers[kNumRouters];
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestTcpBulkTransfer");
+
+    for (uint32_t i = 0; i < kTransferSize; i++)
+    {
+        sSendData[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+    }
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Form topology - chain of routers");
+
+    leader.Form();
+    nexus.AdvanceTime(100 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        Node &parent = (i == 0) ? leader : *routers[i - 1];
+
+        routers[i] = &nexus.CreateNode();
+        AllowLinkBetween(*routers[i], parent);
+        routers[i]->Join(parent, Node::kAsFtd);
+        nexus.AdvanceTime(20 * 1000);
+    }
+
+    nexus.AdvanceTime(300 * 1000);
+
+    for (Node *router : routers)
+    {
+        VerifyOrQuit(router->Get<Mle::Mle>().IsRouter());
+    }
+
+    nexus.SendAndVerifyEchoRequest(*routers[kNumRouters - 1], leader.Get<Mle::Mle>().GetMeshLocalEid());
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    for (uint8_t frameErrorRate : kFrameErrorRates)
+    {
+        Log("Bulk transfer of %lu bytes, frame error rate %u%%", ToUlong(kTransferSize), frameErrorRate);
+
+        nexus.SetFrameErrorRate(frameErrorRate);
+
+        for (uint16_t hops = 3; hops <= kNumRouters; hops++)
+        {
+            for (CongestionControl cc : kCcs)
+            {
+                RunBulkTransfer(nexus, *routers[hops - 1], leader, hops, cc);
+            }
+        }
+
+        nexus.SetFrameErrorRate(0);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_TCP_ENABLE
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_TCP_ENABLE
+    ot::Nexus::TestTcpBulkTransfer();
+    printf("All tests passed\n");
+#else
+    printf("OPENTHREAD_CONFIG_TCP_ENABLE is not enabled, test is skipped\n");
+#endif
+    return 0;
+}
@@ -26,6 +26,7 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -854,6 +855,137 @@ void TestMultiServiceSameHost(void)
     }
 }
 
+typedef std::chrono::steady_clock::time_point SteadyTime;
+
+static uint32_t DurationSince(SteadyTime aStartTime)
+{
+    // Returns the wall-clock duration in microseconds since `aStartTime`.
+
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStartTime).count());
+}
+
+void TestPeerTableLookupScale(void)
+{
+    static constexpr uint16_t kNumPeers        = 300;
+    static constexpr uint16_t kBasePort        = 20000;
+    static constexpr uint32_t kNumLookupRounds = 200;
+
+    Core                          nexus;
+    Node                         &node             = nexus.CreateNode();
+    Node                         &multiServiceNode = nexus.CreateNode();
+    Dns::Multicast::Core::Service service;
+    uint8_t                       txtData[kMaxTxtDataSize];
+    char                          serviceName[32];
+    char                          extAddrString[20];
+    Mac::ExtAddress               extAddress;
+    uint32_t                      numLookups;
+    uint32_t                      indexedDuration;
+    uint32_t                      linearDuration;
+    SteadyTime                    startTime;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestPeerTableLookupScale()");
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelWarn));
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    Log("Register %u TREL services on `multiServiceNode`", kNumPeers);
+
+    multiServiceNode.Get<ot::Trel::Interface>().SetEnabled(false, ot::Trel::Interface::kRequesterUser);
+    SuccessOrQuit(multiServiceNode.Get<Dns::Multicast::Core>().SetEnabled(true, kInfraIfIndex));
+
+    for (uint16_t i = 0; i < kNumPeers; i++)
+    {
+        Dns::TxtDataEncoder encoder(txtData, sizeof(txtData));
+
+        snprintf(extAddrString, sizeof(extAddrString), "02000000%08x", i + 1);
+        snprintf(serviceName, sizeof(serviceName), "peer%u", i);
+
+        SuccessOrQuit(encoder.AppendEntry("xa", extAddrString));
+        SuccessOrQuit(encoder.AppendEntry("xp", "0102030405060708"));
+
+        ClearAllBytes(service);
+        service.mServiceType     = "_trel._udp";
+        service.mServiceInstance = serviceName;
+        service.mTxtData         = txtData;
+        service.mTxtDataLength   = encoder.GetLength();
+        service.mPort            = kBasePort + i;
+
+        SuccessOrQuit(
+            multiServiceNode.Get<Dns::Multicast::Core>().RegisterService(service, /* aRequestId */ 0, nullptr));
+    }
+
+    nexus.AdvanceTime(30 * 1000);
+
+    SuccessOrQuit(node.Get<Dns::Multicast::Core>().SetEnabled(true, kInfraIfIndex));
+    node.Form();
+    nexus.AdvanceTime(60 * 1000);
+    VerifyOrQuit(node.Get<Mle::Mle>().IsLeader());
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Validate lookups by ext address and sock address for all peers");
+
+    VerifyOrQuit(node.Get<ot::Trel::PeerTable>().GetNumberOfPeers() == kNumPeers);
+
+    for (const ot::Trel::Peer &peer : node.Get<ot::Trel::PeerTable>())
+    {
+        VerifyOrQuit(peer.GetDnssdState() == kDnssdResolved);
+        VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindPeer(peer.GetExtAddress()) == &peer);
+        VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindPeer(peer.GetSockAddr()) == &peer);
+    }
+
+    SuccessOrQuit(extAddress.FromString("0300000000000001"));
+    VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindPeer(extAddress) == nullptr);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Measure rx-path peer lookup cost with %u peers", kNumPeers);
+
+    numLookups = 0;
+    startTime  = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (const ot::Trel::Peer &peer : node.Get<ot::Trel::PeerTable>())
+        {
+            VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindPeer(peer.GetExtAddress()) != nullptr);
+            numLookups++;
+        }
+    }
+
+    indexedDuration = DurationSince(startTime);
+
+    startTime = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (const ot::Trel::Peer &peer : node.Get<ot::Trel::PeerTable>())
+        {
+            VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindMatching(peer.GetExtAddress()) != nullptr);
+        }
+    }
+
+    linearDuration = DurationSince(startTime);
+
+    Log("%lu lookups: indexed %lu usec, linear %lu usec", ToUlong(numLookups), ToUlong(indexedDuration),
+        ToUlong(linearDuration));
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Clear the peer table and validate no stale entries remain in the index");
+
+    node.Get<ot::Trel::PeerTable>().Clear();
+
+    for (uint16_t i = 0; i < kNumPeers; i++)
+    {
+        snprintf(extAddrString, sizeof(extAddrString), "02000000%08x", i + 1);
+        SuccessOrQuit(extAddress.FromString(extAddrString));
+        VerifyOrQuit(node.Get<ot::Trel::PeerTable>().FindPeer(extAddress) == nullptr);
+    }
+}
+
 #endif // OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 } // namespace Nexus
@@ -868,6 +1000,7 @@ int main(void)
     ot::Nexus::TestServiceNameConflict();
     ot::Nexus::TestHostAddressChange();
     ot::Nexus::TestMultiServiceSameHost();
+    ot::Nexus::TestPeerTableLookupScale();
     printf("All tests passed\n");
 #else
     printf("TREL is not enabled - test skipped\n");
@@ -26,11 +26,14 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string.h>
+
 #include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/random.hpp"
 #include "common/string.hpp"
+#include "common/timer.hpp"
 #include "instance/instance.hpp"
 #include "net/checksum.hpp"
 #include "net/icmp6.hpp"
@@ -307,6 +310,149 @@ void TestIcmp6MessageChecksum(void)
     }
 }
 
+void TestTcp6PayloadSumMessageChecksum(void)
+{
+    // Verifies that a checksum summed over the trailing payload while it
+    // is written into the message (as done by the TCP send path) yields
+    // the same result as summing the whole message.
+
+    constexpr uint16_t kMinSize     = sizeof(Ip4::TcpHeader);
+    constexpr uint16_t kMaxSize     = Buffer::kSize * 3 + 24;
+    constexpr uint16_t kMaxChunkLen = 37;
+
+    const char *kSourceAddress = "fd00:feef:dccd:baab:9889:7667:5444:3223";
+    const char *kDestAddress   = "fd01:abab:beef:cafe:1234:5678:9abc:0";
+
+    Ip6::Address sourceAddress;
+    Ip6::Address destAddress;
+
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+
+    VerifyOrQuit(instance != nullptr);
+
+    SuccessOrQuit(sourceAddress.FromString(kSourceAddress));
+    SuccessOrQuit(destAddress.FromString(kDestAddress));
+
+    for (uint16_t size = kMinSize; size <= kMaxSize; size++)
+    {
+        Message       *message = instance->Get<Ip6::Ip6>().NewMessage();
+        Ip4::TcpHeader tcpHeader;
+        Checksum       payloadSum;
+        uint16_t       payloadSize = size - sizeof(tcpHeader);
+        uint8_t        buffer[kMaxSize];
+        uint16_t       offset;
+
+        VerifyOrQuit(message != nullptr, "Ip6::NewMesssage() failed");
+        SuccessOrQuit(message->SetLength(size));
+
+        Random::NonCrypto::Fill(tcpHeader);
+        message->Write(0, tcpHeader);
+
+        // Write the payload in chunks of random (often odd) length,
+        // summing each chunk as it is written.
+
+        Random::NonCrypto::FillBuffer(buffer, payloadSize);
+        offset = 0;
+
+        while (offset < payloadSize)
+        {
+            uint16_t chunkLen = Random::NonCrypto::GenerateInClosedRange<uint16_t>(1, kMaxChunkLen);
+
+            chunkLen = Min<uint16_t>(chunkLen, payloadSize - offset);
+
+            message->WriteBytes(sizeof(tcpHeader) + offset, &buffer[offset], chunkLen);
+            payloadSum.AddData(&buffer[offset], chunkLen);
+            offset += chunkLen;
+        }
+
+        Checksum::UpdateMessageChecksum(*message, sourceAddress, destAddress, Ip6::kProtoTcp, payloadSum,
+                                        payloadSize);
+
+        VerifyOrQuit(CalculateChecksum(sourceAddress, destAddress, Ip6::kProtoTcp, *message) == 0xffff);
+
+        message->Free();
+    }
+}
+
+void BenchmarkTcp6SegmentChecksum(void)
+{
+    // Compares building a TCP segment and then summing the whole message
+    // against summing the payload while it is copied into the segment.
+
+    constexpr uint16_t kBenchPayloadSize = 1024;
+    constexpr uint16_t kBenchChunkSize   = 256;
+    constexpr uint32_t kBenchIteration   = 20000;
+
+    Ip6::Address   sourceAddress;
+    Ip6::Address   destAddress;
+    Ip4::TcpHeader tcpHeader;
+    uint8_t        payload[kBenchPayloadSize];
+    Message       *message;
+    TimeMilli      startTime;
+    uint32_t       twoPassDuration;
+    uint32_t       onePassDuration;
+
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("\nBenchmarkTcp6SegmentChecksum");
+
+    SuccessOrQuit(sourceAddress.FromString("fd00:feef:dccd:baab:9889:7667:5444:3223"));
+    SuccessOrQuit(destAddress.FromString("fd01:abab:beef:cafe:1234:5678:9abc:0"));
+
+    Random::NonCrypto::Fill(tcpHeader);
+    Random::NonCrypto::FillBuffer(payload, sizeof(payload));
+
+    message = instance->Get<Ip6::Ip6>().NewMessage();
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(sizeof(tcpHeader) + kBenchPayloadSize));
+
+    startTime = TimerMilli::GetNow();
+
+    for (uint32_t iter = 0; iter < kBenchIteration; iter++)
+    {
+        message->Write(0, tcpHeader);
+
+        for (uint16_t offset = 0; offset < kBenchPayloadSize; offset += kBenchChunkSize)
+        {
+            message->WriteBytes(sizeof(tcpHeader) + offset, &payload[offset], kBenchChunkSize);
+        }
+
+        Checksum::UpdateMessageChecksum(*message, sourceAddress, destAddress, Ip6::kProtoTcp);
+    }
+
+    twoPassDuration = TimerMilli::GetNow() - startTime;
+    VerifyOrQuit(CalculateChecksum(sourceAddress, destAddress, Ip6::kProtoTcp, *message) == 0xffff);
+
+    startTime = TimerMilli::GetNow();
+
+    for (uint32_t iter = 0; iter < kBenchIteration; iter++)
+    {
+        Checksum payloadSum;
+
+        message->Write(0, tcpHeader);
+
+        for (uint16_t offset = 0; offset < kBenchPayloadSize; offset += kBenchChunkSize)
+        {
+            message->WriteBytes(sizeof(tcpHeader) + offset, &payload[offset], kBenchChunkSize);
+            payloadSum.AddData(&payload[offset], kBenchChunkSize);
+        }
+
+        Checksum::UpdateMessageChecksum(*message, sourceAddress, destAddress, Ip6::kProtoTcp, payloadSum,
+                                        kBenchPayloadSize);
+    }
+
+    onePassDuration = TimerMilli::GetNow() - startTime;
+    VerifyOrQuit(CalculateChecksum(sourceAddress, destAddress, Ip6::kProtoTcp, *message) == 0xffff);
+
+    PrintThroughput("Write then sum", kBenchIteration * kBenchPayloadSize, twoPassDuration);
+    PrintThroughput("Sum while writing", kBenchIteration * kBenchPayloadSize, onePassDuration);
+    printf("\n");
+
+    message->Free();
+}
+
 void TestTcp4MessageChecksum(void)
 {
     constexpr size_t kMinSize = sizeof(Ip4::TcpHeader);
@@ -527,14 +673,23 @@ void TestVerhoeffChecksum(void)
 
 } // namespace ot
 
-int main(void)
+int main(int argc, char *argv[])
 {
     ot::ChecksumTester::TestExampleVector();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
+    ot::TestTcp6PayloadSumMessageChecksum();
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+
+    // The benchmark takes a while and is not needed to check
+    // correctness, so it only runs when requested.
+    if ((argc > 1) && (strcmp(argv[1], "--benchmark") == 0))
+    {
+        ot::BenchmarkTcp6SegmentChecksum();
+    }
+
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
     ot::TestVerhoeffChecksum();
 #endif
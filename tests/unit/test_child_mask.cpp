@@ -0,0 +1,130 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/clearable.hpp"
+#include "common/code_utils.hpp"
+#include "thread/child_mask.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+static constexpr uint16_t kListSize    = OPENTHREAD_CONFIG_MLE_CHILD_MASK_COMPACT_LIST_SIZE;
+
+static_assert(kMaxChildren > kListSize + 1, "Unit test requires more children than the compact list size");
+
+void TestCompactChildMask(void)
+{
+    CompactChildMask mask;
+
+    printf("TestCompactChildMask\n");
+
+    ClearAllBytes(mask);
+    VerifyOrQuit(mask.IsEmpty());
+    VerifyOrQuit(!mask.IsSpilled());
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        VerifyOrQuit(!mask.Has(index));
+    }
+
+    // Add entries in reverse order and check the inline sorted list.
+
+    for (uint16_t index = kListSize; index > 0; index--)
+    {
+        SuccessOrQuit(mask.Add(index - 1));
+        VerifyOrQuit(mask.Has(index - 1));
+        VerifyOrQuit(!mask.IsEmpty());
+        VerifyOrQuit(!mask.IsSpilled());
+    }
+
+    SuccessOrQuit(mask.Add(0));
+    VerifyOrQuit(!mask.IsSpilled());
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        VerifyOrQuit(mask.Has(index) == (index < kListSize));
+    }
+
+    mask.Remove(1);
+    VerifyOrQuit(!mask.Has(1));
+    VerifyOrQuit(mask.Has(0));
+    SuccessOrQuit(mask.Add(1));
+
+    // Add one more entry to spill to bit-set.
+
+    SuccessOrQuit(mask.Add(kMaxChildren - 1));
+    VerifyOrQuit(mask.IsSpilled());
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        VerifyOrQuit(mask.Has(index) == ((index < kListSize) || (index == kMaxChildren - 1)));
+    }
+
+    for (uint16_t index = 0; index < kListSize; index++)
+    {
+        mask.Remove(index);
+        VerifyOrQuit(!mask.Has(index));
+        VerifyOrQuit(!mask.IsEmpty());
+    }
+
+    mask.Remove(kMaxChildren - 1);
+    VerifyOrQuit(mask.IsEmpty());
+    VerifyOrQuit(!mask.IsSpilled());
+
+    // Spill again and verify `Clear()` frees the bit-set.
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        SuccessOrQuit(mask.Add(index));
+    }
+
+    VerifyOrQuit(mask.IsSpilled());
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        VerifyOrQuit(mask.Has(index));
+    }
+
+    mask.Clear();
+    VerifyOrQuit(mask.IsEmpty());
+    VerifyOrQuit(!mask.IsSpilled());
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCompactChildMask();
+    printf("All tests passed\n");
+    return 0;
+}
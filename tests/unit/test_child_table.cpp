@@ -394,11 +394,180 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+static void PrepareChildAddresses(uint16_t         aIndex,
+                                  Mac::ExtAddress &aExtAddress,
+                                  Ip6::Address    &aMeshLocalEid,
+                                  Ip6::Address    &aAddress)
+{
+    Ip6::InterfaceIdentifier iid;
+
+    aExtAddress.Clear();
+    aExtAddress.m8[0] = 0x12;
+    aExtAddress.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    aExtAddress.m8[7] = static_cast<uint8_t>(aIndex & 0xff);
+
+    iid.Clear();
+    iid.mFields.m8[0] = 0x34;
+    iid.mFields.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    iid.mFields.m8[7] = static_cast<uint8_t>(aIndex & 0xff);
+    sInstance->Get<Mle::Mle>().ComposeMeshLocalAddress(iid, aMeshLocalEid);
+
+    SuccessOrQuit(aAddress.FromString("2001:db8::"));
+    aAddress.mFields.m8[14] = static_cast<uint8_t>(aIndex >> 8);
+    aAddress.mFields.m8[15] = static_cast<uint8_t>(aIndex & 0xff);
+}
+
+static const Child *sRejectedChild;
+
+static bool IsChildAccepted(const Child &aChild) { return &aChild != sRejectedChild; }
+
+static bool IsNoChildAccepted(const Child &) { return false; }
+
+void TestChildTableIndexes(void)
+{
+    static constexpr uint16_t kNumLookupRounds = 2000;
+
+    ChildTable     *table;
+    Child          *child;
+    uint16_t        numChildren;
+    Mac::ExtAddress extAddress;
+    Ip6::Address    meshLocalEid;
+    Ip6::Address    address;
+    TimeMilli       startTime;
+    uint32_t        numLookups;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table       = &sInstance->Get<ChildTable>();
+    numChildren = table->GetMaxChildrenAllowed();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test ChildTable lookup by RLOC16, ext address and IPv6 address");
+
+    for (uint16_t index = 0; index < numChildren; index++)
+    {
+        PrepareChildAddresses(index, extAddress, meshLocalEid, address);
+
+        child = table->GetNewChild();
+        VerifyOrQuit(child != nullptr);
+
+        child->SetState(Child::kStateValid);
+        child->SetRloc16(0x8001 + index);
+        child->SetExtAddress(extAddress);
+        SuccessOrQuit(child->AddIp6Address(meshLocalEid));
+        SuccessOrQuit(child->AddIp6Address(address));
+    }
+
+    for (uint16_t index = 0; index < numChildren; index++)
+    {
+        child = table->GetChildAtIndex(index);
+        PrepareChildAddresses(index, extAddress, meshLocalEid, address);
+
+        VerifyOrQuit(table->FindChild(0x8001 + index, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(meshLocalEid, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(address, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(address, Child::kInStateAny) == child);
+
+        VerifyOrQuit(table->FindChild(0x8001 + index, Child::kInStateChildIdRequest) == nullptr);
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateInvalid) == nullptr);
+        VerifyOrQuit(table->FindChild(address, Child::kInStateChildIdRequest) == nullptr);
+    }
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test ChildTable lookup indexes after child entry changes");
+
+    child = table->GetChildAtIndex(0);
+    PrepareChildAddresses(0, extAddress, meshLocalEid, address);
+
+    SuccessOrQuit(child->RemoveIp6Address(address));
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(meshLocalEid, Child::kInStateValid) == child);
+
+    child->ClearIp6Addresses();
+    VerifyOrQuit(table->FindChild(meshLocalEid, Child::kInStateValid) == nullptr);
+
+    child->SetRloc16(0x8100);
+    VerifyOrQuit(table->FindChild(0x8001, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(0x8100, Child::kInStateValid) == child);
+
+    PrepareChildAddresses(numChildren, extAddress, meshLocalEid, address);
+    child->SetExtAddress(extAddress);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) == child);
+
+    child->SetState(Child::kStateInvalid);
+    VerifyOrQuit(table->FindChild(0x8100, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(0x8100, Child::kInStateInvalid) == child);
+
+    child->SetState(Child::kStateRestored);
+    VerifyOrQuit(table->FindChild(0x8100, Child::kInStateValidOrRestoring) == child);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValidOrRestoring) == child);
+
+    child->Clear();
+    VerifyOrQuit(table->FindChild(0x8100, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAnyExceptInvalid) == nullptr);
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test ChildTable lookup by IPv6 address skips children rejected by a predicate");
+
+    // Two children register the same address. Rejecting either one
+    // must still find the other one.
+
+    child = table->GetChildAtIndex(2);
+    PrepareChildAddresses(2, extAddress, meshLocalEid, address);
+    SuccessOrQuit(table->GetChildAtIndex(1)->AddIp6Address(address));
+
+    sRejectedChild = table->GetChildAtIndex(1);
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid, IsChildAccepted) == child);
+
+    sRejectedChild = child;
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid, IsChildAccepted) == table->GetChildAtIndex(1));
+
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid, IsNoChildAccepted) == nullptr);
+
+    SuccessOrQuit(table->GetChildAtIndex(1)->RemoveIp6Address(address));
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid, IsChildAccepted) == nullptr);
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid) == child);
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Benchmark ChildTable lookups with %u children", numChildren);
+
+    numLookups = 0;
+    startTime  = TimerMilli::GetNow();
+
+    for (uint16_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (uint16_t index = 1; index < numChildren; index++)
+        {
+            PrepareChildAddresses(index, extAddress, meshLocalEid, address);
+
+            VerifyOrQuit(table->FindChild(0x8001 + index, Child::kInStateValid) != nullptr);
+            VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) != nullptr);
+            VerifyOrQuit(table->HasSleepyChildWithAddress(address));
+            VerifyOrQuit(table->FindChild(meshLocalEid, Child::kInStateValid) != nullptr);
+            numLookups += 4;
+        }
+    }
+
+    printf(" -- %lu lookups in %lu msec -- PASS\n", ToUlong(numLookups), ToUlong(TimerMilli::GetNow() - startTime));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndexes();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,452 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+#include "test_util.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static void TestMessageIndex(void);
+    static void TestPendingRequestsFallback(void);
+    static void TestResponseCachePeerIndex(void);
+
+private:
+    static Coap::Message *NewMessage(Instance &aInstance, Coap::Type aType, Coap::Code aCode, uint16_t aMessageId);
+};
+
+static constexpr uint16_t kPeerPort = 5683;
+
+Coap::Message *UnitTester::NewMessage(Instance &aInstance, Coap::Type aType, Coap::Code aCode, uint16_t aMessageId)
+{
+    // Allocates a CoAP message with the given header and a one-byte
+    // token derived from `aMessageId`.
+
+    Coap::Message *message;
+    Coap::Token    token;
+    uint8_t        tokenByte = static_cast<uint8_t>(aMessageId);
+
+    message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(message->Init(aType, aCode, aMessageId));
+    SuccessOrQuit(token.SetToken(&tokenByte, sizeof(tokenByte)));
+    SuccessOrQuit(message->WriteToken(token));
+
+    return message;
+}
+
+void UnitTester::TestMessageIndex(void)
+{
+    // Uses the same index size as `PendingRequests`.
+
+    static constexpr uint16_t kNumEntries  = Coap::CoapBase::PendingRequests::kMaxIndexedRequests;
+    static constexpr uint16_t kNumMessages = kNumEntries + 1;
+    static constexpr uint32_t kHash        = 1;
+    static constexpr uint32_t kOtherHash   = kHash + kNumEntries;     // Same bucket as `kHash`.
+    static constexpr uint32_t kExtraHash   = kHash + 2 * kNumEntries; // Same bucket as `kHash`.
+
+    static_assert(kNumEntries >= 4, "kNumEntries is too small for the test");
+
+    Instance                                 *instance;
+    Coap::CoapBase::MessageIndex<kNumEntries> index;
+    Coap::Message                            *messages[kNumMessages];
+    uint16_t                                  entry;
+
+    printf("TestMessageIndex()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    for (Coap::Message *&message : messages)
+    {
+        message = AsCoapMessagePtr(instance->Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+    }
+
+    // `kHash` and `kOtherHash` share a bucket but differ, `kHash` is
+    // used twice. The remaining entries use their own buckets.
+
+    SuccessOrQuit(index.Add(*messages[0], kHash));
+    SuccessOrQuit(index.Add(*messages[1], kOtherHash));
+    SuccessOrQuit(index.Add(*messages[2], kHash));
+
+    for (uint16_t i = 3; i < kNumEntries; i++)
+    {
+        SuccessOrQuit(index.Add(*messages[i], i));
+    }
+
+    VerifyOrQuit(index.Add(*messages[kNumEntries], kExtraHash) == kErrorNoBufs);
+
+    entry = index.GetFirst(kHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[0]);
+    entry = index.GetNext(entry);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+    VerifyOrQuit(index.GetNext(entry) == index.kNone);
+
+    entry = index.GetFirst(kOtherHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[1]);
+    VerifyOrQuit(index.GetNext(entry) == index.kNone);
+
+    for (uint16_t i = 3; i < kNumEntries; i++)
+    {
+        entry = index.GetFirst(i);
+        VerifyOrQuit(entry != index.kNone);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[i]);
+        VerifyOrQuit(index.GetNext(entry) == index.kNone);
+    }
+
+    VerifyOrQuit(index.GetFirst(kExtraHash) == index.kNone);
+    VerifyOrQuit(index.GetFirst(kNumEntries) == index.kNone);
+
+    // Remove the head of the shared bucket and reuse its entry.
+
+    VerifyOrQuit(index.Remove(*messages[0]));
+    VerifyOrQuit(!index.Remove(*messages[0]));
+
+    entry = index.GetFirst(kHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+    VerifyOrQuit(index.GetNext(entry) == index.kNone);
+
+    SuccessOrQuit(index.Add(*messages[kNumEntries], kExtraHash));
+
+    entry = index.GetFirst(kExtraHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[kNumEntries]);
+    VerifyOrQuit(index.GetNext(entry) == index.kNone);
+
+    entry = index.GetFirst(kOtherHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[1]);
+
+    entry = index.GetFirst(kHash);
+    VerifyOrQuit(entry != index.kNone);
+    VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+    VerifyOrQuit(index.GetNext(entry) == index.kNone);
+
+    index.Clear();
+
+    for (uint32_t hash = 0; hash <= kExtraHash; hash++)
+    {
+        VerifyOrQuit(index.GetFirst(hash) == index.kNone);
+    }
+
+    for (Coap::Message *message : messages)
+    {
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestPendingRequestsFallback(void)
+{
+    static constexpr uint16_t kNumIndexed  = Coap::CoapBase::PendingRequests::kMaxIndexedRequests;
+    static constexpr uint16_t kNumRequests = kNumIndexed + 2;
+    static constexpr uint16_t kBaseMsgId   = 0x1200;
+    static constexpr uint16_t kRspMsgId    = 0x3400;
+
+    Instance                        *instance;
+    Coap::CoapBase                  *coap;
+    Coap::CoapBase::PendingRequests *pendingRequests;
+    Coap::CoapBase::SendCallbacks    callbacks;
+    Coap::CoapBase::Request          request;
+    Ip6::MessageInfo                 messageInfo;
+    MessageQueue::Info               info;
+
+    printf("TestPendingRequestsFallback()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    coap            = &instance->Get<Tmf::Agent>();
+    pendingRequests = &coap->mPendingRequests;
+
+    callbacks.Clear();
+
+    messageInfo.Clear();
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+    messageInfo.SetPeerPort(kPeerPort);
+
+    VerifyOrQuit(pendingRequests->mNumUnindexed == 0);
+
+    // Add more requests than the indexes can hold. The extra ones are
+    // left unindexed.
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        Coap::Message *message = NewMessage(*instance, Coap::kTypeConfirmable, Coap::kCodePost, kBaseMsgId + i);
+        Coap::Msg      txMsg(*message, messageInfo);
+
+        SuccessOrQuit(txMsg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+        SuccessOrQuit(pendingRequests->Add(txMsg, Coap::TxParameters::GetDefault(), callbacks, request));
+        message->Free();
+    }
+
+    pendingRequests->GetInfo(info);
+    VerifyOrQuit(info.mNumMessages == kNumRequests);
+    VerifyOrQuit(pendingRequests->mNumUnindexed == kNumRequests - kNumIndexed);
+
+    // While any request is unindexed, ACKs and separate responses
+    // must still match every request, using the linear search. The
+    // response uses a different message ID but the same token.
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        Coap::Message *ack      = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeEmpty, kBaseMsgId + i);
+        Coap::Message *response = NewMessage(*instance, Coap::kTypeNonConfirmable, Coap::kCodeChanged, kRspMsgId + i);
+        Coap::Msg      ackMsg(*ack, messageInfo);
+        Coap::Msg      responseMsg(*response, messageInfo);
+
+        SuccessOrQuit(ackMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        SuccessOrQuit(pendingRequests->FindRelatedRequest(ackMsg, request));
+        VerifyOrQuit(request.GetMessage().ReadMessageId() == kBaseMsgId + i);
+
+        SuccessOrQuit(responseMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        SuccessOrQuit(pendingRequests->FindRelatedRequest(responseMsg, request));
+        VerifyOrQuit(request.GetMessage().ReadMessageId() == kBaseMsgId + i);
+
+        ack->Free();
+        response->Free();
+    }
+
+    // Remove the unindexed requests (the last ones added), so that
+    // lookups go back to using the indexes.
+
+    for (uint16_t i = kNumIndexed; i < kNumRequests; i++)
+    {
+        Coap::Message *ack = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeEmpty, kBaseMsgId + i);
+        Coap::Msg      ackMsg(*ack, messageInfo);
+
+        SuccessOrQuit(ackMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        SuccessOrQuit(pendingRequests->FindRelatedRequest(ackMsg, request));
+        pendingRequests->Remove(request);
+
+        ack->Free();
+    }
+
+    VerifyOrQuit(pendingRequests->mNumUnindexed == 0);
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        Coap::Message *ack = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeEmpty, kBaseMsgId + i);
+        Coap::Msg      ackMsg(*ack, messageInfo);
+        Error          error;
+
+        SuccessOrQuit(ackMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        error = pendingRequests->FindRelatedRequest(ackMsg, request);
+
+        if (i < kNumIndexed)
+        {
+            SuccessOrQuit(error);
+            VerifyOrQuit(request.GetMessage().ReadMessageId() == kBaseMsgId + i);
+        }
+        else
+        {
+            VerifyOrQuit(error == kErrorNotFound);
+            VerifyOrQuit(!request.HasMessage());
+        }
+
+        ack->Free();
+    }
+
+    // An ACK from a different peer must not match.
+
+    {
+        Coap::Message   *ack = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeEmpty, kBaseMsgId);
+        Ip6::MessageInfo otherInfo;
+
+        otherInfo = messageInfo;
+        otherInfo.SetPeerPort(kPeerPort + 1);
+
+        {
+            Coap::Msg ackMsg(*ack, otherInfo);
+
+            SuccessOrQuit(ackMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+            VerifyOrQuit(pendingRequests->FindRelatedRequest(ackMsg, request) == kErrorNotFound);
+        }
+
+        ack->Free();
+    }
+
+    pendingRequests->AbortAllRequests();
+
+    pendingRequests->GetInfo(info);
+    VerifyOrQuit(info.mNumMessages == 0);
+    VerifyOrQuit(pendingRequests->mNumUnindexed == 0);
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestResponseCachePeerIndex(void)
+{
+    static constexpr uint16_t kMaxCacheSize = Coap::CoapBase::ResponseCache::kMaxCacheSize;
+    static constexpr uint16_t kMsgId        = 0x5600;
+    static constexpr uint32_t kLifetime     = 10000;
+
+    Instance                      *instance;
+    Coap::CoapBase::ResponseCache *cache;
+    Ip6::MessageInfo               peerA;
+    Ip6::MessageInfo               peerB;
+    Ip6::MessageInfo               peerC;
+    const Ip6::MessageInfo        *peers[]  = {&peerA, &peerB, &peerC};
+    const uint16_t                 msgIds[] = {kMsgId, kMsgId + 1};
+    MessageQueue::Info             info;
+
+    printf("TestResponseCachePeerIndex()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    cache = &instance->Get<Tmf::Agent>().mResponseCache;
+    cache->RemoveAll();
+
+    peerA.Clear();
+    SuccessOrQuit(peerA.GetPeerAddr().FromString("fd00::a"));
+    peerA.SetPeerPort(kPeerPort);
+
+    peerB = peerA;
+    SuccessOrQuit(peerB.GetPeerAddr().FromString("fd00::b"));
+
+    peerC = peerA;
+    peerC.SetPeerPort(kPeerPort + 1);
+
+    // Cache responses with the same message ID to two peers.
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        const Ip6::MessageInfo *peer     = peers[i];
+        Coap::Message          *response = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeChanged, kMsgId);
+        Coap::Msg               txMsg(*response, *peer);
+
+        SuccessOrQuit(txMsg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+        cache->Add(txMsg, kLifetime);
+
+        // Adding the same response again must not add a duplicate.
+        cache->Add(txMsg, kLifetime);
+
+        response->Free();
+    }
+
+    cache->GetInfo(info);
+    VerifyOrQuit(info.mNumMessages == 2);
+
+    // Each peer finds its own response. A request with the same
+    // message ID from a different port, or a different message ID
+    // from the same peer, finds nothing.
+
+    for (const Ip6::MessageInfo *peer : peers)
+    {
+        for (uint16_t msgId : msgIds)
+        {
+            Coap::Message *request = NewMessage(*instance, Coap::kTypeConfirmable, Coap::kCodePost, msgId);
+            Coap::Msg      rxMsg(*request, *peer);
+            const Message *match;
+
+            SuccessOrQuit(rxMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+            match = cache->FindMatching(rxMsg);
+
+            if ((peer == &peerC) || (msgId != kMsgId))
+            {
+                VerifyOrQuit(match == nullptr);
+            }
+            else
+            {
+                Coap::CoapBase::ResponseCache::ResponseMetadata metadata;
+
+                VerifyOrQuit(match != nullptr);
+                metadata.ReadFrom(*match);
+                VerifyOrQuit(metadata.mMessageInfo.HasSamePeerAddrAndPort(*peer));
+            }
+
+            request->Free();
+        }
+    }
+
+    // Fill the cache past its limit. The earliest expiring entries are
+    // evicted and also removed from the index.
+
+    for (uint16_t i = 0; i < kMaxCacheSize; i++)
+    {
+        Coap::Message *response = NewMessage(*instance, Coap::kTypeAck, Coap::kCodeChanged, kMsgId + 1 + i);
+        Coap::Msg      txMsg(*response, peerA);
+
+        SuccessOrQuit(txMsg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+        cache->Add(txMsg, kLifetime + 1 + i);
+
+        response->Free();
+    }
+
+    cache->GetInfo(info);
+    VerifyOrQuit(info.mNumMessages == kMaxCacheSize);
+    VerifyOrQuit(cache->GetCounters().mEvictions == 2);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        Coap::Message *request = NewMessage(*instance, Coap::kTypeConfirmable, Coap::kCodePost, kMsgId);
+        Coap::Msg      rxMsg(*request, *peers[i]);
+
+        SuccessOrQuit(rxMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        VerifyOrQuit(cache->FindMatching(rxMsg) == nullptr);
+
+        request->Free();
+    }
+
+    for (uint16_t i = 0; i < kMaxCacheSize; i++)
+    {
+        Coap::Message *request = NewMessage(*instance, Coap::kTypeConfirmable, Coap::kCodePost, kMsgId + 1 + i);
+        Coap::Msg      rxMsg(*request, peerA);
+
+        SuccessOrQuit(rxMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+        VerifyOrQuit(cache->FindMatching(rxMsg) != nullptr);
+
+        request->Free();
+    }
+
+    cache->RemoveAll();
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestMessageIndex();
+    ot::UnitTester::TestPendingRequestsFallback();
+    ot::UnitTester::TestResponseCachePeerIndex();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -27,6 +27,7 @@
  */
 
 #include "common/crc.hpp"
+#include "common/timer.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -105,12 +106,129 @@ void TestCrc32(void)
     }
 }
 
+template <typename UintType> UintType CalculateBitwiseCrc(UintType aPolynomial, const uint8_t *aData, uint16_t aLength)
+{
+    static constexpr uint8_t kBitWidth = sizeof(UintType) * 8;
+
+    UintType crc = 0;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<UintType>(aData[i]) << (kBitWidth - 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            bool msbIsSet = (crc >> (kBitWidth - 1)) & 1;
+
+            crc <<= 1;
+
+            if (msbIsSet)
+            {
+                crc ^= aPolynomial;
+            }
+        }
+    }
+
+    return crc;
+}
+
+void TestCrcRandomLengths(void)
+{
+    static constexpr uint16_t kMaxLength = 300;
+
+    uint8_t data[kMaxLength];
+
+    printf("\nTestCrcRandomLengths");
+
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+
+    for (uint16_t length = 0; length <= kMaxLength; length++)
+    {
+        CrcCalculator<uint16_t> ccitt(kCrc16CcittPolynomial);
+        CrcCalculator<uint16_t> ansi(kCrc16AnsiPolynomial);
+        CrcCalculator<uint16_t> other(0x3d65);
+        CrcCalculator<uint32_t> crc32(kCrc32AnsiPolynomial);
+        uint16_t                split = length / 3;
+
+        // Feed in two parts to check continuation of a computation.
+
+        ccitt.FeedBytes(data, split);
+        ccitt.FeedBytes(data + split, length - split);
+        ansi.FeedBytes(data, length);
+        other.FeedBytes(data, length);
+        crc32.FeedBytes(data, split);
+        crc32.FeedBytes(data + split, length - split);
+
+        VerifyOrQuit(ccitt.GetCrc() == CalculateBitwiseCrc<uint16_t>(kCrc16CcittPolynomial, data, length));
+        VerifyOrQuit(ansi.GetCrc() == CalculateBitwiseCrc<uint16_t>(kCrc16AnsiPolynomial, data, length));
+        VerifyOrQuit(other.GetCrc() == CalculateBitwiseCrc<uint16_t>(0x3d65, data, length));
+        VerifyOrQuit(crc32.GetCrc() == CalculateBitwiseCrc<uint32_t>(kCrc32AnsiPolynomial, data, length));
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestCrcThroughput(void)
+{
+    static constexpr uint16_t kLengths[]     = {127, 1280};
+    static constexpr uint32_t kBytesPerRound = 16 * 1024 * 1024;
+
+    uint8_t data[1280];
+
+    printf("\nTestCrcThroughput (slicing-by-8 %s)\n",
+           OPENTHREAD_CONFIG_CRC_SLICING_BY_8_ENABLE ? "enabled" : "disabled");
+
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+
+    for (uint16_t length : kLengths)
+    {
+        uint32_t  iterations = kBytesPerRound / length;
+        uint32_t  crc16Duration;
+        uint32_t  crc32Duration;
+        uint16_t  crc16 = 0;
+        uint32_t  crc32 = 0;
+        TimeMilli startTime;
+
+        startTime = TimerMilli::GetNow();
+
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            data[0] = static_cast<uint8_t>(i);
+            crc16 += CrcCalculator<uint16_t>(kCrc16CcittPolynomial).FeedBytes(data, length);
+        }
+
+        crc16Duration = Max<uint32_t>(TimerMilli::GetNow() - startTime, 1);
+        startTime     = TimerMilli::GetNow();
+
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            data[0] = static_cast<uint8_t>(i);
+            crc32 += CrcCalculator<uint32_t>(kCrc32AnsiPolynomial).FeedBytes(data, length);
+        }
+
+        crc32Duration = Max<uint32_t>(TimerMilli::GetNow() - startTime, 1);
+
+        // Bytes per msec is the same as KB/s.
+        printf("  %4u-byte input: CRC16 %lu KB/s, CRC32 %lu KB/s (0x%04x, 0x%08lx)\n", length,
+               ToUlong(iterations * length / crc16Duration), ToUlong(iterations * length / crc32Duration), crc16,
+               ToUlong(crc32));
+    }
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestCrc16();
     ot::TestCrc32();
+    ot::TestCrcRandomLengths();
+    ot::TestCrcThroughput();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/hash.hpp"
+#include "common/num_utils.hpp"
+
+namespace ot {
+
+void TestFnv1aHash(void)
+{
+    struct TestCase
+    {
+        const char *mString;
+        uint32_t    mExpectedHash;
+    };
+
+    static const TestCase kTestCases[] = {
+        {"", 0x811c9dc5},
+        {"a", 0xe40c292c},
+        {"foobar", 0xbf9cf968},
+        {"123456789", 0xbb86b11c},
+    };
+
+    printf("\nTestFnv1aHash");
+
+    for (const TestCase &testCase : kTestCases)
+    {
+        uint16_t  length = static_cast<uint16_t>(strlen(testCase.mString));
+        Fnv1aHash hash;
+        Fnv1aHash byteHash;
+        Fnv1aHash splitHash;
+
+        VerifyOrQuit(hash.FeedBytes(testCase.mString, length) == testCase.mExpectedHash);
+        VerifyOrQuit(hash.GetHash() == testCase.mExpectedHash);
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            byteHash.FeedByte(static_cast<uint8_t>(testCase.mString[i]));
+        }
+
+        VerifyOrQuit(byteHash.GetHash() == testCase.mExpectedHash);
+
+        splitHash.FeedBytes(testCase.mString, length / 2);
+        splitHash.FeedBytes(testCase.mString + length / 2, length - length / 2);
+        VerifyOrQuit(splitHash.GetHash() == testCase.mExpectedHash);
+
+        printf("\n- \"%s\" -> 0x%08lx", testCase.mString, ToUlong(hash.GetHash()));
+    }
+
+    {
+        static const uint32_t kValue = 0x12345678;
+
+        VerifyOrQuit(Fnv1aHash().Feed(kValue) == Fnv1aHash().FeedBytes(&kValue, sizeof(kValue)));
+    }
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestFnv1aHash();
+    printf("All tests passed\n");
+    return 0;
+}
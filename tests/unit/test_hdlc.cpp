@@ -29,11 +29,12 @@
 #include <ctype.h>
 
 #include "common/code_utils.hpp"
+#include "common/timer.hpp"
 #include "instance/instance.hpp"
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
 
-#include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 namespace Ncp {
@@ -42,6 +43,8 @@ constexpr uint16_t kBufferSize        = 1500;  // Frame buffer size
 constexpr uint16_t kMaxFrameLength    = 500;   // Maximum allowed frame length (used when randomly generating frames)
 constexpr uint32_t kFuzzTestIteration = 50000; // Number of iteration during fuzz test (randomly generating frames)
 constexpr uint16_t kFrameHeaderSize   = 4;     // Frame header size
+constexpr uint16_t kBenchFrameLength  = 1280;  // Frame length used in throughput benchmark
+constexpr uint32_t kBenchIteration    = 20000; // Number of frames encoded/decoded in throughput benchmark
 
 constexpr uint8_t kFlagXOn        = 0x11;
 constexpr uint8_t kFlagXOff       = 0x13;
@@ -640,6 +643,82 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestEncoderDecoderThroughput(void)
+{
+    uint8_t                          frame[kBenchFrameLength];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                   decoderContext;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::Decoder                    decoder;
+    TimeMilli                        startTime;
+    uint32_t                         encodeDuration;
+    uint32_t                         decodeDuration;
+    uint16_t                         chunkLength;
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder throughput");
+
+    // Mostly plain bytes with a few bytes requiring escape, similar
+    // to a typical Spinel frame carrying an IPv6 packet.
+
+    for (uint16_t i = 0; i < kBenchFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(64) == 0 ? kEscapeSequence : GetRandom(0x70));
+    }
+
+    startTime = TimerMilli::GetNow();
+
+    for (uint32_t iter = 0; iter < kBenchIteration; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, kBenchFrameLength));
+        SuccessOrQuit(encoder.EndFrame());
+    }
+
+    encodeDuration = TimerMilli::GetNow() - startTime;
+
+    decoder.Init(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    startTime = TimerMilli::GetNow();
+
+    for (uint32_t iter = 0; iter < kBenchIteration; iter++)
+    {
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+    }
+
+    decodeDuration = TimerMilli::GetNow() - startTime;
+
+    VerifyOrQuit(decoderBuffer.GetLength() == kBenchFrameLength);
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, kBenchFrameLength) == 0);
+
+    // Decode the same frame fed in small chunks, so that runs of plain
+    // bytes get split across `Decode()` calls.
+
+    decoderBuffer.Clear();
+    decoderContext.mWasCalled = false;
+
+    for (uint16_t offset = 0; offset < encoderBuffer.GetLength(); offset += chunkLength)
+    {
+        chunkLength = Min<uint16_t>(static_cast<uint16_t>(GetRandom(13) + 1), encoderBuffer.GetLength() - offset);
+        decoder.Decode(encoderBuffer.GetFrame() + offset, chunkLength);
+    }
+
+    VerifyOrQuit(decoderContext.mWasCalled);
+    VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+    VerifyOrQuit(decoderBuffer.GetLength() == kBenchFrameLength);
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, kBenchFrameLength) == 0);
+
+    PrintThroughput("Encode", kBenchFrameLength * kBenchIteration, encodeDuration);
+    PrintThroughput("Decode", kBenchFrameLength * kBenchIteration, decodeDuration);
+
+    printf("\n -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -649,6 +728,7 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderThroughput();
     printf("\nAll tests passed.\n");
     return 0;
 }
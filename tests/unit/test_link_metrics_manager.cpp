@@ -64,6 +64,7 @@ class UnitTester
 {
 public:
     static void TestLinkMetricsManager(void);
+    static void TestLinkMetricsManagerBatching(void);
 
 private:
     static void SetTestLinkMetricsValues(otLinkMetricsValues &aLinkMetricsValues,
@@ -206,6 +207,118 @@ void UnitTester::TestLinkMetricsManager(void)
     // subject1 got response and become active again
     linkMetricsMgr->HandleMgmtResponse(&linkLocalAddr, MapEnum(LinkMetrics::Status::kStatusSuccess));
     VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kActive);
+
+    testFreeInstance(sInstance);
+}
+
+void UnitTester::TestLinkMetricsManagerBatching(void)
+{
+    ChildTable                  *childTable;
+    LinkMetricsManager          *linkMetricsMgr = nullptr;
+    LinkMetricsManager::Subject *subject1       = nullptr;
+    LinkMetricsManager::Subject *subject2       = nullptr;
+    LinkMetricsManager::Overhead overhead;
+    Ip6::Address                 linkLocalAddr;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    childTable = &sInstance->Get<ChildTable>();
+
+    sInstance->Get<Mle::Mle>().SetRole(Mle::kRoleRouter);
+
+    for (const TestChild &testChild : mTestChildList)
+    {
+        Child *child = childTable->GetNewChild();
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        child->SetState(testChild.mState);
+        child->SetExtAddress(AsCoreType(&testChild.mExtAddress));
+        child->SetVersion(testChild.mThreadVersion);
+    }
+
+    linkMetricsMgr = &sInstance->Get<LinkMetricsManager>();
+    linkMetricsMgr->SetBatchSize(1);
+    VerifyOrQuit(linkMetricsMgr->GetBatchSize() == 1);
+    linkMetricsMgr->SetEnabled(true);
+
+    linkMetricsMgr->UpdateSubjects();
+    subject1 = linkMetricsMgr->mSubjectList.FindMatching(AsCoreType(&mTestChildList[0].mExtAddress));
+    subject2 = linkMetricsMgr->mSubjectList.FindMatching(AsCoreType(&mTestChildList[1].mExtAddress));
+    VerifyOrQuit(subject1 != nullptr);
+    VerifyOrQuit(subject2 != nullptr);
+
+    // With batching, updating the states only queues the subjects.
+    linkMetricsMgr->UpdateLinkMetricsStates();
+
+    for (LinkMetricsManager::Subject &subject : linkMetricsMgr->mSubjectList)
+    {
+        VerifyOrQuit(subject.mState == LinkMetricsManager::SubjectState::kNotConfigured);
+        VerifyOrQuit(subject.mConfigurePending);
+    }
+
+    VerifyOrQuit(linkMetricsMgr->mBatchTimer.IsRunning());
+
+    // Each batch slot configures at most one subject.
+    linkMetricsMgr->HandleBatchTimer();
+    VerifyOrQuit((subject1->mState == LinkMetricsManager::SubjectState::kConfiguring) !=
+                 (subject2->mState == LinkMetricsManager::SubjectState::kConfiguring));
+    VerifyOrQuit(linkMetricsMgr->mBatchTimer.IsRunning());
+
+    linkMetricsMgr->HandleBatchTimer();
+    VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kConfiguring);
+    VerifyOrQuit(subject2->mState == LinkMetricsManager::SubjectState::kConfiguring);
+    VerifyOrQuit(!subject1->mConfigurePending && !subject2->mConfigurePending);
+    VerifyOrQuit(!linkMetricsMgr->mBatchTimer.IsRunning());
+
+    // A queued subject whose neighbor is gone is removed.
+    linkMetricsMgr->Update();
+    VerifyOrQuit(subject1->mConfigurePending && subject2->mConfigurePending);
+    childTable->FindChild(subject2->mExtAddress, Child::kInStateValid)->SetState(Child::kStateInvalid);
+    linkMetricsMgr->Update();
+    VerifyOrQuit(linkMetricsMgr->mSubjectList.FindMatching(AsCoreType(&mTestChildList[1].mExtAddress)) == nullptr);
+    linkMetricsMgr->HandleBatchTimer();
+
+    // Check the overhead report: three requests and one response over
+    // two minutes.
+    linkLocalAddr.InitAsLinkLocalAddress(AsCoreType(&mTestChildList[0].mExtAddress));
+    linkMetricsMgr->HandleMgmtResponse(&linkLocalAddr, MapEnum(LinkMetrics::Status::kStatusSuccess));
+    VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kActive);
+
+    sNow += 2 * 60 * 1000;
+    linkMetricsMgr->GetOverhead(overhead);
+    VerifyOrQuit(overhead.mMgmtRequests == 3);
+    VerifyOrQuit(overhead.mMgmtResponses == 1);
+    VerifyOrQuit(overhead.mDuration == 2 * 60 * 1000);
+    VerifyOrQuit(overhead.mFramesPerMinute == 2);
+
+    // A request that cannot be sent stays queued and is retried in the
+    // next slot.
+    childTable->FindChild(subject1->mExtAddress, Child::kInStateValid)->SetVersion(kThreadVersion1p1);
+    subject1->mConfigurePending = true;
+    linkMetricsMgr->HandleBatchTimer();
+    VerifyOrQuit(subject1->mConfigurePending);
+    VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kActive);
+    VerifyOrQuit(linkMetricsMgr->mBatchTimer.IsRunning());
+
+    childTable->FindChild(subject1->mExtAddress, Child::kInStateValid)->SetVersion(kThreadVersion1p2);
+    linkMetricsMgr->HandleBatchTimer();
+    VerifyOrQuit(!subject1->mConfigurePending);
+    VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kRenewing);
+    VerifyOrQuit(!linkMetricsMgr->mBatchTimer.IsRunning());
+
+    // Disabling batching while a subject is queued serves it in the
+    // next slot instead of rescheduling the slot forever.
+    linkMetricsMgr->HandleMgmtResponse(&linkLocalAddr, MapEnum(LinkMetrics::Status::kStatusSuccess));
+    subject1->mConfigurePending = true;
+    linkMetricsMgr->SetBatchSize(0);
+    linkMetricsMgr->HandleBatchTimer();
+    VerifyOrQuit(!subject1->mConfigurePending);
+    VerifyOrQuit(subject1->mState == LinkMetricsManager::SubjectState::kRenewing);
+    VerifyOrQuit(!linkMetricsMgr->mBatchTimer.IsRunning());
+
+    testFreeInstance(sInstance);
 }
 
 #endif // OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ENABLE
@@ -216,6 +329,7 @@ int main(void)
 {
 #if OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ENABLE
     ot::UnitTester::TestLinkMetricsManager();
+    ot::UnitTester::TestLinkMetricsManagerBatching();
 #endif
     printf("\nAll tests passed.\n");
     return 0;
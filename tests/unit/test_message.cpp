@@ -537,6 +537,66 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessageGetView(void)
+{
+    static constexpr uint16_t kMessageLength = Buffer::kSize * 3;
+    static constexpr uint16_t kViewLength    = 24;
+
+    Instance   *instance;
+    Message    *message;
+    uint8_t     writeBuffer[kMessageLength];
+    uint8_t     buffer[kViewLength];
+    FrameData   view;
+    OffsetRange offsetRange;
+    uint16_t    numInPlace = 0;
+    uint16_t    numCopied  = 0;
+
+    printf("TestMessageGetView\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageLength);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageLength));
+
+    for (uint16_t offset = 0; offset + kViewLength <= kMessageLength; offset++)
+    {
+        offsetRange.Init(offset, kViewLength);
+        SuccessOrQuit(message->GetView(offsetRange, buffer, view));
+
+        VerifyOrQuit(view.GetLength() == kViewLength);
+        VerifyOrQuit(memcmp(view.GetBytes(), writeBuffer + offset, kViewLength) == 0);
+
+        if (view.GetBytes() == buffer)
+        {
+            numCopied++;
+
+            // A buffer too small to hold the copy must be rejected.
+            VerifyOrQuit(message->GetView(offsetRange, buffer, kViewLength - 1, view) == kErrorNoBufs);
+        }
+        else
+        {
+            numInPlace++;
+        }
+    }
+
+    VerifyOrQuit(numInPlace > 0);
+    VerifyOrQuit(numCopied > 0);
+
+    offsetRange.Init(kMessageLength - kViewLength + 1, kViewLength);
+    VerifyOrQuit(message->GetView(offsetRange, buffer, view) == kErrorParse);
+
+    offsetRange.Init(kMessageLength, 0);
+    SuccessOrQuit(message->GetView(offsetRange, buffer, view));
+    VerifyOrQuit(view.GetLength() == 0);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
@@ -550,6 +610,7 @@ int main(void)
 
     ot::UnitTester::TestCloning();
     ot::TestAppender();
+    ot::TestMessageGetView();
 
     printf("All tests passed\n");
     return 0;
@@ -0,0 +1,202 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/min_heap.hpp"
+
+namespace ot {
+
+class HeapOwner
+{
+public:
+    static constexpr uint16_t kNumEntries = 37;
+
+    HeapOwner(void)
+        : mHeap(*this)
+    {
+    }
+
+    bool IsKeyLess(uint16_t aEntryA, uint16_t aEntryB) const { return mKeys[aEntryA] < mKeys[aEntryB]; }
+
+    using Heap = MinHeap<HeapOwner, kNumEntries, &HeapOwner::IsKeyLess>;
+
+    uint32_t mKeys[kNumEntries];
+    Heap     mHeap;
+};
+
+void TestMinHeapOrder(void)
+{
+    HeapOwner owner;
+    uint32_t  lastKey = 0;
+
+    printf("\nTestMinHeapOrder");
+
+    VerifyOrQuit(owner.mHeap.IsEmpty());
+
+    for (uint16_t i = 0; i < HeapOwner::kNumEntries; i++)
+    {
+        owner.mKeys[i] = static_cast<uint32_t>(rand()) % 100;
+        owner.mHeap.Update(i);
+        VerifyOrQuit(owner.mHeap.Contains(i));
+        VerifyOrQuit(owner.mHeap.GetLength() == i + 1);
+        VerifyOrQuit(owner.mHeap.IsValid());
+    }
+
+    while (!owner.mHeap.IsEmpty())
+    {
+        uint16_t top = owner.mHeap.GetTop();
+
+        VerifyOrQuit(owner.mKeys[top] >= lastKey);
+        lastKey = owner.mKeys[top];
+
+        owner.mHeap.Remove(top);
+        VerifyOrQuit(!owner.mHeap.Contains(top));
+        VerifyOrQuit(owner.mHeap.IsValid());
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestMinHeapUpdateAndRemove(void)
+{
+    static constexpr uint16_t kNumIterations = 2000;
+
+    HeapOwner owner;
+
+    printf("TestMinHeapUpdateAndRemove");
+
+    for (uint16_t i = 0; i < HeapOwner::kNumEntries; i++)
+    {
+        owner.mKeys[i] = i;
+    }
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        uint16_t entry  = static_cast<uint16_t>(rand()) % HeapOwner::kNumEntries;
+        uint16_t length = owner.mHeap.GetLength();
+
+        switch (rand() % 3)
+        {
+        case 0:
+            // Add a new entry or change the key of an existing one.
+            length += owner.mHeap.Contains(entry) ? 0 : 1;
+            owner.mKeys[entry] = static_cast<uint32_t>(rand()) % 1000;
+            owner.mHeap.Update(entry);
+            VerifyOrQuit(owner.mHeap.Contains(entry));
+            break;
+
+        case 1:
+            length -= owner.mHeap.Contains(entry) ? 1 : 0;
+            owner.mHeap.Remove(entry);
+            VerifyOrQuit(!owner.mHeap.Contains(entry));
+            break;
+
+        default:
+            if (!owner.mHeap.IsEmpty())
+            {
+                uint16_t top = owner.mHeap.GetTop();
+
+                for (uint16_t i = 0; i < HeapOwner::kNumEntries; i++)
+                {
+                    VerifyOrQuit(!owner.mHeap.Contains(i) || (owner.mKeys[i] >= owner.mKeys[top]));
+                }
+            }
+            break;
+        }
+
+        VerifyOrQuit(owner.mHeap.GetLength() == length);
+        VerifyOrQuit(owner.mHeap.IsValid());
+    }
+
+    owner.mHeap.Clear();
+    VerifyOrQuit(owner.mHeap.IsEmpty());
+
+    for (uint16_t i = 0; i < HeapOwner::kNumEntries; i++)
+    {
+        VerifyOrQuit(!owner.mHeap.Contains(i));
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestMinHeapRenumber(void)
+{
+    // Mimics a dense table where removing an entry moves the last
+    // entry into the freed slot.
+
+    HeapOwner owner;
+    uint16_t  length = HeapOwner::kNumEntries;
+
+    printf("TestMinHeapRenumber");
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        owner.mKeys[i] = static_cast<uint32_t>(rand()) % 100;
+        owner.mHeap.Update(i);
+    }
+
+    while (length > 0)
+    {
+        uint16_t entry     = static_cast<uint16_t>(rand()) % length;
+        uint16_t lastEntry = length - 1;
+
+        owner.mHeap.Remove(entry);
+
+        if (entry != lastEntry)
+        {
+            owner.mHeap.Renumber(lastEntry, entry);
+            owner.mKeys[entry] = owner.mKeys[lastEntry];
+            VerifyOrQuit(owner.mHeap.Contains(entry));
+        }
+
+        VerifyOrQuit(!owner.mHeap.Contains(lastEntry));
+
+        length--;
+        VerifyOrQuit(owner.mHeap.GetLength() == length);
+        VerifyOrQuit(owner.mHeap.IsValid());
+    }
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestMinHeapOrder();
+    ot::TestMinHeapUpdateAndRemove();
+    ot::TestMinHeapRenumber();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -252,6 +252,31 @@ void VerifyContext(Instance &aInstance, uint8_t aContextId, const Ip6::Prefix &a
     }
 }
 
+void AppendRouteTlvValue(Message &aMessage, uint8_t aNumRouters)
+{
+    Mle::RouterIdMask mask;
+
+    mask.Clear();
+    mask.SetSequence(aNumRouters);
+
+    for (uint8_t index = 0; index < aNumRouters; index++)
+    {
+        mask.Add(index * 2);
+    }
+
+    SuccessOrQuit(aMessage.Append(mask));
+
+    for (uint8_t index = 0; index < aNumRouters; index++)
+    {
+#if !OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
+        SuccessOrQuit(Mle::RouteTlv::AppendRouteDataEntry(aMessage, kLinkQuality3, kLinkQuality2, index % 15));
+#else
+        SuccessOrQuit(Mle::RouteTlv::AppendRouteDataEntry(aMessage, kLinkQuality3, kLinkQuality2, index % 15,
+                                                          (index % 2) == 0));
+#endif
+    }
+}
+
 } // namespace
 
 class UnitTester
@@ -266,6 +291,208 @@ public:
         printf("TestChildIdResponseNetworkDataHandling passed\n");
     }
 
+    static void AppendParentResponseTlvs(Message &aMessage)
+    {
+        static const uint8_t kBytes[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a};
+
+        SuccessOrQuit(Tlv::Append<Mle::SourceAddressTlv>(aMessage, 0x5400));
+        SuccessOrQuit(Tlv::AppendTlv(aMessage, Mle::Tlv::kLeaderData, kBytes, 8));
+        SuccessOrQuit(Tlv::Append<Mle::LinkFrameCounterTlv>(aMessage, 100));
+        SuccessOrQuit(Tlv::Append<Mle::MleFrameCounterTlv>(aMessage, 200));
+        SuccessOrQuit(Tlv::AppendTlv(aMessage, Mle::Tlv::kResponse, kBytes, 8));
+        SuccessOrQuit(Tlv::AppendTlv(aMessage, Mle::Tlv::kChallenge, kBytes, 8));
+        SuccessOrQuit(Tlv::Append<Mle::LinkMarginTlv>(aMessage, 20));
+        SuccessOrQuit(Tlv::AppendTlv(aMessage, Mle::Tlv::kConnectivity, kBytes, 10));
+        SuccessOrQuit(Tlv::Append<Mle::VersionTlv>(aMessage, 5));
+        SuccessOrQuit(Tlv::Append<Mle::LinkMarginTlv>(aMessage, 30));
+    }
+
+    template <typename MessageType> static uint8_t LookUpParentResponseTlvs(const MessageType &aMessage)
+    {
+        // Performs the TLV lookups of a typical Parent Response handler
+        // and returns the number of TLVs found.
+
+        static const uint8_t kTypes[] = {Mle::Tlv::kLeaderData, Mle::Tlv::kResponse,     Mle::Tlv::kConnectivity,
+                                         Mle::Tlv::kChallenge,  Mle::Tlv::kCslClockAccuracy};
+
+        uint8_t     numFound = 0;
+        uint16_t    rloc16;
+        uint16_t    version;
+        uint32_t    frameCounter;
+        uint8_t     linkMargin;
+        uint8_t     mode;
+        uint32_t    timeout;
+        OffsetRange offsetRange;
+
+        numFound += (Find<Mle::SourceAddressTlv>(aMessage, rloc16) == kErrorNone);
+        numFound += (Find<Mle::VersionTlv>(aMessage, version) == kErrorNone);
+        numFound += (Find<Mle::LinkFrameCounterTlv>(aMessage, frameCounter) == kErrorNone);
+        numFound += (Find<Mle::MleFrameCounterTlv>(aMessage, frameCounter) == kErrorNone);
+        numFound += (Find<Mle::LinkMarginTlv>(aMessage, linkMargin) == kErrorNone);
+        numFound += (Find<Mle::ModeTlv>(aMessage, mode) == kErrorNone);
+        numFound += (Find<Mle::TimeoutTlv>(aMessage, timeout) == kErrorNone);
+
+        for (uint8_t type : kTypes)
+        {
+            numFound += (FindTlvValueOffsetRange(aMessage, type, offsetRange) == kErrorNone);
+        }
+
+        return numFound;
+    }
+
+    template <typename TlvType, typename ValueType> static Error Find(const Message &aMessage, ValueType &aValue)
+    {
+        return Tlv::Find<TlvType>(aMessage, aValue);
+    }
+
+    template <typename TlvType, typename ValueType>
+    static Error Find(const Mle::Mle::RxMessage &aMessage, ValueType &aValue)
+    {
+        return aMessage.Find<TlvType>(aValue);
+    }
+
+    static Error FindTlvValueOffsetRange(const Message &aMessage, uint8_t aType, OffsetRange &aOffsetRange)
+    {
+        return Tlv::FindTlvValueOffsetRange(aMessage, aType, aOffsetRange);
+    }
+
+    static Error FindTlvValueOffsetRange(const Mle::Mle::RxMessage &aMessage,
+                                         uint8_t                    aType,
+                                         OffsetRange               &aOffsetRange)
+    {
+        return aMessage.FindTlvValueOffsetRange(aType, aOffsetRange);
+    }
+
+    static void TestRxTlvIndex(void)
+    {
+        static constexpr uint8_t  kNumParentResponseTlvs = 9;
+        static constexpr uint16_t kNumIterations         = 5000;
+
+        Instance             *instance = static_cast<Instance *>(testInitInstance());
+        Mle::Mle::RxTlvIndex *tlvIndex;
+        Message              *message;
+        Mle::Mle::RxMessage  *rxMessage;
+        uint8_t               linkMargin;
+        uint32_t              timeout;
+        OffsetRange           offsetRange;
+        OffsetRange           indexedOffsetRange;
+        TimeMilli             startTime;
+        uint32_t              duration;
+
+        printf("TestRxTlvIndex\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        tlvIndex = &instance->Get<Mle::Mle>().mRxTlvIndex;
+
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        rxMessage = static_cast<Mle::Mle::RxMessage *>(message);
+
+        SuccessOrQuit(message->Append<uint8_t>(Mle::kCommandParentResponse));
+        message->SetOffset(sizeof(uint8_t));
+        AppendParentResponseTlvs(*message);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Lookups using the index must match scanning the message.
+
+        tlvIndex->Build(*message);
+        VerifyOrQuit(tlvIndex->IsBuiltFor(*message));
+
+        for (uint16_t type = 0; type <= NumericLimits<uint8_t>::kMax; type++)
+        {
+            Error error = Tlv::FindTlvValueOffsetRange(*message, static_cast<uint8_t>(type), offsetRange);
+
+            VerifyOrQuit(rxMessage->FindTlvValueOffsetRange(static_cast<uint8_t>(type), indexedOffsetRange) == error);
+
+            if (error == kErrorNone)
+            {
+                VerifyOrQuit(indexedOffsetRange.GetOffset() == offsetRange.GetOffset());
+                VerifyOrQuit(indexedOffsetRange.GetLength() == offsetRange.GetLength());
+            }
+        }
+
+        // With duplicate TLVs, the first one is returned.
+
+        SuccessOrQuit(rxMessage->Find<Mle::LinkMarginTlv>(linkMargin));
+        VerifyOrQuit(linkMargin == 20);
+
+        VerifyOrQuit(LookUpParentResponseTlvs(*message) == kNumParentResponseTlvs);
+        VerifyOrQuit(LookUpParentResponseTlvs(*rxMessage) == kNumParentResponseTlvs);
+
+        // Changing the message invalidates the index and lookups
+        // fall back to scanning the message.
+
+        SuccessOrQuit(Tlv::Append<Mle::TimeoutTlv>(*message, 240));
+        VerifyOrQuit(!tlvIndex->IsBuiltFor(*message));
+        SuccessOrQuit(rxMessage->Find<Mle::TimeoutTlv>(timeout));
+        VerifyOrQuit(timeout == 240);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // More TLVs than the index can hold.
+
+        for (uint8_t count = 0; count < OPENTHREAD_CONFIG_MLE_RX_TLV_INDEX_SIZE; count++)
+        {
+            SuccessOrQuit(Tlv::Append<Mle::LinkMarginTlv>(*message, 40));
+        }
+
+        SuccessOrQuit(Tlv::Append<Mle::ModeTlv>(*message, 0x0f));
+
+        tlvIndex->Build(*message);
+        VerifyOrQuit(tlvIndex->IsBuiltFor(*message));
+
+        SuccessOrQuit(rxMessage->FindTlvValueOffsetRange(Mle::Tlv::kMode, indexedOffsetRange));
+        SuccessOrQuit(Tlv::FindTlvValueOffsetRange(*message, Mle::Tlv::kMode, offsetRange));
+        VerifyOrQuit(indexedOffsetRange.GetOffset() == offsetRange.GetOffset());
+        VerifyOrQuit(rxMessage->FindTlvValueOffsetRange(Mle::Tlv::kRoute, indexedOffsetRange) == kErrorNotFound);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // A malformed TLV ends the index, same as when scanning.
+
+        SuccessOrQuit(message->SetLength(sizeof(uint8_t)));
+        AppendParentResponseTlvs(*message);
+        SuccessOrQuit(Tlv::AppendTlv(*message, Mle::Tlv::kTimeout, &timeout, sizeof(timeout)));
+        message->Write(message->GetLength() - sizeof(timeout) - 1, static_cast<uint8_t>(sizeof(timeout) + 1));
+
+        tlvIndex->Build(*message);
+        VerifyOrQuit(rxMessage->Find<Mle::TimeoutTlv>(timeout) == kErrorNotFound);
+        VerifyOrQuit(Tlv::Find<Mle::TimeoutTlv>(*message, timeout) == kErrorNotFound);
+        VerifyOrQuit(LookUpParentResponseTlvs(*rxMessage) == kNumParentResponseTlvs);
+
+        printf(" -- PASS\n");
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Measure the time to handle the TLVs of a Parent Response.
+
+        SuccessOrQuit(message->SetLength(sizeof(uint8_t)));
+        AppendParentResponseTlvs(*message);
+        tlvIndex->Clear();
+
+        startTime = TimerMilli::GetNow();
+
+        for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+        {
+            VerifyOrQuit(LookUpParentResponseTlvs(*message) == kNumParentResponseTlvs);
+        }
+
+        duration = TimerMilli::GetNow() - startTime;
+        printf("Parent Response TLV lookups without index: %u in %lu msec\n", kNumIterations, ToUlong(duration));
+
+        startTime = TimerMilli::GetNow();
+
+        for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+        {
+            tlvIndex->Build(*message);
+            VerifyOrQuit(LookUpParentResponseTlvs(*rxMessage) == kNumParentResponseTlvs);
+        }
+
+        duration = TimerMilli::GetNow() - startTime;
+        printf("Parent Response TLV lookups with index:    %u in %lu msec\n", kNumIterations, ToUlong(duration));
+
+        tlvIndex->Clear();
+        message->Free();
+        testFreeInstance(instance);
+    }
+
 #if OPENTHREAD_FTD
     class TxChallenge : public Mle::TxChallenge
     {
@@ -504,6 +731,102 @@ public:
         testFreeInstance(instance);
         printf("TestTxChallengeTable passed\n");
     }
+
+    static void TestRouteUpdateCoalescing(void)
+    {
+        static constexpr uint8_t kNumRouters = 4;
+
+        Instance                               *instance = static_cast<Instance *>(testInitInstance());
+        Mle::Mle                               *mle;
+        RouterTable                            *routerTable;
+        Message                                *message;
+        Mle::RouteTlv::Data                     routeTlvData;
+        OffsetRange                             offsetRange;
+        const RouterTable::RouteUpdateCounters *counters;
+
+        printf("TestRouteUpdateCoalescing\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        mle         = &instance->Get<Mle::Mle>();
+        routerTable = &instance->Get<RouterTable>();
+        counters    = &routerTable->GetRouteUpdateCounters();
+
+        for (uint8_t index = 0; index < kNumRouters; index++)
+        {
+            VerifyOrQuit(routerTable->Allocate(index * 2) != nullptr);
+        }
+
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        AppendRouteTlvValue(*message, kNumRouters);
+        offsetRange.InitFromMessageFullLength(*message);
+        SuccessOrQuit(routeTlvData.ParseFrom(*message, offsetRange));
+        message->Free();
+
+        VerifyOrQuit(counters->mScheduled == 0);
+        VerifyOrQuit(counters->mReplaced == 0);
+        VerifyOrQuit(counters->mRecomputations == 0);
+
+        // Pending updates are dropped when not acting as a router.
+
+        routerTable->ScheduleRouteUpdate(routeTlvData, 2);
+        routerTable->ScheduleRouteUpdate(routeTlvData, 2);
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.GetLength() == 1);
+        VerifyOrQuit(counters->mScheduled == 2);
+        VerifyOrQuit(counters->mReplaced == 1);
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.IsEmpty());
+        VerifyOrQuit(counters->mRecomputations == 0);
+
+        // Updates from multiple neighbors are processed together.
+
+        mle->mRole = Mle::kRoleRouter;
+
+        for (uint8_t round = 0; round < 3; round++)
+        {
+            for (uint8_t index = 1; index < kNumRouters; index++)
+            {
+                routerTable->ScheduleRouteUpdate(routeTlvData, index * 2);
+            }
+        }
+
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.GetLength() == kNumRouters - 1);
+        VerifyOrQuit(counters->mScheduled == 2 + 3 * (kNumRouters - 1));
+        VerifyOrQuit(counters->mReplaced == 1 + 2 * (kNumRouters - 1));
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.IsEmpty());
+        VerifyOrQuit(counters->mRecomputations == 1);
+
+        // An immediate route update discards a pending one from the
+        // same neighbor.
+
+        routerTable->ScheduleRouteUpdate(routeTlvData, 2);
+        routerTable->UpdateRoutes(routeTlvData, 2);
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.IsEmpty());
+
+        // Scheduling from more neighbors than the batch size processes
+        // the pending ones immediately.
+
+        routerTable->Clear();
+
+        for (uint8_t routerId = 0; routerId <= OPENTHREAD_CONFIG_MLE_ROUTE_UPDATE_BATCH_SIZE; routerId++)
+        {
+            routerTable->ScheduleRouteUpdate(routeTlvData, routerId);
+        }
+
+        VerifyOrQuit(routerTable->mPendingRouteUpdates.GetLength() == 1);
+        VerifyOrQuit(counters->mRecomputations == 2);
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(counters->mRecomputations == 3);
+
+        mle->mRole = Mle::kRoleDisabled;
+
+        testFreeInstance(instance);
+        printf("TestRouteUpdateCoalescing passed\n");
+    }
 #endif // OPENTHREAD_FTD
 
 private:
@@ -564,7 +887,7 @@ private:
         aMle.Get<ThreadNetif>().AddUnicastAddress(aMle.mMeshLocalEid);
 
         parentCandidate.Clear();
-        parentCandidate.GetExtAddress() = aParentExtAddress;
+        parentCandidate.SetExtAddress(aParentExtAddress);
         parentCandidate.SetRloc16(aParentRloc16);
         parentCandidate.SetVersion(kThreadVersion);
         parentCandidate.SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeFullThreadDevice |
@@ -884,6 +1207,75 @@ void TestRouterIdMask(void)
     printf("TestRouterIdMask passed\n");
 }
 
+void TestRouteTlvParse(void)
+{
+    static constexpr uint16_t kMaxPadding    = 300;
+    static constexpr uint16_t kNumIterations = 20000;
+
+    Instance           *instance = static_cast<Instance *>(testInitInstance());
+    Message            *message;
+    Mle::RouteTlv::Data routeData;
+    OffsetRange         offsetRange;
+    TimeMilli           startTime;
+    uint8_t             numRouters = Mle::kMaxRouters;
+
+    VerifyOrQuit(instance != nullptr);
+
+    // Parse the route data at every offset so that it is either
+    // contiguous or straddles two message buffers.
+
+    for (uint16_t padding = 0; padding < kMaxPadding; padding++)
+    {
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        SuccessOrQuit(message->SetLength(padding));
+        AppendRouteTlvValue(*message, numRouters);
+
+        offsetRange.InitFromRange(padding, message->GetLength());
+        SuccessOrQuit(routeData.ParseFrom(*message, offsetRange));
+
+        VerifyOrQuit(routeData.GetRouterIdSequence() == numRouters);
+        VerifyOrQuit(routeData.GetEntries().GetLength() == numRouters);
+
+        for (uint8_t index = 0; index < numRouters; index++)
+        {
+            const Mle::RouteTlv::Data::Entry &entry = routeData.GetEntries()[index];
+
+            VerifyOrQuit(entry.GetRouterId() == index * 2);
+            VerifyOrQuit(entry.GetRouteCost() == index % 15);
+            VerifyOrQuit(entry.GetLinkQualityIn() == kLinkQuality3);
+            VerifyOrQuit(entry.GetLinkQualityOut() == kLinkQuality2);
+        }
+
+        // A truncated route data must fail to parse.
+
+        offsetRange.ShrinkLength(offsetRange.GetLength() - 1);
+        VerifyOrQuit(routeData.ParseFrom(*message, offsetRange) == kErrorParse);
+
+        message->Free();
+    }
+
+    printf("TestRouteTlvParse passed\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Benchmark parsing Route TLV with %u routers", numRouters);
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    AppendRouteTlvValue(*message, numRouters);
+    offsetRange.InitFromMessageFullLength(*message);
+
+    startTime = TimerMilli::GetNow();
+
+    for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        SuccessOrQuit(routeData.ParseFrom(*message, offsetRange));
+    }
+
+    printf(" -- %u parses in %lu msec -- PASS\n", kNumIterations, ToUlong(TimerMilli::GetNow() - startTime));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 #if OPENTHREAD_FTD
 void TestRouterTableRouterIdBounds(void)
 {
@@ -906,10 +1298,13 @@ int main(void)
 {
     ot::TestDeviceMode();
     ot::TestRouterIdMask();
+    ot::TestRouteTlvParse();
+    ot::UnitTester::TestRxTlvIndex();
     ot::UnitTester::TestChildIdResponseNetworkDataHandling();
 
 #if OPENTHREAD_FTD
     ot::UnitTester::TestTxChallengeTable();
+    ot::UnitTester::TestRouteUpdateCoalescing();
     ot::TestRouterTableRouterIdBounds();
 #endif
 
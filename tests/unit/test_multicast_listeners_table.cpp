@@ -32,6 +32,8 @@
 
 #include "test_platform.h"
 
+#include <sys/time.h>
+
 #include <openthread/config.h>
 #include <openthread/ip6.h>
 
@@ -44,6 +46,47 @@ namespace ot {
 
 using namespace ot::BackboneRouter;
 
+extern "C" {
+
+static uint32_t    sNow = 0;
+static uint32_t    sAlarmTime;
+static bool        sAlarmOn = false;
+static otInstance *sInstance;
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow = Max(sNow, sAlarmTime);
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
+static uint32_t GetWallClockMsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, nullptr);
+
+    return static_cast<uint32_t>((tv.tv_sec * 1000) + (tv.tv_usec / 1000));
+}
+
 void TestMulticastListenersTable(void)
 {
     static constexpr uint16_t kMaxSize = OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS;
@@ -120,13 +163,254 @@ void TestMulticastListenersTable(void)
 
         VerifyOrQuit(table->Has(address));
     }
+
+    // Remove every other entry (which moves entries within the table)
+    // and verify that the remaining entries are still found.
+
+    for (uint16_t i = 0; i < kMaxSize; i += 2)
+    {
+        Ip6::Address address;
+
+        address                = kMa401;
+        address.mFields.m16[7] = BigEndian::HostSwap16(i);
+
+        table->Remove(address);
+        VerifyOrQuit(!table->Has(address));
+    }
+
+    VerifyOrQuit(table->Count() == kMaxSize / 2);
+
+    for (uint16_t i = 0; i < kMaxSize; i++)
+    {
+        Ip6::Address address;
+
+        address                = kMa401;
+        address.mFields.m16[7] = BigEndian::HostSwap16(i);
+
+        VerifyOrQuit(table->Has(address) == ((i % 2) == 1));
+    }
+
+    // Re-add the removed entries with later expire times.
+
+    for (uint16_t i = 0; i < kMaxSize; i += 2)
+    {
+        Ip6::Address address;
+
+        address                = kMa401;
+        address.mFields.m16[7] = BigEndian::HostSwap16(i);
+
+        SuccessOrQuit(table->Add(address, now + i));
+        VerifyOrQuit(table->Has(address));
+    }
+
+    VerifyOrQuit(table->Count() == kMaxSize);
+
+    table->Clear();
+    VerifyOrQuit(table->Count() == 0);
+
+    testFreeInstance(instance);
+}
+
+void TestMulticastListenersTablePerformance(void)
+{
+    static constexpr uint16_t kMaxSize       = OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS;
+    static constexpr uint32_t kNumIterations = 2000;
+
+    MulticastListenersTable *table;
+    Instance                *instance;
+    Ip6::Address             address;
+    TimeMilli                now(0);
+    uint32_t                 startTime;
+    uint32_t                 duration;
+    uint32_t                 numFound = 0;
+
+    printf("TestMulticastListenersTablePerformance()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    table = &instance->Get<MulticastListenersTable>();
+
+    SuccessOrQuit(address.FromString("ff05::"));
+
+    for (uint16_t i = 0; i < kMaxSize; i++)
+    {
+        address.mFields.m16[7] = BigEndian::HostSwap16(i);
+        SuccessOrQuit(table->Add(address, now + i));
+    }
+
+    startTime = GetWallClockMsec();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        for (uint16_t i = 0; i < kMaxSize; i++)
+        {
+            address.mFields.m16[7] = BigEndian::HostSwap16(i);
+
+            if (table->Has(address))
+            {
+                numFound++;
+            }
+        }
+    }
+
+    duration = GetWallClockMsec() - startTime;
+
+    VerifyOrQuit(numFound == kNumIterations * kMaxSize);
+
+    printf("  %lu lookups over %u listeners took %lu msec\n", ToUlong(kNumIterations * kMaxSize), kMaxSize,
+           ToUlong(duration));
+
+    table->Clear();
+    testFreeInstance(instance);
 }
 
+class UnitTester
+{
+public:
+    static void TestMulticastListenersTableExpiry(void)
+    {
+        // Listener `i` uses address `ff05::i` and expires after
+        // `kExpireDelays[i]` msec. The delays are given in mixed
+        // order so entries are added at different heap positions.
+
+        static const uint32_t kExpireDelays[] = {5000, 1000, 9000, 3000, 7000, 2000, 8000, 4000, 6000, 10000};
+
+        static constexpr uint16_t kNumListeners = GetArrayLength(kExpireDelays);
+
+        static constexpr uint16_t kUpdatedListener    = 1; // Re-added with a later expire time.
+        static constexpr uint32_t kUpdatedDelay       = 11000;
+        static constexpr uint16_t kRemovedListeners[] = {0, 5};
+
+        // Expected expiry order after the update and removals above
+        // (sorted by expire delay).
+
+        static const uint16_t kExpectedOrder[] = {3, 7, 8, 4, 6, 2, 9, 1};
+
+        MulticastListenersTable *table;
+        Instance                *instance;
+        Ip6::Address             address;
+        uint32_t                 expireTimes[kNumListeners];
+
+        printf("TestMulticastListenersTableExpiry()\n");
+
+        sNow     = 0;
+        sAlarmOn = false;
+        instance = testInitInstance();
+        VerifyOrQuit(instance != nullptr);
+        sInstance = instance;
+
+        table = &instance->Get<MulticastListenersTable>();
+        table->SetCallback(HandleListenerEvent, nullptr);
+        sNumExpired = 0;
+
+        SuccessOrQuit(address.FromString("ff05::"));
+
+        for (uint16_t i = 0; i < kNumListeners; i++)
+        {
+            address.mFields.m16[7] = BigEndian::HostSwap16(i);
+            expireTimes[i]         = sNow + kExpireDelays[i];
+            SuccessOrQuit(table->Add(address, TimeMilli(expireTimes[i])));
+            VerifyOrQuit(table->mExpiryHeap.IsValid());
+        }
+
+        VerifyOrQuit(table->mExpiryHeap.GetLength() == kNumListeners);
+
+        // Move one listener to a later expire time.
+
+        address.mFields.m16[7]        = BigEndian::HostSwap16(kUpdatedListener);
+        expireTimes[kUpdatedListener] = sNow + kUpdatedDelay;
+        SuccessOrQuit(table->Add(address, TimeMilli(expireTimes[kUpdatedListener])));
+        VerifyOrQuit(table->mExpiryHeap.IsValid());
+        VerifyOrQuit(table->Count() == kNumListeners);
+
+        // Remove listeners. `RemoveAt()` moves the last listener into
+        // the freed slot, so check that the heap still refers to every
+        // remaining listener by its new index.
+
+        for (uint16_t removed : kRemovedListeners)
+        {
+            address.mFields.m16[7] = BigEndian::HostSwap16(removed);
+            table->Remove(address);
+            VerifyOrQuit(!table->Has(address));
+            VerifyOrQuit(table->mExpiryHeap.IsValid());
+            VerifyOrQuit(table->mExpiryHeap.GetLength() == table->Count());
+
+            for (uint16_t index = 0; index < table->Count(); index++)
+            {
+                VerifyOrQuit(table->mExpiryHeap.Contains(index));
+            }
+
+            VerifyOrQuit(!table->mExpiryHeap.Contains(table->Count()));
+        }
+
+        VerifyOrQuit(table->Count() == kNumListeners - GetArrayLength(kRemovedListeners));
+
+        // Advance time in steps and check that listeners expire one by
+        // one, in order of their expire time, and exactly at it.
+
+        sNumExpired = 0;
+
+        while (sNow <= kUpdatedDelay)
+        {
+            AdvanceTime(250);
+            VerifyOrQuit(table->mExpiryHeap.IsValid());
+            VerifyOrQuit(table->mExpiryHeap.GetLength() == table->Count());
+            VerifyOrQuit(table->Count() + sNumExpired == GetArrayLength(kExpectedOrder));
+        }
+
+        VerifyOrQuit(table->Count() == 0);
+        VerifyOrQuit(sNumExpired == GetArrayLength(kExpectedOrder));
+
+        for (uint16_t i = 0; i < sNumExpired; i++)
+        {
+            uint16_t listener = kExpectedOrder[i];
+
+            VerifyOrQuit(BigEndian::HostSwap16(sExpired[i].mAddress.mFields.m16[7]) == listener);
+            VerifyOrQuit(sExpired[i].mTime == expireTimes[listener]);
+        }
+
+        testFreeInstance(instance);
+    }
+
+private:
+    struct ExpiredListener
+    {
+        Ip6::Address mAddress;
+        uint32_t     mTime;
+    };
+
+    static void HandleListenerEvent(void                                  *aContext,
+                                    otBackboneRouterMulticastListenerEvent aEvent,
+                                    const otIp6Address                    *aAddress)
+    {
+        OT_UNUSED_VARIABLE(aContext);
+
+        VerifyOrExit(aEvent == OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED);
+        VerifyOrQuit(sNumExpired < GetArrayLength(sExpired));
+
+        sExpired[sNumExpired].mAddress = AsCoreType(aAddress);
+        sExpired[sNumExpired].mTime    = sNow;
+        sNumExpired++;
+
+    exit:
+        return;
+    }
+
+    static ExpiredListener sExpired[OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS];
+    static uint16_t        sNumExpired;
+};
+
+UnitTester::ExpiredListener UnitTester::sExpired[OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS];
+uint16_t                    UnitTester::sNumExpired;
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMulticastListenersTable();
+    ot::TestMulticastListenersTablePerformance();
+    ot::UnitTester::TestMulticastListenersTableExpiry();
     printf("\nAll tests passed.\n");
     return 0;
 }
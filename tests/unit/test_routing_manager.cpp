@@ -3404,6 +3404,143 @@ void TestPrefixStaleTime(void)
     FinalizeTest();
 }
 
+uint16_t CountRoutePrefixesInTable(void)
+{
+    BorderRouter::PrefixTableIterator iter;
+    BorderRouter::PrefixTableEntry    entry;
+    uint16_t                          count = 0;
+
+    sInstance->Get<BorderRouter::RxRaTracker>().InitIterator(iter);
+
+    while (sInstance->Get<BorderRouter::RxRaTracker>().GetNextPrefixTableEntry(iter, entry) == kErrorNone)
+    {
+        if (!entry.mIsOnLink)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void TestManyRoutersAndPrefixes(void)
+{
+    // Stress test with many routers each advertising many route
+    // prefixes. Half of the prefixes are shared by all routers (with
+    // a different lifetime from each router) and half are unique to
+    // each router.
+
+    static constexpr uint16_t kNumRouters           = 50;
+    static constexpr uint16_t kNumSharedPrefixes    = 10;
+    static constexpr uint16_t kNumUniquePrefixes    = 10;
+    static constexpr uint32_t kUniquePrefixLifetime = 2000;
+
+    Ip6::Prefix  localOnLink;
+    Ip6::Prefix  localOmr;
+    Ip6::Address routerAddresses[kNumRouters];
+    uint16_t     heapAllocations;
+    char         string[Ip6::Address::kInfoStringSize];
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestManyRoutersAndPrefixes");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager. Check emitted RS and RA messages.
+
+    sRsEmitted   = false;
+    sRaValidated = false;
+    sExpectedPio = kPioAdvertisingLocalOnLink;
+    sExpectedRios.Clear();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOnLinkPrefix(localOnLink));
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOmrPrefix(localOmr));
+
+    sExpectedRios.Add(localOmr);
+
+    AdvanceTime(30000);
+
+    VerifyOrQuit(sRsEmitted);
+    VerifyOrQuit(sRaValidated);
+    VerifyOrQuit(sExpectedRios.SawAll());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send an RA from every router. Router `r` advertises the shared
+    // prefixes with lifetime `100 + 10 * r` seconds, so the last
+    // router has the longest lifetime (590 seconds).
+
+    for (uint16_t r = 0; r < kNumRouters; r++)
+    {
+        Ip6::Nd::RouterAdvert::TxMessage raMsg;
+        Ip6::Nd::RouterAdvert::Header    header;
+        Icmp6Packet                      packet;
+
+        snprintf(string, sizeof(string), "fd00::%x", r + 1);
+        routerAddresses[r] = AddressFromString(string);
+
+        header.SetRouterLifetime(0);
+        SuccessOrQuit(raMsg.Append(header));
+
+        for (uint16_t i = 0; i < kNumSharedPrefixes; i++)
+        {
+            snprintf(string, sizeof(string), "2002:db8:0:%x::", i);
+            SuccessOrQuit(raMsg.AppendRouteInfoOption(PrefixFromString(string, 64), 100 + 10 * r,
+                                                      NetworkData::kRoutePreferenceMedium));
+        }
+
+        for (uint16_t i = 0; i < kNumUniquePrefixes; i++)
+        {
+            snprintf(string, sizeof(string), "2001:db8:%x:%x::", r, i);
+            SuccessOrQuit(raMsg.AppendRouteInfoOption(PrefixFromString(string, 64), kUniquePrefixLifetime,
+                                                      NetworkData::kRoutePreferenceMedium));
+        }
+
+        raMsg.GetAsPacket(packet);
+        SendRouterAdvert(routerAddresses[r], packet);
+    }
+
+    AdvanceTime(10);
+
+    VerifyOrQuit(CountRoutePrefixesInTable() == kNumRouters * (kNumSharedPrefixes + kNumUniquePrefixes));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait until only the shared prefix entries from the last router
+    // remain. The stale time of a shared prefix is the latest among
+    // all routers, so no RS should be sent yet.
+
+    sRsEmitted = false;
+
+    AdvanceTime(585 * 1000);
+
+    VerifyOrQuit(!sRsEmitted);
+    VerifyOrQuit(CountRoutePrefixesInTable() == kNumRouters * kNumUniquePrefixes + kNumSharedPrefixes);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait past the 590-second stale time of the shared prefixes and
+    // check that RS messages are emitted and that all entries are
+    // removed since no router responds.
+
+    AdvanceTime(30 * 1000);
+
+    VerifyOrQuit(sRsEmitted);
+
+    VerifyPrefixTableIsEmpty();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestManyRoutersAndPrefixes");
+    FinalizeTest();
+}
+
 void TestRouterNsProbe(void)
 {
     Ip6::Prefix  localOnLink;
@@ -5421,6 +5558,285 @@ void TestRdnss(void)
     FinalizeTest();
 }
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
+class UnitTester
+{
+public:
+    static bool CheckReachability(const Ip6::Address &aSource, const Ip6::Address &aDestination, bool aExpectCacheHit)
+    {
+        // Runs the reachability check for a packet forwarded from
+        // `aSource` to `aDestination` and validates whether it was
+        // answered from the cache. Returns whether an ICMPv6 error is
+        // sent, as read back from the cache entry.
+
+        BorderRouter::RoutingManager &routingManager = sInstance->Get<BorderRouter::RoutingManager>();
+        otBorderRoutingReachabilityCacheCounters counters = routingManager.GetReachabilityCacheCounters();
+        Ip6::Header                              header;
+        Ip6::UdpHeader                           udpHeader;
+        Message                                 *message;
+        bool                                     shouldSendError;
+
+        header.InitVersionTrafficClassFlow();
+        header.SetPayloadLength(sizeof(udpHeader));
+        header.SetNextHeader(Ip6::kProtoUdp);
+        header.SetHopLimit(64);
+        header.SetSource(aSource);
+        header.SetDestination(aDestination);
+
+        udpHeader.Clear();
+        udpHeader.SetSourcePort(49152);
+        udpHeader.SetDestinationPort(49153);
+        udpHeader.SetLength(sizeof(udpHeader));
+
+        message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->Append(udpHeader));
+
+        routingManager.CheckReachabilityToSendIcmpError(*message, header);
+        message->Free();
+
+        if (aExpectCacheHit)
+        {
+            VerifyOrQuit(routingManager.GetReachabilityCacheCounters().mHits == counters.mHits + 1);
+            VerifyOrQuit(routingManager.GetReachabilityCacheCounters().mMisses == counters.mMisses);
+        }
+        else
+        {
+            VerifyOrQuit(routingManager.GetReachabilityCacheCounters().mHits == counters.mHits);
+            VerifyOrQuit(routingManager.GetReachabilityCacheCounters().mMisses == counters.mMisses + 1);
+        }
+
+        VerifyOrQuit(routingManager.mReachabilityCache.Find(header, shouldSendError));
+
+        return shouldSendError;
+    }
+
+    static bool IsInReachabilityCache(const Ip6::Address &aSource, const Ip6::Address &aDestination)
+    {
+        Ip6::Header header;
+        bool        shouldSendError;
+
+        header.Clear();
+        header.SetSource(aSource);
+        header.SetDestination(aDestination);
+
+        return sInstance->Get<BorderRouter::RoutingManager>().mReachabilityCache.Find(header, shouldSendError);
+    }
+
+    static bool AddressMatchesLocalOnLinkPrefix(const Ip6::Address &aAddress)
+    {
+        return sInstance->Get<BorderRouter::RoutingManager>().mOnLinkPrefixManager.AddressMatchesLocalPrefix(aAddress);
+    }
+};
+
+uint32_t GetReachabilityCacheInvalidations(void)
+{
+    return otBorderRoutingGetReachabilityCacheCounters(sInstance)->mInvalidations;
+}
+
+void TestReachabilityCache(void)
+{
+    static constexpr uint32_t kMaxDeprecationTime = 2 * kValidLitime; // In seconds
+
+    static const otExtendedPanId kExtPanId = {{0x12, 0x34, 0x56, 0x78, 0x9a, 0xab, 0xcd, 0xef}};
+
+    Ip6::Prefix          localOnLink;
+    Ip6::Prefix          localOmr;
+    Ip6::Prefix          routePrefix    = PrefixFromString("2001:db8:1::", 48);
+    Ip6::Prefix          onLinkPrefix   = PrefixFromString("fd00:abba:baba::", 64);
+    Ip6::Prefix          omrPrefix      = PrefixFromString("fd00:7777:7777::", 64);
+    Ip6::Address         routerAddressA = AddressFromString("fd00::aaaa");
+    Ip6::Address         routedDest     = AddressFromString("2001:db8:1::1");
+    Ip6::Address         otherDest      = AddressFromString("2001:db8:2::1");
+    Ip6::Address         omrSource      = AddressFromString("::1");
+    Ip6::Address         otherSource    = AddressFromString("::2");
+    Ip6::Address         onLinkDest     = AddressFromString("::3");
+    otOperationalDataset dataset;
+    uint32_t             invalidations;
+    uint32_t             duration;
+    uint16_t             heapAllocations;
+
+    NetworkData::OnMeshPrefixConfig prefixConfig;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestReachabilityCache");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager. Check emitted RS and RA messages.
+
+    sRsEmitted   = false;
+    sRaValidated = false;
+    sExpectedPio = kPioAdvertisingLocalOnLink;
+    sExpectedRios.Clear();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOnLinkPrefix(localOnLink));
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOmrPrefix(localOmr));
+
+    Log("Local on-link prefix is %s", localOnLink.ToString().AsCString());
+    Log("Local OMR prefix is %s", localOmr.ToString().AsCString());
+
+    sExpectedRios.Add(localOmr);
+
+    AdvanceTime(30000);
+
+    VerifyOrQuit(sRsEmitted);
+    VerifyOrQuit(sRaValidated);
+    VerifyOrQuit(sExpectedRios.SawAll());
+
+    VerifyOmrPrefixInNetData(localOmr, /* aDefaultRoute */ false);
+
+    omrSource.SetPrefix(localOmr);
+    otherSource.SetPrefix(omrPrefix);
+    onLinkDest.SetPrefix(localOnLink);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // A packet from the local ULA OMR prefix (low preference) to an
+    // unknown destination is unreachable. The first check is a cache
+    // miss and the second one is answered from the cache.
+
+    otBorderRoutingResetReachabilityCacheCounters(sInstance);
+
+    VerifyOrQuit(UnitTester::CheckReachability(omrSource, routedDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(UnitTester::CheckReachability(omrSource, routedDest, /* aExpectCacheHit */ true));
+
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ true));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // `RxRaTracker::Evaluate()`: Send an RA from router A with a route
+    // prefix covering the destination. The destination is now
+    // reachable.
+
+    invalidations = GetReachabilityCacheInvalidations();
+
+    SendRouterAdvert(routerAddressA, {Rio(routePrefix, kRioValidLifetime, NetworkData::kRoutePreferenceMedium)});
+    AdvanceTime(10);
+
+    VerifyPrefixTable(
+        {RoutePrefix(routePrefix, kRioValidLifetime, NetworkData::kRoutePreferenceMedium, routerAddressA)});
+
+    VerifyOrQuit(GetReachabilityCacheInvalidations() > invalidations);
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, routedDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, routedDest, /* aExpectCacheHit */ true));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Local on-link prefix change: Change the extended PAN ID. The
+    // destination in the old local on-link prefix is no longer
+    // considered on-link.
+
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+
+    invalidations = GetReachabilityCacheInvalidations();
+
+    SuccessOrQuit(otDatasetGetActive(sInstance, &dataset));
+    dataset.mExtendedPanId = kExtPanId;
+    SuccessOrQuit(otDatasetSetActive(sInstance, &dataset));
+
+    AdvanceTime(500);
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOnLinkPrefix(localOnLink));
+    Log("Local on-link prefix changed to %s", localOnLink.ToString().AsCString());
+    VerifyOrQuit(!onLinkDest.MatchesPrefix(localOnLink));
+
+    VerifyOrQuit(GetReachabilityCacheInvalidations() > invalidations);
+    VerifyOrQuit(UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+
+    onLinkDest.SetPrefix(localOnLink);
+
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ true));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // `OnLinkPrefixManager::SetState()`: Send an RA from router A
+    // with an on-link prefix favored over the local one, so that the
+    // local on-link prefix is deprecated. Keep the cache populated
+    // until the local prefix expires and its state becomes idle. The
+    // check right after must not use the cached answer.
+
+    sExpectedPio = kPioDeprecatingLocalOnLink;
+
+    SendRouterAdvert(routerAddressA, {Pio(onLinkPrefix, kInfiniteLifetime, kInfiniteLifetime)});
+    AdvanceTime(10);
+
+    VerifyOrQuit(UnitTester::AddressMatchesLocalOnLinkPrefix(onLinkDest));
+
+    for (duration = 0; UnitTester::AddressMatchesLocalOnLinkPrefix(onLinkDest); duration++)
+    {
+        VerifyOrQuit(duration < kMaxDeprecationTime);
+
+        if (!UnitTester::IsInReachabilityCache(omrSource, onLinkDest))
+        {
+            VerifyOrQuit(!UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+        }
+
+        AdvanceTime(1000);
+    }
+
+    Log("Local on-link prefix expired after %lu sec", ToUlong(duration));
+
+    VerifyOrQuit(UnitTester::CheckReachability(omrSource, onLinkDest, /* aExpectCacheHit */ false));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Network Data change: Add a new ULA OMR prefix with low
+    // preference. A source from this prefix now needs an error.
+
+    VerifyOrQuit(!UnitTester::CheckReachability(otherSource, otherDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(!UnitTester::CheckReachability(otherSource, otherDest, /* aExpectCacheHit */ true));
+
+    invalidations = GetReachabilityCacheInvalidations();
+
+    prefixConfig.Clear();
+    prefixConfig.mPrefix       = omrPrefix;
+    prefixConfig.mStable       = true;
+    prefixConfig.mSlaac        = true;
+    prefixConfig.mPreferred    = true;
+    prefixConfig.mOnMesh       = true;
+    prefixConfig.mDefaultRoute = false;
+    prefixConfig.mPreference   = NetworkData::kRoutePreferenceLow;
+
+    SuccessOrQuit(otBorderRouterAddOnMeshPrefix(sInstance, &prefixConfig));
+    SuccessOrQuit(otBorderRouterRegister(sInstance));
+
+    AdvanceTime(100);
+
+    VerifyOrQuit(GetReachabilityCacheInvalidations() > invalidations);
+    VerifyOrQuit(UnitTester::CheckReachability(otherSource, otherDest, /* aExpectCacheHit */ false));
+    VerifyOrQuit(UnitTester::CheckReachability(otherSource, otherDest, /* aExpectCacheHit */ true));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // `RxRaTracker::Stop()`: Disable Routing Manager. The cache
+    // entries must be removed.
+
+    VerifyOrQuit(UnitTester::IsInReachabilityCache(otherSource, otherDest));
+
+    invalidations = GetReachabilityCacheInvalidations();
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+
+    VerifyOrQuit(GetReachabilityCacheInvalidations() > invalidations);
+    VerifyOrQuit(!UnitTester::IsInReachabilityCache(otherSource, otherDest));
+
+    SuccessOrQuit(otBorderRouterRemoveOnMeshPrefix(sInstance, &omrPrefix));
+    SuccessOrQuit(otBorderRouterRegister(sInstance));
+
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestReachabilityCache");
+
+    FinalizeTest();
+}
+
+#endif // OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 } // namespace ot
@@ -5439,6 +5855,7 @@ int main(void)
     ot::TestExtPanIdChange();
     ot::TestConflictingPrefix();
     ot::TestPrefixStaleTime();
+    ot::TestManyRoutersAndPrefixes();
     ot::TestRouterNsProbe();
     ot::TestLearningAndCopyingOfFlags();
     ot::TestLearnRaHeader();
@@ -5456,6 +5873,9 @@ int main(void)
     ot::TestDhcp6PdConflict();
 #endif
     ot::TestRdnss();
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_REACHABILITY_CHECK_ICMP6_ERROR_ENABLE
+    ot::TestReachabilityCache();
+#endif
 
     printf("All tests passed\n");
 #else
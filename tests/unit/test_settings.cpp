@@ -0,0 +1,536 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include <string.h>
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "common/settings.hpp"
+#include "instance/instance.hpp"
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+
+namespace ot {
+
+static constexpr uint16_t kMaxStoreEntries = 16;
+static constexpr uint16_t kMaxValueLength  = 256;
+static constexpr uint16_t kMaxOperations   = 16;
+
+enum OperationType : uint8_t
+{
+    kOpSet,
+    kOpAdd,
+    kOpDelete,
+};
+
+struct Operation
+{
+    OperationType mType;
+    uint16_t      mKey;
+};
+
+struct StoreEntry
+{
+    bool     mInUse;
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t  mValue[kMaxValueLength];
+};
+
+static uint32_t   sNow = 0;
+static uint32_t   sAlarmTime;
+static bool       sAlarmOn = false;
+static Instance  *sInstance;
+static StoreEntry sStore[kMaxStoreEntries];
+static Operation  sOperations[kMaxOperations];
+static uint16_t   sNumOperations;
+
+static void RecordOperation(OperationType aType, uint16_t aKey)
+{
+    VerifyOrQuit(sNumOperations < kMaxOperations);
+
+    sOperations[sNumOperations].mType = aType;
+    sOperations[sNumOperations].mKey  = aKey;
+    sNumOperations++;
+}
+
+static StoreEntry *FindStoreEntry(uint16_t aKey)
+{
+    StoreEntry *match = nullptr;
+
+    for (StoreEntry &entry : sStore)
+    {
+        if (entry.mInUse && (entry.mKey == aKey))
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+otError otPlatSettingsGet(otInstance *, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    // Only the first entry of a key is kept. Values added with
+    // `otPlatSettingsAdd()` are only recorded.
+
+    otError     error = OT_ERROR_NONE;
+    StoreEntry *entry = FindStoreEntry(aKey);
+
+    VerifyOrExit((entry != nullptr) && (aIndex == 0), error = OT_ERROR_NOT_FOUND);
+
+    if (aValueLength != nullptr)
+    {
+        if (aValue != nullptr)
+        {
+            memcpy(aValue, entry->mValue, Min(*aValueLength, entry->mLength));
+        }
+
+        *aValueLength = entry->mLength;
+    }
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsSet(otInstance *, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    otError     error = OT_ERROR_NONE;
+    StoreEntry *entry = FindStoreEntry(aKey);
+
+    VerifyOrQuit(aValueLength <= kMaxValueLength);
+
+    RecordOperation(kOpSet, aKey);
+
+    if (entry == nullptr)
+    {
+        for (StoreEntry &unused : sStore)
+        {
+            if (!unused.mInUse)
+            {
+                entry = &unused;
+                break;
+            }
+        }
+
+        VerifyOrExit(entry != nullptr, error = OT_ERROR_NO_BUFS);
+    }
+
+    entry->mInUse  = true;
+    entry->mKey    = aKey;
+    entry->mLength = aValueLength;
+    memcpy(entry->mValue, aValue, aValueLength);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsAdd(otInstance *, uint16_t aKey, const uint8_t *, uint16_t)
+{
+    RecordOperation(kOpAdd, aKey);
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsDelete(otInstance *, uint16_t aKey, int aIndex)
+{
+    StoreEntry *entry = FindStoreEntry(aKey);
+
+    RecordOperation(kOpDelete, aKey);
+
+    if ((entry != nullptr) && (aIndex <= 0))
+    {
+        entry->mInUse = false;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+void otPlatSettingsWipe(otInstance *) { memset(sStore, 0, sizeof(sStore)); }
+
+} // extern "C"
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow = Max(sNow, sAlarmTime);
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
+static void ClearOperations(void) { sNumOperations = 0; }
+
+static void VerifyOperations(const Operation *aOperations, uint16_t aNumOperations)
+{
+    VerifyOrQuit(sNumOperations == aNumOperations);
+
+    for (uint16_t i = 0; i < aNumOperations; i++)
+    {
+        VerifyOrQuit(sOperations[i].mType == aOperations[i].mType);
+        VerifyOrQuit(sOperations[i].mKey == aOperations[i].mKey);
+    }
+
+    ClearOperations();
+}
+
+static void VerifyNoOperations(void) { VerifyOrQuit(sNumOperations == 0); }
+
+static void VerifyStoredParentInfo(const Settings::ParentInfo &aParentInfo)
+{
+    StoreEntry *entry = FindStoreEntry(Settings::kKeyParentInfo);
+
+    VerifyOrQuit(entry != nullptr);
+    VerifyOrQuit(entry->mLength == sizeof(aParentInfo));
+    VerifyOrQuit(memcmp(entry->mValue, &aParentInfo, sizeof(aParentInfo)) == 0);
+}
+
+static void InitParentInfo(Settings::ParentInfo &aParentInfo, uint8_t aSeed)
+{
+    Mac::ExtAddress extAddress;
+
+    memset(&extAddress, aSeed, sizeof(extAddress));
+
+    aParentInfo.Init();
+    aParentInfo.SetExtAddress(extAddress);
+}
+
+void TestWriteBehindCoalescing(void)
+{
+    static constexpr uint32_t kWindow = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW;
+
+    static const Operation kFlush[] = {{kOpSet, Settings::kKeyParentInfo}};
+
+    Settings                            &settings = sInstance->Get<Settings>();
+    const Settings::WriteBehindCounters &counters = settings.GetWriteBehindCounters();
+    Settings::WriteBehindCounters        oldCounters;
+    Settings::ParentInfo                 parentInfo1;
+    Settings::ParentInfo                 parentInfo2;
+    Settings::ParentInfo                 readParentInfo;
+
+    printf("TestWriteBehindCoalescing\n");
+
+    InitParentInfo(parentInfo1, 0x11);
+    InitParentInfo(parentInfo2, 0x22);
+
+    ClearOperations();
+    oldCounters = counters;
+
+    // Save `ParentInfo` twice. Both saves are queued and the second
+    // one replaces the first. Reads return the queued value.
+
+    settings.Save(parentInfo1);
+    VerifyNoOperations();
+    SuccessOrQuit(settings.Read(readParentInfo));
+    VerifyOrQuit(memcmp(&readParentInfo, &parentInfo1, sizeof(readParentInfo)) == 0);
+
+    AdvanceTime(kWindow / 2);
+
+    settings.Save(parentInfo2);
+    VerifyNoOperations();
+    SuccessOrQuit(settings.Read(readParentInfo));
+    VerifyOrQuit(memcmp(&readParentInfo, &parentInfo2, sizeof(readParentInfo)) == 0);
+
+    VerifyOrQuit(counters.mQueuedWrites == oldCounters.mQueuedWrites + 2);
+    VerifyOrQuit(counters.mCoalescedWrites == oldCounters.mCoalescedWrites + 1);
+    VerifyOrQuit(counters.mFlushedWrites == oldCounters.mFlushedWrites);
+
+    // The window starts at the first queued save. The timer flushes
+    // a single write with the last saved value.
+
+    AdvanceTime(kWindow / 2 - 1);
+    VerifyNoOperations();
+
+    AdvanceTime(1);
+    VerifyOperations(kFlush, GetArrayLength(kFlush));
+    VerifyStoredParentInfo(parentInfo2);
+    VerifyOrQuit(counters.mFlushedWrites == oldCounters.mFlushedWrites + 1);
+
+    // Saving the same value again is a no-op.
+
+    settings.Save(parentInfo2);
+    AdvanceTime(kWindow);
+    VerifyNoOperations();
+}
+
+void TestWriteBehindFlushOnReset(void)
+{
+    static const Operation kFlush[] = {{kOpSet, Settings::kKeyParentInfo}};
+
+    Settings            &settings = sInstance->Get<Settings>();
+    Settings::ParentInfo parentInfo;
+
+    printf("TestWriteBehindFlushOnReset\n");
+
+    InitParentInfo(parentInfo, 0x33);
+
+    ClearOperations();
+
+    settings.Save(parentInfo);
+    VerifyNoOperations();
+
+    sInstance->Reset();
+    VerifyOperations(kFlush, GetArrayLength(kFlush));
+    VerifyStoredParentInfo(parentInfo);
+
+    // The flush stops the timer, so nothing is written again.
+
+    AdvanceTime(OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW);
+    VerifyNoOperations();
+}
+
+void TestWriteBehindOrdering(void)
+{
+    static constexpr uint32_t kWindow = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_WINDOW;
+
+    Settings             &settings = sInstance->Get<Settings>();
+    Settings::NetworkInfo networkInfo;
+    Settings::ParentInfo  parentInfo;
+
+    printf("TestWriteBehindOrdering\n");
+
+    ClearOperations();
+
+    // The first save of `NetworkInfo` has no previous value to
+    // compare the frame counters with and is written through.
+
+    networkInfo.Init();
+    networkInfo.SetRole(Mle::kRoleChild);
+    networkInfo.SetKeySequence(1);
+    networkInfo.SetMleFrameCounter(100);
+    networkInfo.SetMacFrameCounter(200);
+
+    settings.Save(networkInfo);
+
+    {
+        static const Operation kOperations[] = {{kOpSet, Settings::kKeyNetworkInfo}};
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+
+    // Queue `NetworkInfo` (same counters) then `ParentInfo`. A later
+    // `NetworkInfo` save must not overtake the queued `ParentInfo`,
+    // so the queue is flushed in save order and the new value is
+    // queued again.
+
+    networkInfo.SetRloc16(0x1001);
+    settings.Save(networkInfo);
+
+    InitParentInfo(parentInfo, 0x44);
+    settings.Save(parentInfo);
+    VerifyNoOperations();
+
+    networkInfo.SetRloc16(0x1002);
+    settings.Save(networkInfo);
+
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyNetworkInfo},
+            {kOpSet, Settings::kKeyParentInfo},
+        };
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+
+    AdvanceTime(kWindow);
+
+    {
+        static const Operation kOperations[] = {{kOpSet, Settings::kKeyNetworkInfo}};
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+
+    // A frame counter update is written through. The queued
+    // `ParentInfo` is written first.
+
+    InitParentInfo(parentInfo, 0x55);
+    settings.Save(parentInfo);
+    VerifyNoOperations();
+
+    networkInfo.SetMleFrameCounter(1100);
+    settings.Save(networkInfo);
+
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyParentInfo},
+            {kOpSet, Settings::kKeyNetworkInfo},
+        };
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+
+    // Deletes and multi-value entries go straight to the store and
+    // flush the queue first.
+
+    InitParentInfo(parentInfo, 0x66);
+    settings.Save(parentInfo);
+    VerifyNoOperations();
+
+#if OPENTHREAD_FTD
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyParentInfo},
+            {kOpAdd, Settings::kKeyChildInfo},
+        };
+
+        Settings::ChildInfo childInfo;
+
+        childInfo.Init();
+        SuccessOrQuit(settings.AddChildInfo(childInfo));
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+#else
+    settings.Flush();
+    ClearOperations();
+#endif
+
+    InitParentInfo(parentInfo, 0x77);
+    settings.Save(parentInfo);
+    VerifyNoOperations();
+
+    settings.Delete<Settings::NetworkInfo>();
+
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyParentInfo},
+            {kOpDelete, Settings::kKeyNetworkInfo},
+        };
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+
+    AdvanceTime(kWindow);
+    VerifyNoOperations();
+}
+
+void TestWriteBehindIdentityKeys(void)
+{
+    // Identity keys are written through. A queued save is written
+    // first to keep the save order.
+
+    Settings            &settings = sInstance->Get<Settings>();
+    Settings::ParentInfo parentInfo;
+
+    printf("TestWriteBehindIdentityKeys\n");
+
+    ClearOperations();
+
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyParentInfo},
+            {kOpSet, Settings::kKeySlaacIidSecretKey},
+        };
+
+        Ip6::Slaac::IidSecretKey secretKey;
+
+        InitParentInfo(parentInfo, 0x88);
+        settings.Save(parentInfo);
+        VerifyNoOperations();
+
+        memset(&secretKey, 0x5a, sizeof(secretKey));
+        settings.Save<Settings::SlaacIidSecretKey>(secretKey);
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    {
+        static const Operation kOperations[] = {
+            {kOpSet, Settings::kKeyParentInfo},
+            {kOpSet, Settings::kKeyBrUlaPrefix},
+        };
+
+        Ip6::Prefix prefix;
+
+        InitParentInfo(parentInfo, 0x99);
+        settings.Save(parentInfo);
+        VerifyNoOperations();
+
+        SuccessOrQuit(prefix.FromString("fd00:1234:5678::/48"));
+        settings.Save<Settings::BrUlaPrefix>(prefix);
+
+        VerifyOperations(kOperations, GetArrayLength(kOperations));
+    }
+#endif
+
+    OT_UNUSED_VARIABLE(settings);
+    OT_UNUSED_VARIABLE(parentInfo);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != nullptr);
+
+    ot::TestWriteBehindCoalescing();
+    ot::TestWriteBehindFlushOnReset();
+    ot::TestWriteBehindOrdering();
+    ot::TestWriteBehindIdentityKeys();
+
+    testFreeInstance(ot::sInstance);
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else
+
+int main(void)
+{
+    printf("SETTINGS_WRITE_BEHIND feature is not enabled\n");
+    return 0;
+}
+
+#endif // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
@@ -66,3 +66,13 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+void PrintThroughput(const char *aName, uint32_t aNumBytes, uint32_t aDuration)
+{
+    // Bytes per msec is the same as KB/s, divide by 1000 to get MB/s.
+    uint32_t bytesPerMsec = aNumBytes / ((aDuration > 0) ? aDuration : 1);
+
+    printf("\n  %s: %lu bytes in %lu msec, %lu.%03lu MB/s", aName, static_cast<unsigned long>(aNumBytes),
+           static_cast<unsigned long>(aDuration), static_cast<unsigned long>(bytesPerMsec / 1000),
+           static_cast<unsigned long>(bytesPerMsec % 1000));
+}
@@ -42,4 +42,13 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * Prints the throughput of a benchmark to screen.
+ *
+ * @param[in] aName      A name describing the measured operation.
+ * @param[in] aNumBytes  Number of bytes processed.
+ * @param[in] aDuration  Duration of the operation in msec.
+ */
+void PrintThroughput(const char *aName, uint32_t aNumBytes, uint32_t aDuration);
+
 #endif // OT_UNIT_TEST_UTIL_HPP_
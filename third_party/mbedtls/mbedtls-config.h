@@ -104,6 +104,9 @@
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE || OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 #define MBEDTLS_SSL_COOKIE_C
 #define MBEDTLS_SSL_SRV_C
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_CACHE_SIZE > 0
+#define MBEDTLS_SSL_CACHE_C
+#endif
 #endif
 
 #if OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
@@ -55,6 +55,10 @@
  * themselves part of an intrusive linked list. TCPlp hardcodes the congestion
  * control algorithm to New Reno, so the fields corresponding to maintaining
  * the global linked list are removed.
+ *
+ * The algorithm is now selected per tcpcb through a small identifier in
+ * struct cc_state (see CC_ALGO below), which keeps the tcpcb free of pointers
+ * to congestion control modules.
  */
 
 #ifndef TCPLP_NETINET_CC_H_
@@ -64,6 +68,25 @@
 #include "tcp.h"
 
 extern const struct cc_algo newreno_cc_algo;
+extern const struct cc_algo rttgrad_cc_algo;
+
+/* Congestion control algorithm identifiers, stored in cc_state.algo. */
+#define	TCP_CC_NEWRENO		0	/* RFC 5681 New Reno (default). */
+#define	TCP_CC_RTTGRAD		1	/* RTT-gradient, loss-differentiating. */
+
+/*
+ * Per-connection state for the congestion control algorithms. This is stored
+ * inline in the tcpcb (FreeBSD would allocate it in cb_init and hang it off
+ * cc_data) since TCPlp does not allocate memory dynamically.
+ */
+struct cc_state {
+	uint8_t		algo;		/* TCP_CC_* identifier. */
+	uint8_t		rising_rounds;	/* # consecutive rounds with RTT growth. */
+	uint16_t	ignored_losses;	/* # losses not treated as congestion. */
+	tcp_seq		round_end;	/* snd_max when the current round began. */
+	int32_t		round_srtt;	/* t_srtt at the start of the round. */
+	int32_t		gradient;	/* Smoothed per-round change in t_srtt. */
+};
 
 /*
  * Wrapper around transport structs that contain same-named congestion
@@ -155,7 +178,8 @@ struct cc_algo {
 
 /* Macro to obtain the CC algo's struct ptr. */
 //#define	CC_ALGO(tp)	((tp)->cc_algo)
-#define CC_ALGO(tp) (&newreno_cc_algo) // samkumar: This allows the #defines in cc_newreno.c to work as intended
+#define	CC_ALGO(tp)	((tp)->cc_state.algo == TCP_CC_RTTGRAD ?	\
+			    &rttgrad_cc_algo : &newreno_cc_algo)
 
 /* Macro to obtain the CC algo's data ptr. */
 #define	CC_DATA(tp)	((tp)->ccv->cc_data)
@@ -0,0 +1,215 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * RTT-gradient congestion control for multi-hop 802.15.4 paths.
+ *
+ * New Reno treats every loss as congestion. Over a Thread mesh most losses
+ * are link-layer losses that survived the MAC retries, and RTT varies widely
+ * with hop count and channel contention, so New Reno keeps collapsing cwnd on
+ * a path that is not actually congested.
+ *
+ * This module follows the approach of delay-gradient controllers (e.g. CDG):
+ * once per RTT round it compares the smoothed RTT against the value at the
+ * start of the round. A queue building up along the path shows as a
+ * sustained positive gradient; in that case growth is paused and, if the
+ * gradient persists, cwnd is reduced proactively. A loss that arrives while
+ * the gradient is flat or falling is classified as non-congestive: the
+ * segment is still retransmitted, but the window is not reduced. All other
+ * behaviour (slow start, congestion avoidance, recovery, idle restart) is
+ * delegated to New Reno.
+ */
+
+#include "../cc.h"
+#include "../tcp.h"
+#include "../tcp_seq.h"
+#include "../tcp_var.h"
+#include "cc_module.h"
+
+#include "../tcp_const.h"
+
+/* Consecutive rising rounds after which cwnd is backed off. */
+#define	RTTGRAD_BACKOFF_ROUNDS	2
+
+/* Multiplicative decrease applied on a delay-based backoff, in tenths. */
+#define	RTTGRAD_BACKOFF_TENTHS	7
+
+static void	rttgrad_ack_received(struct cc_var *ccv, uint16_t type);
+static void	rttgrad_after_idle(struct cc_var *ccv);
+static void	rttgrad_conn_init(struct cc_var *ccv);
+static void	rttgrad_cong_signal(struct cc_var *ccv, uint32_t type);
+static void	rttgrad_post_recovery(struct cc_var *ccv);
+
+const struct cc_algo rttgrad_cc_algo = {
+	.name = "rttgrad",
+	.conn_init = rttgrad_conn_init,
+	.ack_received = rttgrad_ack_received,
+	.after_idle = rttgrad_after_idle,
+	.cong_signal = rttgrad_cong_signal,
+	.post_recovery = rttgrad_post_recovery,
+};
+
+/*
+ * Minimum smoothed gradient (in t_srtt units) considered to be RTT growth:
+ * one tick, or 1/16 of the RTT at the start of the round, whichever is larger.
+ */
+static int32_t
+rttgrad_threshold(const struct cc_state *st)
+{
+	return max(TCP_RTT_SCALE, st->round_srtt >> 4);
+}
+
+static int
+rttgrad_is_congested(const struct cc_state *st)
+{
+	return st->rising_rounds != 0 || st->gradient > rttgrad_threshold(st);
+}
+
+static void
+rttgrad_start_round(struct cc_var *ccv)
+{
+	struct cc_state *st = &CCV(ccv, cc_state);
+
+	st->round_end = CCV(ccv, snd_max);
+	st->round_srtt = CCV(ccv, t_srtt);
+}
+
+static void
+rttgrad_conn_init(struct cc_var *ccv)
+{
+	struct cc_state *st = &CCV(ccv, cc_state);
+
+	st->rising_rounds = 0;
+	st->gradient = 0;
+	rttgrad_start_round(ccv);
+}
+
+/*
+ * Called once per RTT round. Updates the smoothed gradient (EWMA with gain
+ * 1/4) and backs off cwnd if the RTT has kept rising.
+ */
+static void
+rttgrad_end_round(struct cc_var *ccv)
+{
+	struct cc_state *st = &CCV(ccv, cc_state);
+	uint64_t cwnd;
+
+	if (st->round_srtt != 0) {
+		st->gradient += (CCV(ccv, t_srtt) - st->round_srtt -
+		    st->gradient) / 4;
+
+		if (st->gradient > rttgrad_threshold(st)) {
+			if (st->rising_rounds < UINT8_MAX)
+				st->rising_rounds++;
+		} else
+			st->rising_rounds = 0;
+	}
+
+	if (st->rising_rounds >= RTTGRAD_BACKOFF_ROUNDS &&
+	    !IN_RECOVERY(CCV(ccv, t_flags))) {
+		cwnd = CCV(ccv, snd_cwnd) * RTTGRAD_BACKOFF_TENTHS / 10;
+		CCV(ccv, snd_cwnd) = max(cwnd, 2 * CCV(ccv, t_maxseg));
+		CCV(ccv, snd_ssthresh) = CCV(ccv, snd_cwnd);
+		st->rising_rounds = 0;
+		st->gradient = 0;
+	}
+
+	rttgrad_start_round(ccv);
+}
+
+static void
+rttgrad_ack_received(struct cc_var *ccv, uint16_t type)
+{
+	struct cc_state *st = &CCV(ccv, cc_state);
+
+	if (type == CC_ACK && CCV(ccv, t_srtt) != 0 &&
+	    SEQ_GEQ(ccv->curack, st->round_end))
+		rttgrad_end_round(ccv);
+
+	/*
+	 * Hold cwnd in congestion avoidance while the RTT is rising; slow start
+	 * is left alone since ssthresh already bounds it.
+	 */
+	if (st->rising_rounds != 0 &&
+	    CCV(ccv, snd_cwnd) > CCV(ccv, snd_ssthresh))
+		return;
+
+	newreno_cc_algo.ack_received(ccv, type);
+}
+
+static void
+rttgrad_after_idle(struct cc_var *ccv)
+{
+	newreno_cc_algo.after_idle(ccv);
+	rttgrad_conn_init(ccv);
+}
+
+static void
+rttgrad_cong_signal(struct cc_var *ccv, uint32_t type)
+{
+	struct cc_state *st = &CCV(ccv, cc_state);
+
+	if (!rttgrad_is_congested(st)) {
+		switch (type) {
+		case CC_NDUPACK:
+			/*
+			 * Loss without queueing delay: retransmit through fast
+			 * recovery, but keep the window where it was.
+			 */
+			if (!IN_FASTRECOVERY(CCV(ccv, t_flags))) {
+				if (!IN_CONGRECOVERY(CCV(ccv, t_flags)))
+					CCV(ccv, snd_ssthresh) = max(CCV(ccv, snd_cwnd),
+					    2 * CCV(ccv, t_maxseg));
+				ENTER_RECOVERY(CCV(ccv, t_flags));
+				st->ignored_losses++;
+			}
+			return;
+		case CC_RTO:
+			/*
+			 * cc_cong_signal() has already collapsed cwnd to one
+			 * segment, which is still the right thing to do after
+			 * a timeout. On the first timeout, let slow start climb
+			 * back to the window in use before the loss.
+			 */
+			if (CCV(ccv, t_flags) & TF_PREVVALID) {
+				CCV(ccv, snd_ssthresh) = max(CCV(ccv, snd_ssthresh),
+				    CCV(ccv, snd_cwnd_prev));
+				st->ignored_losses++;
+			}
+			return;
+		}
+	}
+
+	newreno_cc_algo.cong_signal(ccv, type);
+}
+
+static void
+rttgrad_post_recovery(struct cc_var *ccv)
+{
+	newreno_cc_algo.post_recovery(ccv);
+}
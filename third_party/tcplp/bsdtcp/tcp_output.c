@@ -968,6 +968,12 @@ send:
 	if (len) {
 	    uint32_t used_space = lbuf_used_space(&tp->sendbuf);
 
+		/* Per-connection counterparts of tcps_sndpack/tcps_sndrexmitpack. */
+		if (SEQ_LT(tp->snd_nxt, tp->snd_max) || sack_rxmit)
+			tp->t_sndrexmitpack++;
+		else
+			tp->t_sndpack++;
+
 		/*
 		 * The TinyOS version has a way to avoid the copying we have to do here.
 		 * Because it is possible to send iovecs directly in the BLIP stack, and
@@ -999,7 +1005,7 @@ send:
 				if (curr == end) {
 					length_to_copy -= end_offset;
 				}
-				otMessageWrite(message, message_offset, data_to_copy, length_to_copy);
+				tcplp_sys_write_payload(tp->instance, message, message_offset, data_to_copy, length_to_copy);
 				message_offset += length_to_copy;
 			}
 		}
@@ -96,17 +96,19 @@ tcp_state_change(struct tcpcb *tp, int newstate)
  /* samkumar: Based on tcp_newtcb in tcp_subr.c, and tcp_usr_attach in tcp_usrreq.c. */
 void initialize_tcb(struct tcpcb* tp) {
 	uint32_t ticks = tcplp_sys_get_ticks();
+	uint8_t cc_algo = tp->cc_state.algo;
 
 	/* samkumar: Clear all fields starting laddr; rest are initialized by the host. */
 	memset(((uint8_t*) tp) + offsetof(struct tcpcb, laddr), 0x00, sizeof(struct tcpcb) - offsetof(struct tcpcb, laddr));
 	tp->reass_fin_index = -1;
 
 	/*
-	 * samkumar: Only New Reno congestion control is implemented at the moment,
-	 * so there's no need to record the congestion control algorithm used for
-	 * each TCB.
+	 * The congestion control algorithm is chosen by the host and must
+	 * survive the TCB being reinitialized when a connection closes, so it
+	 * is restored after the memset above.
 	 */
 	// CC_ALGO(tp) = CC_DEFAULT();
+	tp->cc_state.algo = cc_algo;
 	// tp->ccv->type = IPPROTO_TCP;
 	tp->ccv->ccvc.tcp = tp;
 
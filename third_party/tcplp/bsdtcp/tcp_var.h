@@ -361,6 +361,15 @@ struct tcpcb {
 		uint8_t client[TCP_FASTOPEN_MAX_COOKIE_LEN];
 		uint64_t server;
 	} t_tfo_cookie;			/* TCP Fast Open cookie to send */
+
+	/*
+	 * Congestion control selection, per-connection algorithm state and
+	 * send counters. Kept last so that adding them does not move any of
+	 * the fields above.
+	 */
+	struct cc_state	cc_state;
+	uint32_t	t_sndpack;		/* data segments sent */
+	uint32_t	t_sndrexmitpack;	/* data segments retransmitted */
 #if 0
 #if defined(_KERNEL) && defined(TCPPCAP)
 	struct mbufq t_inpkts;		/* List of saved input packets. */
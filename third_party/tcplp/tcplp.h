@@ -69,6 +69,11 @@ struct tcplp_signals
  */
 otMessage *   tcplp_sys_new_message(otInstance *aInstance);
 void          tcplp_sys_free_message(otInstance *aInstance, otMessage *aMessage);
+void          tcplp_sys_write_payload(otInstance *   aInstance,
+                                      otMessage *    aMessage,
+                                      uint16_t       aOffset,
+                                      const uint8_t *aData,
+                                      uint16_t       aLength);
 void          tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessageInfo *aMessageInfo);
 uint32_t      tcplp_sys_get_ticks();
 uint32_t      tcplp_sys_get_millis();